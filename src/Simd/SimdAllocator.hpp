@@ -27,6 +27,8 @@
 #include "Simd/SimdLib.h"
 
 #include <memory>
+#include <vector>
+#include <mutex>
 
 namespace Simd
 {
@@ -222,6 +224,311 @@ namespace Simd
     {
         return false;
     }
+
+    /*! \cond PRIVATE */
+    class MemoryPool
+    {
+    public:
+        static const size_t ALIGN = 64, HEADER = 64, CLASSES = 4 * 48, CACHE = 4;
+
+        static SIMD_INLINE void * Allocate(size_t size, size_t align)
+        {
+            uint8_t * raw, * data;
+            if (align > ALIGN)
+            {
+                raw = (uint8_t*)Allocator<uint8_t>::Allocate(size + align, align);
+                if (raw == NULL)
+                    return NULL;
+                data = raw + align;
+                ((size_t*)data)[-1] = CLASSES;
+                ((size_t*)data)[-2] = align;
+            }
+            else
+            {
+                size_t index = Index(size);
+                raw = (uint8_t*)Get(index);
+                if (raw == NULL)
+                    return NULL;
+                data = raw + HEADER;
+                ((size_t*)data)[-1] = index;
+                ((size_t*)data)[-2] = HEADER;
+            }
+            return data;
+        }
+
+        static SIMD_INLINE void Free(void * ptr)
+        {
+            if (ptr == NULL)
+                return;
+            size_t index = ((size_t*)ptr)[-1];
+            uint8_t * raw = (uint8_t*)ptr - ((size_t*)ptr)[-2];
+            if (index < CLASSES)
+                Put(index, raw);
+            else
+                Allocator<uint8_t>::Free(raw);
+        }
+
+        static SIMD_INLINE void SetLimit(size_t limit)
+        {
+            Shared & shared = Global();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            shared.limit = limit;
+            shared.Trim();
+        }
+
+        static SIMD_INLINE void Clear()
+        {
+            Local().Clear();
+            Shared & shared = Global();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            shared.Clear();
+        }
+
+    private:
+        static SIMD_INLINE size_t Index(size_t size)
+        {
+            if (size <= ALIGN)
+                return 0;
+            size_t bit = 6;
+            while ((size_t(1) << (bit + 1)) < size)
+                bit++;
+            size_t step = size_t(1) << (bit - 2);
+            return (bit - 6) * 4 + (size - (size_t(1) << bit) + step - 1) / step;
+        }
+
+        static SIMD_INLINE size_t Size(size_t index)
+        {
+            if (index == 0)
+                return ALIGN;
+            size_t bit = (index - 1) / 4 + 6;
+            return (size_t(1) << bit) + ((index - 1) % 4 + 1) * (size_t(1) << (bit - 2));
+        }
+
+        struct Shared
+        {
+            std::mutex mutex;
+            std::vector<void*> blocks[CLASSES];
+            size_t bytes, limit;
+
+            Shared() : bytes(0), limit(size_t(256) * 1024 * 1024) {}
+
+            ~Shared()
+            {
+                Clear();
+            }
+
+            void Trim()
+            {
+                for (size_t i = CLASSES - 1; i < CLASSES && bytes > limit; --i)
+                {
+                    for (; blocks[i].size() && bytes > limit; blocks[i].pop_back())
+                    {
+                        Allocator<uint8_t>::Free(blocks[i].back());
+                        bytes -= Size(i);
+                    }
+                }
+            }
+
+            void Clear()
+            {
+                for (size_t i = 0; i < CLASSES; ++i)
+                {
+                    for (size_t j = 0; j < blocks[i].size(); ++j)
+                        Allocator<uint8_t>::Free(blocks[i][j]);
+                    blocks[i].clear();
+                }
+                bytes = 0;
+            }
+        };
+
+        struct Cache
+        {
+            std::vector<void*> blocks[CLASSES];
+
+            ~Cache()
+            {
+                for (size_t i = 0; i < CLASSES; ++i)
+                {
+                    for (size_t j = 0; j < blocks[i].size(); ++j)
+                        Release(i, blocks[i][j]);
+                }
+            }
+
+            void Clear()
+            {
+                for (size_t i = 0; i < CLASSES; ++i)
+                {
+                    for (size_t j = 0; j < blocks[i].size(); ++j)
+                        Allocator<uint8_t>::Free(blocks[i][j]);
+                    blocks[i].clear();
+                }
+            }
+        };
+
+        static SIMD_INLINE Shared & Global()
+        {
+            static Shared shared;
+            return shared;
+        }
+
+        static SIMD_INLINE Cache & Local()
+        {
+            static thread_local Cache cache;
+            return cache;
+        }
+
+        static SIMD_INLINE void * Get(size_t index)
+        {
+            std::vector<void*> & local = Local().blocks[index];
+            if (local.size())
+            {
+                void * raw = local.back();
+                local.pop_back();
+                return raw;
+            }
+            {
+                Shared & shared = Global();
+                std::lock_guard<std::mutex> lock(shared.mutex);
+                if (shared.blocks[index].size())
+                {
+                    void * raw = shared.blocks[index].back();
+                    shared.blocks[index].pop_back();
+                    shared.bytes -= Size(index);
+                    return raw;
+                }
+            }
+            return Allocator<uint8_t>::Allocate(Size(index) + HEADER, ALIGN);
+        }
+
+        static SIMD_INLINE void Put(size_t index, void * raw)
+        {
+            std::vector<void*> & local = Local().blocks[index];
+            if (local.size() < CACHE)
+                local.push_back(raw);
+            else
+                Release(index, raw);
+        }
+
+        static SIMD_INLINE void Release(size_t index, void * raw)
+        {
+            Shared & shared = Global();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            if (shared.bytes + Size(index) <= shared.limit)
+            {
+                shared.blocks[index].push_back(raw);
+                shared.bytes += Size(index);
+            }
+            else
+                Allocator<uint8_t>::Free(raw);
+        }
+    };
+    /*! \endcond */
+
+    /*! @ingroup cpp_allocator
+
+        \short Pooled aligned memory allocator.
+
+        Recycles freed memory blocks by size class instead of returning them to the heap.
+        Every thread keeps a small cache of free blocks, the rest are shared between threads through a common pool.
+        So a steady-state loop which creates and destroys images of the same size does not call heap allocation at all.
+        Memory blocks can be freed in any thread.
+
+        \note It can be used as template parameter of Simd::View, Simd::Frame and Simd::Pyramid (e.g. Simd::View<Simd::PoolAllocator>) and as an allocator for STL containers.
+    */
+    template <class T> struct PoolAllocator : public Allocator<T>
+    {
+        /*!
+            \fn void * Allocate(size_t size, size_t align);
+
+            \short Allocates aligned memory block from the pool.
+
+            \note The memory allocated by this function is must be deleted by function Simd::PoolAllocator::Free.
+
+            \param [in] size - a size of required memory block.
+            \param [in] align - an align of allocated memory address.
+            \return a pointer to allocated memory.
+        */
+        static SIMD_INLINE void * Allocate(size_t size, size_t align)
+        {
+            return MemoryPool::Allocate(size, align);
+        }
+
+        /*!
+            \fn void Free(void * ptr);
+
+            \short Returns aligned memory block to the pool.
+
+            \note This function frees a memory allocated by function Simd::PoolAllocator::Allocate.
+
+            \param [in] ptr - a pointer to the memory to be deleted.
+        */
+        static SIMD_INLINE void Free(void * ptr)
+        {
+            MemoryPool::Free(ptr);
+        }
+
+        /*!
+            \fn void SetLimit(size_t limit);
+
+            \short Sets maximal total size of free memory blocks kept in the shared pool (256 MB by default).
+
+            \param [in] limit - a maximal size (in bytes) of the shared pool.
+        */
+        static SIMD_INLINE void SetLimit(size_t limit)
+        {
+            MemoryPool::SetLimit(limit);
+        }
+
+        /*!
+            \fn void Clear();
+
+            \short Releases free memory blocks kept in the shared pool and in the cache of current thread.
+        */
+        static SIMD_INLINE void Clear()
+        {
+            MemoryPool::Clear();
+        }
+
+        //---------------------------------------------------------------------
+        // STL allocator interface implementation:
+
+        typedef T * pointer;
+        typedef std::size_t size_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef PoolAllocator<U> other;
+        };
+
+        SIMD_INLINE PoolAllocator()
+        {
+        }
+
+        template <typename U> SIMD_INLINE PoolAllocator(const PoolAllocator<U> & a)
+        {
+        }
+
+        SIMD_INLINE pointer allocate(size_type size, const void * ptr = NULL)
+        {
+            return static_cast<pointer>(Allocate(size * sizeof(T), Allocator<T>::Alignment()));
+        }
+
+        SIMD_INLINE void deallocate(pointer ptr, size_type size)
+        {
+            Free(ptr);
+        }
+    };
+
+    template<typename T1, typename T2> SIMD_INLINE bool operator == (const PoolAllocator<T1> & a1, const PoolAllocator<T2> & a2)
+    {
+        return true;
+    }
+
+    template<typename T1, typename T2> SIMD_INLINE bool operator != (const PoolAllocator<T1> & a1, const PoolAllocator<T2> & a2)
+    {
+        return false;
+    }
 }
 
 #endif//__SimdAllocator_hpp__
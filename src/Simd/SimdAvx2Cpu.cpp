@@ -23,6 +23,8 @@
 */
 #include "Simd/SimdEnable.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdConst.h"
+#include "Simd/SimdTime.h"
 
 #if defined(_MSC_VER)
 #include <windows.h>
@@ -65,6 +67,86 @@ namespace Simd
         {
             return SupportedByCPU() && SupportedByOS();
         }
+
+        static double MeasurePeak32f(size_t count)
+        {
+            float src[12];
+            for (size_t i = 0; i < 12; ++i)
+                src[i] = 0.001f * float(i + 1);
+            __m256 w0 = _mm256_set1_ps(0.001f), w1 = _mm256_set1_ps(0.002f);
+            __m256 d00 = _mm256_setzero_ps(), d01 = _mm256_setzero_ps(), d10 = _mm256_setzero_ps(), d11 = _mm256_setzero_ps(), d20 = _mm256_setzero_ps(), d21 = _mm256_setzero_ps(), d30 = _mm256_setzero_ps(), d31 = _mm256_setzero_ps(), d40 = _mm256_setzero_ps(), d41 = _mm256_setzero_ps();
+            int64_t start = TimeCounter();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const float* s = src + (i & 7);
+                __m256 s0 = _mm256_set1_ps(s[0]);
+                d00 = _mm256_fmadd_ps(s0, w0, d00), d01 = _mm256_fmadd_ps(s0, w1, d01);
+                __m256 s1 = _mm256_set1_ps(s[1]);
+                d10 = _mm256_fmadd_ps(s1, w0, d10), d11 = _mm256_fmadd_ps(s1, w1, d11);
+                __m256 s2 = _mm256_set1_ps(s[2]);
+                d20 = _mm256_fmadd_ps(s2, w0, d20), d21 = _mm256_fmadd_ps(s2, w1, d21);
+                __m256 s3 = _mm256_set1_ps(s[3]);
+                d30 = _mm256_fmadd_ps(s3, w0, d30), d31 = _mm256_fmadd_ps(s3, w1, d31);
+                __m256 s4 = _mm256_set1_ps(s[4]);
+                d40 = _mm256_fmadd_ps(s4, w0, d40), d41 = _mm256_fmadd_ps(s4, w1, d41);
+            }
+            int64_t time = TimeCounter() - start;
+            d00 = _mm256_add_ps(_mm256_add_ps(d00, d01), _mm256_add_ps(d10, d11));
+            d20 = _mm256_add_ps(_mm256_add_ps(d20, d21), _mm256_add_ps(d30, d31));
+            d40 = _mm256_add_ps(_mm256_add_ps(d40, d41), _mm256_add_ps(d00, d20));
+            volatile float sink = _mm256_cvtss_f32(d40);
+            (void)sink;
+            return time > 0 ? double(count) * 10 * 2 * F * double(TimeFrequency()) / double(time) : 0.0;
+        }
+
+        double CpuPeak32f()
+        {
+            static const double peak = Base::CpuPeakCalibrate(MeasurePeak32f);
+            return peak;
+        }
+
+        static double MeasurePeak8i(size_t count)
+        {
+            int32_t src[12];
+            for (size_t i = 0; i < 12; ++i)
+                src[i] = int32_t(0x01010101 * (i + 1));
+            __m256i w0 = _mm256_set1_epi8(3), w1 = _mm256_set1_epi8(-2);
+            __m256i one = _mm256_set1_epi16(1);
+            __m256i d00 = _mm256_setzero_si256(), d01 = _mm256_setzero_si256(), d10 = _mm256_setzero_si256(), d11 = _mm256_setzero_si256(), d20 = _mm256_setzero_si256(), d21 = _mm256_setzero_si256(), d30 = _mm256_setzero_si256(), d31 = _mm256_setzero_si256(), d40 = _mm256_setzero_si256(), d41 = _mm256_setzero_si256();
+            int64_t start = TimeCounter();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const int32_t* s = src + (i & 7);
+                __m256i s0 = _mm256_set1_epi32(s[0]);
+                d00 = _mm256_add_epi32(d00, _mm256_madd_epi16(_mm256_maddubs_epi16(s0, w0), one));
+                d01 = _mm256_add_epi32(d01, _mm256_madd_epi16(_mm256_maddubs_epi16(s0, w1), one));
+                __m256i s1 = _mm256_set1_epi32(s[1]);
+                d10 = _mm256_add_epi32(d10, _mm256_madd_epi16(_mm256_maddubs_epi16(s1, w0), one));
+                d11 = _mm256_add_epi32(d11, _mm256_madd_epi16(_mm256_maddubs_epi16(s1, w1), one));
+                __m256i s2 = _mm256_set1_epi32(s[2]);
+                d20 = _mm256_add_epi32(d20, _mm256_madd_epi16(_mm256_maddubs_epi16(s2, w0), one));
+                d21 = _mm256_add_epi32(d21, _mm256_madd_epi16(_mm256_maddubs_epi16(s2, w1), one));
+                __m256i s3 = _mm256_set1_epi32(s[3]);
+                d30 = _mm256_add_epi32(d30, _mm256_madd_epi16(_mm256_maddubs_epi16(s3, w0), one));
+                d31 = _mm256_add_epi32(d31, _mm256_madd_epi16(_mm256_maddubs_epi16(s3, w1), one));
+                __m256i s4 = _mm256_set1_epi32(s[4]);
+                d40 = _mm256_add_epi32(d40, _mm256_madd_epi16(_mm256_maddubs_epi16(s4, w0), one));
+                d41 = _mm256_add_epi32(d41, _mm256_madd_epi16(_mm256_maddubs_epi16(s4, w1), one));
+            }
+            int64_t time = TimeCounter() - start;
+            d00 = _mm256_add_epi32(_mm256_add_epi32(d00, d01), _mm256_add_epi32(d10, d11));
+            d20 = _mm256_add_epi32(_mm256_add_epi32(d20, d21), _mm256_add_epi32(d30, d31));
+            d40 = _mm256_add_epi32(_mm256_add_epi32(d40, d41), _mm256_add_epi32(d00, d20));
+            volatile int32_t sink = _mm256_cvtsi256_si32(d40);
+            (void)sink;
+            return time > 0 ? double(count) * 10 * 2 * A * double(TimeFrequency()) / double(time) : 0.0;
+        }
+
+        double CpuPeak8i()
+        {
+            static const double peak = Base::CpuPeakCalibrate(MeasurePeak8i);
+            return peak;
+        }
     }
 #endif
 }
@@ -415,6 +415,24 @@ namespace Simd
                 else
                     return new Base::SynetConvolution32fBf16Gemm(param);
             }
+            else if (Base::SynetTuning())
+            {
+                Base::SynetConvolution32fCreatePtrs candidates;
+                if (Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+                    candidates.push_back(Base::SynetConvolution32fCreate<Avx::SynetConvolution32fDepthwiseDotProduct>);
+                if (SynetConvolution32fWinograd::Preferable(param))
+                    candidates.push_back(Base::SynetConvolution32fCreate<SynetConvolution32fWinograd>);
+                if (SynetConvolution32fGemmNT::Preferable(param))
+                    candidates.push_back(Base::SynetConvolution32fCreate<SynetConvolution32fGemmNT>);
+                if (SynetConvolution32fDirectNchw::Preferable(param))
+                    candidates.push_back(Base::SynetConvolution32fCreate<Avx2::SynetConvolution32fDirectNchw>);
+                if (SynetConvolution32fNhwcDirect::Preferable(param))
+                    candidates.push_back(Base::SynetConvolution32fCreate<SynetConvolution32fNhwcDirect>);
+                if (SynetConvolution32fDirectNhwc::Preferable(param))
+                    candidates.push_back(Base::SynetConvolution32fCreate<SynetConvolution32fDirectNhwc>);
+                candidates.push_back(Base::SynetConvolution32fCreate<SynetConvolution32fGemmNN>);
+                return Base::SynetConvolution32fTune(param, candidates);
+            }
             else if (Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param))
                 return new Avx::SynetConvolution32fDepthwiseDotProduct(param);
             else if (SynetConvolution32fWinograd::Preferable(param))
@@ -63,7 +63,7 @@ namespace Simd
 		}
 
 		template <Term8iType term, SimdConvolutionActivationType activation, bool nofma> void ConvolutionNhwcDepthwiseDefault(
-			const uint8_t* src, const ConvParam8i& p, const AlgParam& a, const int8_t* weight, const float* norm,
+			const uint8_t* src, const ConvParam8i& p, const AlgParam& a, size_t dyBeg, size_t dyEnd, const int8_t* weight, const float* norm,
 			const float* bias, const float* params, const float* scale, const float* shift, uint8_t* dst)
 		{
 			__m256i zero = _mm256_set1_epi32(a.zero);
@@ -74,7 +74,8 @@ namespace Simd
 			size_t sizeF = AlignLo(size, F);
 			size_t sizeDF = AlignLo(size, DF);
 			size_t sizeQF = AlignLo(size, QF);
-			for (size_t dy = 0; dy < p.dstH; ++dy)
+			dst += dyBeg * p.dstW * p.dstC * a.size;
+			for (size_t dy = dyBeg; dy < dyEnd; ++dy)
 			{
 				for (size_t dx = 0; dx < p.dstW; ++dx)
 				{
@@ -458,7 +459,7 @@ namespace Simd
 		}
 
 		template<Term8iType term, SimdConvolutionActivationType activation, bool nofma> SIMD_INLINE void ConvolutionNhwcDepthwise3x3(
-			const uint8_t* src, const ConvParam8i& p, const AlgParam& a, const int8_t* weight, const float* norm,
+			const uint8_t* src, const ConvParam8i& p, const AlgParam& a, size_t dyBeg, size_t dyEnd, const int8_t* weight, const float* norm,
 			const float* bias, const float* params, const float* scale, const float* shift, uint8_t* dst)
 		{
 			size_t srcS = p.srcC * p.srcW;
@@ -467,11 +468,12 @@ namespace Simd
 			size_t dstW = p.dstW - p.padW;
 			size_t dstC = p.dstC * a.size;
 			size_t dstW2 = AlignLo(dstW - p.padX, 2) + p.padX;
-			size_t dy = 0;
-			for (; dy < p.padY; ++dy)
+			size_t dy = dyBeg, dyPad = Simd::Min(p.padY, dyEnd), dyBody = Simd::Min(dstH, dyEnd);
+			dst += dyBeg * p.dstW * dstC;
+			for (; dy < dyPad; ++dy)
 				for (size_t dx = 0; dx < p.dstW; ++dx)
 					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
-			for (; dy < dstH; ++dy)
+			for (; dy < dyBody; ++dy)
 			{
 				size_t dx = 0;
 				for (; dx < p.padX; ++dx)
@@ -484,7 +486,7 @@ namespace Simd
 				for (; dx < p.dstW; ++dx)
 					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
 			}
-			for (; dy < p.dstH; ++dy)
+			for (; dy < dyEnd; ++dy)
 				for (size_t dx = 0; dx < p.dstW; ++dx)
 					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
 		}
@@ -23,6 +23,8 @@
 */
 #include "Simd/SimdEnable.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdConst.h"
+#include "Simd/SimdTime.h"
 
 #if defined(_MSC_VER)
 #include <windows.h>
@@ -60,6 +62,53 @@ namespace Simd
         {
             return SupportedByCPU() && SupportedByOS();
         }
+
+        double CpuPeak32f()
+        {
+            return Avx512bw::CpuPeak32f();
+        }
+
+        static double MeasurePeak8i(size_t count)
+        {
+            int32_t src[12];
+            for (size_t i = 0; i < 12; ++i)
+                src[i] = int32_t(0x01010101 * (i + 1));
+            __m512i w0 = _mm512_set1_epi8(3), w1 = _mm512_set1_epi8(-2);
+            __m512i d00 = _mm512_setzero_si512(), d01 = _mm512_setzero_si512(), d10 = _mm512_setzero_si512(), d11 = _mm512_setzero_si512(), d20 = _mm512_setzero_si512(), d21 = _mm512_setzero_si512(), d30 = _mm512_setzero_si512(), d31 = _mm512_setzero_si512(), d40 = _mm512_setzero_si512(), d41 = _mm512_setzero_si512();
+            int64_t start = TimeCounter();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const int32_t* s = src + (i & 7);
+                __m512i s0 = _mm512_set1_epi32(s[0]);
+                d00 = _mm512_dpbusd_epi32(d00, s0, w0);
+                d01 = _mm512_dpbusd_epi32(d01, s0, w1);
+                __m512i s1 = _mm512_set1_epi32(s[1]);
+                d10 = _mm512_dpbusd_epi32(d10, s1, w0);
+                d11 = _mm512_dpbusd_epi32(d11, s1, w1);
+                __m512i s2 = _mm512_set1_epi32(s[2]);
+                d20 = _mm512_dpbusd_epi32(d20, s2, w0);
+                d21 = _mm512_dpbusd_epi32(d21, s2, w1);
+                __m512i s3 = _mm512_set1_epi32(s[3]);
+                d30 = _mm512_dpbusd_epi32(d30, s3, w0);
+                d31 = _mm512_dpbusd_epi32(d31, s3, w1);
+                __m512i s4 = _mm512_set1_epi32(s[4]);
+                d40 = _mm512_dpbusd_epi32(d40, s4, w0);
+                d41 = _mm512_dpbusd_epi32(d41, s4, w1);
+            }
+            int64_t time = TimeCounter() - start;
+            d00 = _mm512_add_epi32(_mm512_add_epi32(d00, d01), _mm512_add_epi32(d10, d11));
+            d20 = _mm512_add_epi32(_mm512_add_epi32(d20, d21), _mm512_add_epi32(d30, d31));
+            d40 = _mm512_add_epi32(_mm512_add_epi32(d40, d41), _mm512_add_epi32(d00, d20));
+            volatile int32_t sink = _mm_cvtsi128_si32(_mm512_castsi512_si128(d40));
+            (void)sink;
+            return time > 0 ? double(count) * 10 * 2 * A * double(TimeFrequency()) / double(time) : 0.0;
+        }
+
+        double CpuPeak8i()
+        {
+            static const double peak = Base::CpuPeakCalibrate(MeasurePeak8i);
+            return peak;
+        }
     }
 #endif
 }
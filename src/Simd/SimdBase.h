@@ -36,6 +36,33 @@ namespace Simd
 
         void SetThreadNumber(size_t threadNumber);
 
+        void RunParallel(size_t begin, size_t end, SimdParallelTaskPtr task, void * context, size_t threadNumber, size_t blockAlign);
+
+        void SetThreadBudget(void * context, size_t threadNumber, const size_t * cpus, size_t cpuCount);
+
+        size_t GetThreadBudget(const void * context);
+
+        void SetThreadAffinity(const size_t * cpus, size_t cpuCount);
+
+        size_t GetThreadTopology(size_t * cpus, size_t * nodes, size_t size);
+
+        void * TaskGraphInit();
+
+        size_t TaskGraphSubmit(void * graph, SimdTaskGraphTaskPtr task, void * context, const size_t * deps, size_t depCount);
+
+        bool TaskGraphWait(void * graph, size_t task);
+
+        bool TaskGraphWaitAll(void * graph);
+
+        class ThreadBudgetScope
+        {
+        public:
+            ThreadBudgetScope(const void * context);
+            ~ThreadBudgetScope();
+        private:
+            const void * _previous;
+        };
+
         uint32_t Crc32(const void* src, size_t size);
 
         uint32_t Crc32c(const void * src, size_t size);
@@ -349,6 +376,10 @@ namespace Simd
             uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
             SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
 
+        void IntegralBandOrigin(const uint8_t * src, size_t width, const uint8_t * prev, const uint8_t * last, uint8_t * origin, SimdPixelFormatType format, bool square);
+
+        void IntegralBandShift(uint8_t * dst, size_t stride, size_t width, size_t height, SimdPixelFormatType format);
+
         void InterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation);
 
         void InterferenceIncrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height,
@@ -22,6 +22,8 @@
 * SOFTWARE.
 */
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdDispatch.h"
+#include "Simd/SimdTime.h"
 
 #include <vector>
 #include <thread>
@@ -40,6 +42,9 @@
 #include <unistd.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <dirent.h>
 
 #if defined(SIMD_X86_ENABLE) || defined(SIMD_X64_ENABLE)
 #include <cpuid.h>
@@ -157,6 +162,14 @@ namespace Simd
                     return info[i].Cache.Size;
             return 0;
         }
+
+        size_t CpuNumaNode(size_t cpu)
+        {
+            UCHAR node = 0;
+            if (cpu > 255 || !::GetNumaProcessorNode((UCHAR)cpu, &node) || node == 0xFF)
+                return 0;
+            return node;
+        }
 #elif defined(__GNUC__)
         size_t CpuSocketNumber()
         {
@@ -186,6 +199,26 @@ namespace Simd
             return number;
         }
 
+        size_t CpuNumaNode(size_t cpu)
+        {
+            char path[PATH_MAX];
+            ::snprintf(path, PATH_MAX, "/sys/devices/system/cpu/cpu%d", (int)cpu);
+            DIR * dir = ::opendir(path);
+            if (dir == NULL)
+                return 0;
+            size_t node = 0;
+            for (struct dirent * entry = ::readdir(dir); entry; entry = ::readdir(dir))
+            {
+                if (::strncmp(entry->d_name, "node", 4) == 0 && entry->d_name[4] >= '0' && entry->d_name[4] <= '9')
+                {
+                    node = ::atoi(entry->d_name + 4);
+                    break;
+                }
+            }
+            ::closedir(dir);
+            return node;
+        }
+
         SIMD_INLINE size_t CorrectIfZero(size_t value, size_t otherwise)
         {
             return value ? value : otherwise;
@@ -220,6 +253,110 @@ namespace Simd
 #else
 #error This platform is unsupported!
 #endif
+
+        std::string CpuModel()
+        {
+            std::string model;
+#if defined(SIMD_X86_ENABLE) || defined(SIMD_X64_ENABLE)
+            unsigned int registers[12] = { 0 };
+#if defined(_MSC_VER)
+            __cpuid((int*)registers, 0x80000000);
+            if (registers[Cpuid::Eax] >= 0x80000004)
+            {
+                for (int i = 0; i < 3; ++i)
+                    __cpuid((int*)registers + 4 * i, 0x80000002 + i);
+            }
+#elif defined(__GNUC__)
+            if (__get_cpuid_max(0x80000000, NULL) >= 0x80000004)
+            {
+                for (unsigned int i = 0; i < 3; ++i)
+                    __cpuid(0x80000002 + i, registers[4 * i + 0], registers[4 * i + 1], registers[4 * i + 2], registers[4 * i + 3]);
+            }
+#endif
+            model = std::string((char*)registers, sizeof(registers)).c_str();
+#elif defined(__GNUC__)
+            ::FILE* file = ::fopen("/proc/cpuinfo", "r");
+            if (file)
+            {
+                char buffer[PATH_MAX];
+                const char* keys[] = { "model name", "Model", "cpu", "Hardware" };
+                while (model.empty() && ::fgets(buffer, PATH_MAX, file))
+                {
+                    const char* colon = ::strchr(buffer, ':');
+                    for (size_t k = 0; colon && k < 4 && model.empty(); ++k)
+                        if (::strncmp(buffer, keys[k], ::strlen(keys[k])) == 0 && (buffer[::strlen(keys[k])] == ' ' || buffer[::strlen(keys[k])] == '\t'))
+                            model = colon + 1;
+                }
+                ::fclose(file);
+            }
+#endif
+            size_t beg = model.find_first_not_of(" \t\n"), end = model.find_last_not_of(" \t\n");
+            return beg == std::string::npos ? std::string("Unknown") : model.substr(beg, end - beg + 1);
+        }
+
+        static double MeasurePeak32f(size_t count)
+        {
+            float src[12], w0 = 0.001f, w1 = 0.002f;
+            for (size_t i = 0; i < 12; ++i)
+                src[i] = 0.001f * float(i + 1);
+            float d00 = 0, d01 = 0, d10 = 0, d11 = 0, d20 = 0, d21 = 0, d30 = 0, d31 = 0, d40 = 0, d41 = 0;
+            int64_t start = TimeCounter();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const float* s = src + (i & 7);
+                d00 += s[0] * w0, d01 += s[0] * w1;
+                d10 += s[1] * w0, d11 += s[1] * w1;
+                d20 += s[2] * w0, d21 += s[2] * w1;
+                d30 += s[3] * w0, d31 += s[3] * w1;
+                d40 += s[4] * w0, d41 += s[4] * w1;
+            }
+            int64_t time = TimeCounter() - start;
+            volatile float sink = d00 + d01 + d10 + d11 + d20 + d21 + d30 + d31 + d40 + d41;
+            (void)sink;
+            return time > 0 ? double(count) * 10 * 2 * double(TimeFrequency()) / double(time) : 0.0;
+        }
+
+        double CpuPeak32f()
+        {
+            static const double peak = CpuPeakCalibrate(MeasurePeak32f);
+            return peak;
+        }
+
+        static double MeasurePeak8i(size_t count)
+        {
+            uint8_t src[12];
+            int8_t w0 = 3, w1 = -2;
+            for (size_t i = 0; i < 12; ++i)
+                src[i] = uint8_t(i + 1);
+            int32_t d00 = 0, d01 = 0, d10 = 0, d11 = 0, d20 = 0, d21 = 0, d30 = 0, d31 = 0, d40 = 0, d41 = 0;
+            int64_t start = TimeCounter();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint8_t* s = src + (i & 7);
+                d00 += s[0] * w0, d01 += s[0] * w1;
+                d10 += s[1] * w0, d11 += s[1] * w1;
+                d20 += s[2] * w0, d21 += s[2] * w1;
+                d30 += s[3] * w0, d31 += s[3] * w1;
+                d40 += s[4] * w0, d41 += s[4] * w1;
+            }
+            int64_t time = TimeCounter() - start;
+            volatile int32_t sink = d00 + d01 + d10 + d11 + d20 + d21 + d30 + d31 + d40 + d41;
+            (void)sink;
+            return time > 0 ? double(count) * 10 * 2 * double(TimeFrequency()) / double(time) : 0.0;
+        }
+
+        double CpuPeak8i()
+        {
+            static const double peak = CpuPeakCalibrate(MeasurePeak8i);
+            return peak;
+        }
+
+        std::atomic<int> g_maxIsa(SimdCpuInfoNeon);
+
+        void SetMaxIsa(SimdCpuInfoType isa)
+        {
+            g_maxIsa.store(isa < SimdCpuInfoSse2 ? 0 : int(isa), std::memory_order_relaxed);
+        }
     }
 
     namespace Cpu
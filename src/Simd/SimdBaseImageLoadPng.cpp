@@ -979,7 +979,8 @@ namespace Simd
             s->channels = _channels;
             z->depth = _depth;
 
-            InputMemoryStream zSrc = MergedDataStream();
+            Scratch scratch;
+            InputMemoryStream zSrc = MergedDataStream(scratch);
             OutputMemoryStream zDst(AlignHi(size_t(_width) * _depth, 8) * _height * _channels + _height);
             if(!Zlib::Decode(zSrc, zDst, !_iPhone))
                 return false;
@@ -1247,7 +1248,7 @@ namespace Simd
             return true;
         }
 
-        InputMemoryStream ImagePngLoader::MergedDataStream()
+        InputMemoryStream ImagePngLoader::MergedDataStream(Scratch& scratch)
         {
             if (_idats.size() == 1)
                 return InputMemoryStream((uint8_t*)_stream.Data() + _idats[0].offs, _idats[0].size);
@@ -1256,13 +1257,13 @@ namespace Simd
                 size_t size = 0;
                 for (size_t i = 0; i < _idats.size(); ++i)
                     size += _idats[i].size;
-                _idat.Resize(size);
+                uint8_t* idat = scratch.Allocate<uint8_t>(size);
                 for (size_t i = 0, offset = 0; i < _idats.size(); ++i)
                 {
-                    memcpy(_idat.data + offset, _stream.Data() + _idats[i].offs, _idats[i].size);
+                    memcpy(idat + offset, _stream.Data() + _idats[i].offs, _idats[i].size);
                     offset += _idats[i].size;
                 }
-                return InputMemoryStream(_idat.data, _idat.size);
+                return InputMemoryStream(idat, size);
             }
         }
     }
@@ -83,5 +83,39 @@ namespace Simd
                 }
             }
         }
+
+        void IntegralBandOrigin(const uint8_t * src, size_t width, const uint8_t * prev, const uint8_t * last, uint8_t * origin, SimdPixelFormatType format, bool square)
+        {
+            switch (format)
+            {
+            case SimdPixelFormatInt32:
+                if (square)
+                    Simd::IntegralBandOrigin<uint32_t, true>(src, width, (uint32_t*)prev, (uint32_t*)last, (uint32_t*)origin);
+                else
+                    Simd::IntegralBandOrigin<uint32_t, false>(src, width, (uint32_t*)prev, (uint32_t*)last, (uint32_t*)origin);
+                break;
+            case SimdPixelFormatDouble:
+                assert(square);
+                Simd::IntegralBandOrigin<double, true>(src, width, (double*)prev, (double*)last, (double*)origin);
+                break;
+            default:
+                assert(0);
+            }
+        }
+
+        void IntegralBandShift(uint8_t * dst, size_t stride, size_t width, size_t height, SimdPixelFormatType format)
+        {
+            switch (format)
+            {
+            case SimdPixelFormatInt32:
+                Simd::IntegralBandShift<uint32_t>((uint32_t*)dst, stride / sizeof(uint32_t), width, height);
+                break;
+            case SimdPixelFormatDouble:
+                Simd::IntegralBandShift<double>((double*)dst, stride / sizeof(double), width, height);
+                break;
+            default:
+                assert(0);
+            }
+        }
     }
 }
@@ -0,0 +1,102 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+
+#include <mutex>
+#include <unordered_map>
+
+#ifdef SIMD_HUGE_PAGE_ENABLE
+#include <sys/mman.h>
+#endif
+
+namespace Simd
+{
+    namespace Base
+    {
+        std::atomic<size_t> g_hugePageThreshold(0);
+        std::atomic<size_t> g_hugePageBlocks(0);
+
+        class HugePageRegistry
+        {
+        public:
+            static HugePageRegistry & Instance()
+            {
+                static HugePageRegistry registry;
+                return registry;
+            }
+
+            void Add(void * ptr, size_t size)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _blocks[ptr] = size;
+                _bytes += size;
+                g_hugePageBlocks++;
+            }
+
+            void Remove(void * ptr)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                Blocks::iterator it = _blocks.find(ptr);
+                if (it != _blocks.end())
+                {
+                    _bytes -= it->second;
+                    _blocks.erase(it);
+                    g_hugePageBlocks--;
+                }
+            }
+
+            size_t Bytes()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _bytes;
+            }
+
+        private:
+            HugePageRegistry() : _bytes(0) {}
+
+            typedef std::unordered_map<void*, size_t> Blocks;
+            Blocks _blocks;
+            size_t _bytes;
+            std::mutex _mutex;
+        };
+
+        void AdviseHugePage(void * ptr, size_t size)
+        {
+#if defined(SIMD_HUGE_PAGE_ENABLE) && defined(MADV_HUGEPAGE)
+            if (::madvise(ptr, size, MADV_HUGEPAGE) == 0)
+                HugePageRegistry::Instance().Add(ptr, size);
+#endif
+        }
+
+        void ReleaseHugePage(void * ptr)
+        {
+            HugePageRegistry::Instance().Remove(ptr);
+        }
+
+        size_t HugePageBytes()
+        {
+            return HugePageRegistry::Instance().Bytes();
+        }
+    }
+}
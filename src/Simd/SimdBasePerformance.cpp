@@ -24,6 +24,14 @@
 #include "Simd/SimdPerformance.h"
 
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+
+#ifdef SIMD_PERF_COUNTERS_ENABLE
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
 namespace Simd
 {
     namespace Base
@@ -33,9 +41,117 @@ namespace Simd
             return double(count) / double(TimeFrequency()) * 1000.0;
         }
 
-        PerformanceMeasurer::PerformanceMeasurer(const String& name, int64_t flop)
+        const char * PerformanceCounters::Name(size_t type)
+        {
+            static const char * const names[Size] = { "cycles", "instructions", "l1d_misses", "llc_misses", "stalled_cycles" };
+            return type < Size ? names[type] : "unknown";
+        }
+
+#ifdef SIMD_PERF_COUNTERS_ENABLE
+        class PerformanceCounterGroup
+        {
+            int _fds[PerformanceCounters::Size];
+            size_t _types[PerformanceCounters::Size], _size;
+
+            static int Open(uint32_t type, uint64_t config, int group)
+            {
+                perf_event_attr attr;
+                memset(&attr, 0, sizeof(attr));
+                attr.size = sizeof(attr);
+                attr.type = type;
+                attr.config = config;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+                return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group, 0);
+            }
+
+        public:
+            PerformanceCounterGroup()
+                : _size(0)
+            {
+                static const uint32_t types[PerformanceCounters::Size] = { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, 
+                    PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE };
+                static const uint64_t configs[PerformanceCounters::Size] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                    PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+                    PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_STALLED_CYCLES_BACKEND };
+                for (size_t i = 0; i < PerformanceCounters::Size; ++i)
+                {
+                    int fd = Open(types[i], configs[i], _size ? _fds[0] : -1);
+                    if (fd == -1)
+                    {
+                        if (i == PerformanceCounters::Cycles)
+                            break;
+                        continue;
+                    }
+                    _fds[_size] = fd;
+                    _types[_size] = i;
+                    _size++;
+                }
+            }
+
+            ~PerformanceCounterGroup()
+            {
+                for (size_t i = 0; i < _size; ++i)
+                    close(_fds[i]);
+            }
+
+            bool Read(int64_t * values)
+            {
+                uint64_t buffer[3 + PerformanceCounters::Size];
+                if (_size == 0 || read(_fds[0], buffer, sizeof(buffer)) < ssize_t((3 + _size) * sizeof(uint64_t)))
+                    return false;
+                double scale = buffer[2] && buffer[2] < buffer[1] ? double(buffer[1]) / double(buffer[2]) : 1.0;
+                for (size_t i = 0; i < PerformanceCounters::Size; ++i)
+                    values[i] = 0;
+                for (size_t i = 0; i < _size; ++i)
+                    values[_types[i]] = int64_t(double(buffer[3 + i]) * scale);
+                return true;
+            }
+        };
+
+        bool PerformanceCounters::Read(int64_t * values)
+        {
+            static thread_local PerformanceCounterGroup group;
+            return group.Read(values);
+        }
+#else
+        bool PerformanceCounters::Read(int64_t * values)
+        {
+            return false;
+        }
+#endif
+
+        SIMD_INLINE String JsonStr(const String & str)
+        {
+            String dst = "\"";
+            for (size_t i = 0; i < str.size(); ++i)
+            {
+                if (str[i] == '"' || str[i] == '\\')
+                    dst.push_back('\\');
+                dst.push_back(str[i]);
+            }
+            return dst + "\"";
+        }
+
+        SIMD_INLINE String CsvStr(const String & str)
+        {
+            String dst = "\"";
+            for (size_t i = 0; i < str.size(); ++i)
+            {
+                if (str[i] == '"')
+                    dst.push_back('"');
+                dst.push_back(str[i]);
+            }
+            return dst + "\"";
+        }
+
+        //---------------------------------------------------------------------
+
+        PerformanceMeasurer::PerformanceMeasurer(const String& name, int64_t flop, int64_t bytes)
             : _name(name)
             , _flop(flop)
+            , _bytes(bytes)
             , _count(0)
             , _current(0)
             , _total(0)
@@ -43,12 +159,16 @@ namespace Simd
             , _max(std::numeric_limits<int64_t>::min())
             , _entered(false)
             , _paused(false)
+            , _counting(false)
         {
+            memset(_histogram, 0, sizeof(_histogram));
+            memset(_counters, 0, sizeof(_counters));
         }
 
         PerformanceMeasurer::PerformanceMeasurer(const PerformanceMeasurer & pm)
             : _name(pm._name)
             , _flop(pm._flop)
+            , _bytes(pm._bytes)
             , _count(pm._count)
             , _start(pm._start)
             , _current(pm._current)
@@ -57,38 +177,11 @@ namespace Simd
             , _max(pm._max)
             , _entered(pm._entered)
             , _paused(pm._paused)
+            , _counting(pm._counting)
         {
-        }
-
-        void PerformanceMeasurer::Enter()
-        {
-            if (!_entered)
-            {
-                _entered = true;
-                _paused = false;
-                _start = TimeCounter();
-            }
-        }
-
-        void PerformanceMeasurer::Leave(bool pause)
-        {
-            if (_entered || _paused)
-            {
-                if (_entered)
-                {
-                    _entered = false;
-                    _current += TimeCounter() - _start;
-                }
-                if (!pause)
-                {
-                    _total += _current;
-                    _min = std::min(_min, _current);
-                    _max = std::max(_max, _current);
-                    ++_count;
-                    _current = 0;
-                }
-                _paused = pause;
-            }
+            memcpy(_histogram, pm._histogram, sizeof(_histogram));
+            memcpy(_counters, pm._counters, sizeof(_counters));
+            memcpy(_counterStart, pm._counterStart, sizeof(_counterStart));
         }
 
         String PerformanceMeasurer::Statistic() const
@@ -98,9 +191,18 @@ namespace Simd
             ss << std::setprecision(0) << std::fixed << Miliseconds(_total) << " ms";
             ss << " / " << _count << " = ";
             ss << std::setprecision(3) << std::fixed << Average() << " ms";
-            ss << std::setprecision(3) << " {min=" << Miliseconds(_min) << "; max=" << Miliseconds(_max) << "}";
+            ss << std::setprecision(3) << " {min=" << Miliseconds(_min) << "; max=" << Miliseconds(_max);
+            ss << "; p50=" << Percentile(50.0) << "; p99=" << Percentile(99.0) << "}";
             if (_flop)
                 ss << " " << std::setprecision(1) << GFlops() << " GFlops";
+            if (_count && _counters[PerformanceCounters::Cycles])
+            {
+                ss << std::setprecision(0) << " {cycles=" << double(_counters[PerformanceCounters::Cycles]) / _count;
+                ss << std::setprecision(2) << "; ipc=" << double(_counters[PerformanceCounters::Instructions]) / _counters[PerformanceCounters::Cycles];
+                ss << std::setprecision(0) << "; l1d-miss=" << double(_counters[PerformanceCounters::L1dMisses]) / _count;
+                ss << "; llc-miss=" << double(_counters[PerformanceCounters::LlcMisses]) / _count;
+                ss << "; stalled=" << double(_counters[PerformanceCounters::StalledCycles]) / _count << "}";
+            }
             return ss.str();
         }
 
@@ -110,6 +212,64 @@ namespace Simd
             _total += other._total;
             _min = std::min(_min, other._min);
             _max = std::max(_max, other._max);
+            for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+                _histogram[i] += other._histogram[i];
+            for (size_t i = 0; i < PerformanceCounters::Size; ++i)
+                _counters[i] += other._counters[i];
+        }
+
+        void PerformanceMeasurer::Subtract(const PerformanceMeasurer& base)
+        {
+            if (base._count == 0)
+                return;
+            _count -= base._count;
+            _total -= base._total;
+            for (size_t i = 0; i < PerformanceCounters::Size; ++i)
+                _counters[i] -= base._counters[i];
+            size_t lo = HISTOGRAM_SIZE, hi = 0;
+            for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+            {
+                _histogram[i] -= base._histogram[i];
+                if (_histogram[i])
+                {
+                    lo = std::min(lo, i);
+                    hi = i;
+                }
+            }
+            if (_count)
+            {
+                _min = std::max(_min, PerformanceHistogramValue(lo));
+                _max = std::min(_max, PerformanceHistogramValue(hi + 1) - 1);
+            }
+        }
+
+        void PerformanceMeasurer::Export(std::ostream & os, SimdPerformanceFormatType format) const
+        {
+            size_t beg = _name.find("{ "), end = _name.rfind(" }");
+            String name = _name.substr(0, beg), desc = beg != String::npos && end > beg ? _name.substr(beg + 2, end - beg - 2) : String();
+            os << std::setprecision(6) << std::fixed;
+            if (format == SimdPerformanceFormatJson)
+            {
+                os << "{\"name\": " << JsonStr(name) << ", \"desc\": " << JsonStr(desc) << ", \"isa\": " << JsonStr(Isa());
+                os << ", \"count\": " << _count << ", \"total\": " << Miliseconds(_total) << ", \"average\": " << Average();
+                os << ", \"min\": " << (_count ? Miliseconds(_min) : 0.0) << ", \"max\": " << (_count ? Miliseconds(_max) : 0.0);
+                os << ", \"p50\": " << Percentile(50.0) << ", \"p99\": " << Percentile(99.0);
+                os << ", \"flop\": " << _flop << ", \"gflops\": " << GFlops();
+                os << ", \"bytes\": " << _bytes << ", \"gbytes\": " << GBytes();
+                for (size_t i = 0; i < PerformanceCounters::Size; ++i)
+                    os << ", \"" << PerformanceCounters::Name(i) << "\": " << _counters[i];
+                os << "}";
+            }
+            else if (format == SimdPerformanceFormatCsv)
+            {
+                os << CsvStr(name) << "," << CsvStr(desc) << "," << Isa();
+                os << "," << _count << "," << Miliseconds(_total) << "," << Average();
+                os << "," << (_count ? Miliseconds(_min) : 0.0) << "," << (_count ? Miliseconds(_max) : 0.0);
+                os << "," << Percentile(50.0) << "," << Percentile(99.0);
+                os << "," << _flop << "," << GFlops() << "," << _bytes << "," << GBytes();
+                for (size_t i = 0; i < PerformanceCounters::Size; ++i)
+                    os << "," << _counters[i];
+            }
         }
 
         double PerformanceMeasurer::Average() const
@@ -122,19 +282,79 @@ namespace Simd
             return _count && _flop && _total > 0 ? (double(_flop) * _count / Miliseconds(_total) / 1000000.0) : 0;
         }
 
+        double PerformanceMeasurer::GBytes() const
+        {
+            return _count && _bytes && _total > 0 ? (double(_bytes) * _count / Miliseconds(_total) / 1000000.0) : 0;
+        }
+
+        String PerformanceMeasurer::Isa() const
+        {
+            static const char * const isas[] = { "Base", "Sse41", "Avx", "Avx2", "Avx512bw", "Avx512vnni", "Avx512bf16", "Amx", "Neon" };
+            size_t best = String::npos;
+            String isa = "Base";
+            for (size_t i = 0; i < sizeof(isas) / sizeof(isas[0]); ++i)
+            {
+                String token = String(isas[i]) + "::";
+                for (size_t pos = _name.find(token); pos != String::npos; pos = _name.find(token, pos + 1))
+                {
+                    if (pos == 0 || !isalnum(_name[pos - 1]))
+                    {
+                        if (pos < best)
+                        {
+                            best = pos;
+                            isa = isas[i];
+                        }
+                        break;
+                    }
+                }
+            }
+            return isa;
+        }
+
+        double PerformanceMeasurer::Percentile(double percent) const
+        {
+            int64_t rank = int64_t(double(_count) * percent / 100.0), sum = 0;
+            for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+            {
+                sum += _histogram[i];
+                if (sum > rank || sum == _count)
+                {
+                    int64_t lo = PerformanceHistogramValue(i), hi = PerformanceHistogramValue(i + 1);
+                    return Miliseconds(std::max(_min, std::min(_max, (lo + hi) / 2)));
+                }
+            }
+            return 0;
+        }
+
         //---------------------------------------------------------------------
 
         PerformanceMeasurerStorage PerformanceMeasurerStorage::s_storage;
 
-        const char * PerformanceMeasurerStorage::PerformanceStatistic()
+        size_t PerformanceMeasurerStorage::Register(const String & name)
         {
-            if (_map.empty())
-                return "";
-            FunctionMap combined;
             std::lock_guard<std::mutex> lock(_mutex);
-            for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread)
+            _handles.push_back(name);
+            return _handles.size() - 1;
+        }
+
+        PerformanceMeasurer * PerformanceMeasurerStorage::CreateHandle(Thread & thread, size_t handle, int64_t flop)
+        {
+            String name;
             {
-                for (FunctionMap::const_iterator function = thread->second.begin(); function != thread->second.end(); ++function)
+                std::lock_guard<std::mutex> lock(_mutex);
+                name = _handles[handle];
+            }
+            if (handle >= thread.handles.size())
+                thread.handles.resize(handle + 1, NULL);
+            thread.handles[handle] = Get(name, flop);
+            return thread.handles[handle];
+        }
+
+        void PerformanceMeasurerStorage::Combine(FunctionMap & combined) const
+        {
+            for (Threads::const_iterator thread = _threads.begin(); thread != _threads.end(); ++thread)
+            {
+                for (FunctionMap::const_iterator function = (*thread)->functions.begin(); function != (*thread)->functions.end(); ++function)
                 {
                     if (combined.find(function->first) == combined.end())
                         combined[function->first].reset(new PerformanceMeasurer(*function->second));
@@ -142,6 +362,15 @@ namespace Simd
                         combined[function->first]->Combine(*function->second);
                 }
             }
+        }
+
+        const char * PerformanceMeasurerStorage::PerformanceStatistic()
+        {
+            FunctionMap combined;
+            std::lock_guard<std::mutex> lock(_mutex);
+            Combine(combined);
+            if (combined.empty())
+                return "";
             std::stringstream report;
             report << std::endl << "Simd Library Internal Performance Statistics:" << std::endl;
             for (FunctionMap::const_iterator it = combined.begin(); it != combined.end(); ++it)
@@ -149,6 +378,45 @@ namespace Simd
             _report = report.str();
             return _report.c_str();
         }
+
+        const char * PerformanceMeasurerStorage::Export(SimdPerformanceFormatType format, bool reset)
+        {
+            FunctionMap combined;
+            std::lock_guard<std::mutex> lock(_mutex);
+            Combine(combined);
+            std::stringstream report;
+            if (format == SimdPerformanceFormatJson)
+                report << "{\"functions\": [";
+            else if (format == SimdPerformanceFormatCsv)
+            {
+                report << "name,desc,isa,count,total,average,min,max,p50,p99,flop,gflops,bytes,gbytes";
+                for (size_t i = 0; i < PerformanceCounters::Size; ++i)
+                    report << "," << PerformanceCounters::Name(i);
+                report << std::endl;
+            }
+            bool first = true;
+            for (FunctionMap::const_iterator it = combined.begin(); it != combined.end(); ++it)
+            {
+                PerformanceMeasurer interval(*it->second);
+                FunctionMap::const_iterator base = _snapshot.find(it->first);
+                if (base != _snapshot.end())
+                    interval.Subtract(*base->second);
+                if (interval.Count() == 0)
+                    continue;
+                if (format == SimdPerformanceFormatJson)
+                    report << (first ? "" : ",") << std::endl << "  ";
+                interval.Export(report, format);
+                if (format == SimdPerformanceFormatCsv)
+                    report << std::endl;
+                first = false;
+            }
+            if (format == SimdPerformanceFormatJson)
+                report << std::endl << "]}" << std::endl;
+            if (reset)
+                _snapshot.swap(combined);
+            _export = report.str();
+            return _export.c_str();
+        }
     }
 }
 #endif//SIMD_PERFORMANCE_STATISTIC
@@ -0,0 +1,495 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdPipeline.h"
+#include "Simd/SimdScratch.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE size_t PipelinePixelSize(SimdPixelFormatType format)
+        {
+            switch (format)
+            {
+            case SimdPixelFormatGray8: return 1;
+            case SimdPixelFormatUv16: return 1;
+            case SimdPixelFormatInt16: return 2;
+            case SimdPixelFormatBgr24: return 3;
+            case SimdPixelFormatRgb24: return 3;
+            case SimdPixelFormatBgra32: return 4;
+            default: return 0;
+            }
+        }
+
+        SIMD_INLINE size_t PipelineStride(size_t width, size_t pixel)
+        {
+            return AlignHi(width * pixel, SIMD_ALIGN);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        class PipelineConvert : public PipelineStage
+        {
+        public:
+            PipelineConvert(size_t w, size_t h, SimdPixelFormatType src, SimdPixelFormatType dst)
+                : PipelineStage(w, h, PipelinePixelSize(src), w, h, PipelinePixelSize(dst))
+                , _src(src)
+                , _dst(dst)
+            {
+                if (_src == SimdPixelFormatUv16)
+                    rowAlign = 2;
+            }
+
+            static bool Supported(SimdPixelFormatType src, SimdPixelFormatType dst)
+            {
+                switch (src)
+                {
+                case SimdPixelFormatUv16: return dst == SimdPixelFormatGray8 || dst == SimdPixelFormatBgr24 || dst == SimdPixelFormatBgra32;
+                case SimdPixelFormatGray8: return dst == SimdPixelFormatBgr24;
+                case SimdPixelFormatBgr24: return dst == SimdPixelFormatGray8;
+                case SimdPixelFormatRgb24: return dst == SimdPixelFormatGray8;
+                case SimdPixelFormatBgra32: return dst == SimdPixelFormatGray8 || dst == SimdPixelFormatBgr24;
+                default: return false;
+                }
+            }
+
+            virtual void Source(size_t beg, size_t end, size_t & srcBeg, size_t & srcEnd) const
+            {
+                srcBeg = AlignLo(beg, rowAlign);
+                srcEnd = Min(AlignHi(end, rowAlign), srcH);
+            }
+
+            virtual void Run(const uint8_t * const * src, const size_t * srcStride, size_t srcBeg, size_t srcEnd,
+                uint8_t * dst, size_t dstStride, size_t beg, size_t end) const
+            {
+                size_t rows = end - beg;
+                switch (_src)
+                {
+                case SimdPixelFormatUv16:
+                    if (_dst == SimdPixelFormatGray8)
+                    {
+                        for (size_t row = beg; row < end; ++row)
+                            memcpy(dst + (row - beg) * dstStride, src[0] + (row - srcBeg) * srcStride[0], srcW);
+                    }
+                    else
+                        Yuv(src, srcStride, srcBeg, srcEnd, dst, dstStride, beg, end);
+                    break;
+                case SimdPixelFormatGray8:
+                    SimdGrayToBgr(src[0], srcW, rows, srcStride[0], dst, dstStride);
+                    break;
+                case SimdPixelFormatBgr24:
+                    SimdBgrToGray(src[0], srcW, rows, srcStride[0], dst, dstStride);
+                    break;
+                case SimdPixelFormatRgb24:
+                    SimdRgbToGray(src[0], srcW, rows, srcStride[0], dst, dstStride);
+                    break;
+                case SimdPixelFormatBgra32:
+                    if (_dst == SimdPixelFormatGray8)
+                        SimdBgraToGray(src[0], srcW, rows, srcStride[0], dst, dstStride);
+                    else
+                        SimdBgraToBgr(src[0], srcW, rows, srcStride[0], dst, dstStride);
+                    break;
+                default:
+                    assert(0);
+                }
+            }
+
+        private:
+            SimdPixelFormatType _src, _dst;
+
+            void Yuv(const uint8_t * const * src, const size_t * srcStride, size_t srcBeg, size_t srcEnd,
+                uint8_t * dst, size_t dstStride, size_t beg, size_t end) const
+            {
+                Scratch scratch;
+                size_t rows = srcEnd - srcBeg, uvW = srcW / 2, uvH = rows / 2, uvStride = PipelineStride(uvW, 1);
+                uint8_t * u = scratch.Allocate<uint8_t>(uvStride * uvH);
+                uint8_t * v = scratch.Allocate<uint8_t>(uvStride * uvH);
+                SimdDeinterleaveUv(src[1], srcStride[1], uvW, uvH, u, uvStride, v, uvStride);
+                uint8_t * out = dst;
+                size_t outStride = dstStride;
+                if (srcBeg != beg || srcEnd != end)
+                {
+                    outStride = PipelineStride(dstW, dstPixel);
+                    out = scratch.Allocate<uint8_t>(outStride * rows);
+                }
+                if (_dst == SimdPixelFormatBgr24)
+                    SimdYuv420pToBgr(src[0], srcStride[0], u, uvStride, v, uvStride, srcW, rows, out, outStride);
+                else
+                    SimdYuv420pToBgra(src[0], srcStride[0], u, uvStride, v, uvStride, srcW, rows, out, outStride, 0xFF);
+                if (out != dst)
+                {
+                    for (size_t row = beg; row < end; ++row)
+                        memcpy(dst + (row - beg) * dstStride, out + (row - srcBeg) * outStride, dstW * dstPixel);
+                }
+            }
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class PipelineResize : public PipelineStage, public ResizerByteBilinear
+        {
+        public:
+            PipelineResize(size_t sw, size_t sh, size_t dw, size_t dh, size_t pixel)
+                : PipelineStage(sw, sh, pixel, dw, dh, pixel)
+                , ResizerByteBilinear(ResParam(sw, sh, dw, dh, pixel, SimdResizeChannelByte, SimdResizeMethodBilinear, SIMD_ALIGN))
+            {
+                size_t rs = dw * pixel;
+                _ax.Resize(rs);
+                _ix.Resize(rs);
+                EstimateIndexAlpha(sw, dw, pixel, _ix.data, _ax.data);
+            }
+
+            virtual void Source(size_t beg, size_t end, size_t & srcBeg, size_t & srcEnd) const
+            {
+                srcBeg = _iy[beg];
+                srcEnd = Simd::Min<size_t>(_iy[end - 1] + 2, srcH);
+            }
+
+            virtual void Run(const uint8_t * const * src, const size_t * srcStride, size_t srcBeg, size_t srcEnd,
+                uint8_t * dst, size_t dstStride, size_t beg, size_t end) const
+            {
+                size_t cn = dstPixel, rs = dstW * cn;
+                Scratch scratch;
+                int32_t * pbx[2] = { scratch.Allocate<int32_t>(rs), scratch.Allocate<int32_t>(rs) };
+                int32_t prev = -2;
+                for (size_t dy = beg; dy < end; dy++, dst += dstStride)
+                {
+                    int32_t fy = _ay[dy];
+                    int32_t sy = _iy[dy];
+                    int32_t k = 0;
+                    if (sy == prev)
+                        k = 2;
+                    else if (sy == prev + 1)
+                    {
+                        Swap(pbx[0], pbx[1]);
+                        k = 1;
+                    }
+                    prev = sy;
+                    for (; k < 2; k++)
+                    {
+                        int32_t * pb = pbx[k];
+                        const uint8_t * ps = src[0] + (sy + k - srcBeg) * srcStride[0];
+                        for (size_t dx = 0; dx < rs; dx++)
+                        {
+                            int32_t sx = _ix[dx];
+                            int32_t fx = _ax[dx];
+                            int32_t t = ps[sx];
+                            pb[dx] = (t << LINEAR_SHIFT) + (ps[sx + cn] - t) * fx;
+                        }
+                    }
+                    for (size_t dx = 0; dx < rs; dx++)
+                    {
+                        int32_t t = pbx[0][dx];
+                        dst[dx] = ((t << LINEAR_SHIFT) + (pbx[1][dx] - t) * fy + BILINEAR_ROUND_TERM) >> BILINEAR_SHIFT;
+                    }
+                }
+            }
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class PipelineFilter : public PipelineStage
+        {
+        public:
+            enum Type
+            {
+                GaussianBlur3x3,
+                SobelDxAbs,
+                SobelDyAbs,
+            };
+
+            PipelineFilter(size_t w, size_t h, size_t srcPixel, size_t dstPixel, Type type)
+                : PipelineStage(w, h, srcPixel, w, h, dstPixel)
+                , _type(type)
+            {
+            }
+
+            virtual void Source(size_t beg, size_t end, size_t & srcBeg, size_t & srcEnd) const
+            {
+                srcBeg = beg > 0 ? beg - 1 : 0;
+                srcEnd = Min(end + 1, srcH);
+            }
+
+            virtual void Run(const uint8_t * const * src, const size_t * srcStride, size_t srcBeg, size_t srcEnd,
+                uint8_t * dst, size_t dstStride, size_t beg, size_t end) const
+            {
+                Scratch scratch;
+                size_t rows = srcEnd - srcBeg, stride = PipelineStride(dstW, dstPixel);
+                uint8_t * buf = scratch.Allocate<uint8_t>(stride * rows);
+                switch (_type)
+                {
+                case GaussianBlur3x3:
+                    SimdGaussianBlur3x3(src[0], srcStride[0], srcW, rows, srcPixel, buf, stride);
+                    break;
+                case SobelDxAbs:
+                    SimdSobelDxAbs(src[0], srcStride[0], srcW, rows, buf, stride);
+                    break;
+                case SobelDyAbs:
+                    SimdSobelDyAbs(src[0], srcStride[0], srcW, rows, buf, stride);
+                    break;
+                }
+                for (size_t row = beg; row < end; ++row)
+                    memcpy(dst + (row - beg) * dstStride, buf + (row - srcBeg) * stride, dstW * dstPixel);
+            }
+
+        private:
+            Type _type;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class PipelineBinarization : public PipelineStage
+        {
+        public:
+            PipelineBinarization(size_t w, size_t h, uint8_t value, uint8_t positive, uint8_t negative, SimdCompareType compareType)
+                : PipelineStage(w, h, 1, w, h, 1)
+                , _value(value)
+                , _positive(positive)
+                , _negative(negative)
+                , _compareType(compareType)
+            {
+            }
+
+            virtual void Run(const uint8_t * const * src, const size_t * srcStride, size_t srcBeg, size_t srcEnd,
+                uint8_t * dst, size_t dstStride, size_t beg, size_t end) const
+            {
+                SimdBinarization(src[0], srcStride[0], srcW, end - beg, _value, _positive, _negative, dst, dstStride, _compareType);
+            }
+
+        private:
+            uint8_t _value, _positive, _negative;
+            SimdCompareType _compareType;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class PipelineSetInput : public PipelineStage
+        {
+        public:
+            PipelineSetInput(size_t w, size_t h, SimdPixelFormatType format, const float * lower, const float * upper, size_t channels, SimdTensorFormatType tensor)
+                : PipelineStage(w, h, PipelinePixelSize(format), w, h, channels * sizeof(float))
+                , _format(format)
+                , _channels(channels)
+                , _tensor(tensor)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    _lower[c] = lower[c];
+                    _upper[c] = upper[c];
+                }
+            }
+
+            virtual uint8_t * DstRow(uint8_t * dst, size_t dstStride, size_t row) const
+            {
+                return dst + row * dstW * (_tensor == SimdTensorFormatNhwc ? _channels : 1) * sizeof(float);
+            }
+
+            virtual bool Final() const
+            {
+                return true;
+            }
+
+            virtual void Run(const uint8_t * const * src, const size_t * srcStride, size_t srcBeg, size_t srcEnd,
+                uint8_t * dst, size_t dstStride, size_t beg, size_t end) const
+            {
+                size_t rows = end - beg;
+                if (_tensor == SimdTensorFormatNhwc || _channels == 1)
+                    SimdSynetSetInput(src[0], srcW, rows, srcStride[0], _format, _lower, _upper, (float*)dst, _channels, _tensor);
+                else
+                {
+                    Scratch scratch;
+                    size_t plane = rows * dstW;
+                    float * buf = scratch.Allocate<float>(plane * _channels);
+                    SimdSynetSetInput(src[0], srcW, rows, srcStride[0], _format, _lower, _upper, buf, _channels, _tensor);
+                    for (size_t c = 0; c < _channels; ++c)
+                        memcpy((float*)dst + c * dstH * dstW, buf + c * plane, plane * sizeof(float));
+                }
+            }
+
+        private:
+            SimdPixelFormatType _format;
+            size_t _channels;
+            SimdTensorFormatType _tensor;
+            float _lower[3], _upper[3];
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        Pipeline::Pipeline(size_t width, size_t height, SimdPixelFormatType format)
+            : _width(width)
+            , _height(height)
+            , _planes(format == SimdPixelFormatUv16 ? 2 : 1)
+            , _format(format)
+        {
+            _serial.budget.threadNumber = 1;
+        }
+
+        Pipeline::~Pipeline()
+        {
+            for (size_t i = 0; i < _stages.size(); ++i)
+                delete _stages[i];
+        }
+
+        bool Pipeline::Add(PipelineStage * stage)
+        {
+            _stages.push_back(stage);
+            _width = stage->dstW;
+            _height = stage->dstH;
+            return true;
+        }
+
+        bool Pipeline::AddConvert(SimdPixelFormatType format)
+        {
+            if ((_stages.size() && _stages.back()->Final()) || !PipelineConvert::Supported(_format, format))
+                return false;
+            Add(new PipelineConvert(_width, _height, _format, format));
+            _format = format;
+            return true;
+        }
+
+        bool Pipeline::AddResize(size_t width, size_t height)
+        {
+            if ((_stages.size() && _stages.back()->Final()) || _format == SimdPixelFormatUv16 || _format == SimdPixelFormatInt16)
+                return false;
+            if (_width < 2 || _height < 2 || width == 0 || height == 0)
+                return false;
+            return Add(new PipelineResize(_width, _height, width, height, PipelinePixelSize(_format)));
+        }
+
+        bool Pipeline::AddGaussianBlur3x3()
+        {
+            if ((_stages.size() && _stages.back()->Final()) || _format == SimdPixelFormatUv16 || _format == SimdPixelFormatInt16)
+                return false;
+            size_t pixel = PipelinePixelSize(_format);
+            return Add(new PipelineFilter(_width, _height, pixel, pixel, PipelineFilter::GaussianBlur3x3));
+        }
+
+        bool Pipeline::AddSobelAbs(bool dx)
+        {
+            if ((_stages.size() && _stages.back()->Final()) || _format != SimdPixelFormatGray8)
+                return false;
+            _format = SimdPixelFormatInt16;
+            return Add(new PipelineFilter(_width, _height, 1, 2, dx ? PipelineFilter::SobelDxAbs : PipelineFilter::SobelDyAbs));
+        }
+
+        bool Pipeline::AddBinarization(uint8_t value, uint8_t positive, uint8_t negative, SimdCompareType compareType)
+        {
+            if ((_stages.size() && _stages.back()->Final()) || _format != SimdPixelFormatGray8)
+                return false;
+            return Add(new PipelineBinarization(_width, _height, value, positive, negative, compareType));
+        }
+
+        bool Pipeline::AddSetInput(const float * lower, const float * upper, size_t channels, SimdTensorFormatType format)
+        {
+            if ((_stages.size() && _stages.back()->Final()) || _format == SimdPixelFormatUv16 || _format == SimdPixelFormatInt16)
+                return false;
+            if ((channels != 1 && channels != 3) || (format != SimdTensorFormatNchw && format != SimdTensorFormatNhwc))
+                return false;
+            return Add(new PipelineSetInput(_width, _height, _format, lower, upper, channels, format));
+        }
+
+        size_t Pipeline::StripRows() const
+        {
+            double bytes = 0;
+            for (size_t i = 0; i < _stages.size(); ++i)
+            {
+                const PipelineStage & s = *_stages[i];
+                bytes += double(s.srcW * s.srcPixel) * s.srcH / _height;
+            }
+            size_t align = 2;
+            for (size_t i = 0; i < _stages.size(); ++i)
+                align = Max(align, _stages[i]->rowAlign);
+            size_t rows = size_t(Base::AlgCacheL2() / 2 / Max(bytes, 1.0));
+            return Min(Max(AlignLo(rows, align), align * 4), AlignHi(_height, align));
+        }
+
+        void Pipeline::RunStrip(const uint8_t * const * src, const size_t * srcStride, uint8_t * dst, size_t dstStride, size_t beg, size_t end) const
+        {
+            size_t n = _stages.size();
+            Scratch scratch;
+            std::vector<size_t> rows(2 * (n + 1));
+            rows[2 * n + 0] = beg;
+            rows[2 * n + 1] = end;
+            for (size_t i = n; i > 0; --i)
+                _stages[i - 1]->Source(rows[2 * i + 0], rows[2 * i + 1], rows[2 * i - 2], rows[2 * i - 1]);
+
+            const uint8_t * planes[3] = { NULL, NULL, NULL };
+            size_t strides[3] = { 0, 0, 0 };
+            for (size_t p = 0; p < _planes; ++p)
+            {
+                planes[p] = src[p] + (rows[0] >> p) * srcStride[p];
+                strides[p] = srcStride[p];
+            }
+            for (size_t i = 0; i < n; ++i)
+            {
+                const PipelineStage & stage = *_stages[i];
+                size_t oBeg = rows[2 * i + 2], oEnd = rows[2 * i + 3];
+                uint8_t * out;
+                size_t outStride;
+                if (i + 1 == n)
+                {
+                    out = stage.DstRow(dst, dstStride, oBeg);
+                    outStride = dstStride;
+                }
+                else
+                {
+                    outStride = PipelineStride(stage.dstW, stage.dstPixel);
+                    out = scratch.Allocate<uint8_t>(outStride * (oEnd - oBeg));
+                }
+                stage.Run(planes, strides, rows[2 * i + 0], rows[2 * i + 1], out, outStride, oBeg, oEnd);
+                planes[0] = out;
+                strides[0] = outStride;
+            }
+        }
+
+        void Pipeline::Run(const uint8_t * const * src, const size_t * srcStride, uint8_t * dst, size_t dstStride) const
+        {
+            if (_stages.empty())
+                return;
+            size_t height = _height, strip = StripRows(), strips = DivHi(height, strip);
+            size_t threads = Min(Base::GetThreadNumber(), strips);
+            Simd::Parallel(0, strips, [&](size_t thread, size_t begin, size_t end)
+            {
+                ThreadBudgetScope serial(&_serial);
+                for (size_t s = begin; s < end; ++s)
+                    RunStrip(src, srcStride, dst, dstStride, s * strip, Min(s * strip + strip, height));
+            }, threads);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void * PipelineInit(size_t width, size_t height, SimdPixelFormatType format)
+        {
+            if (width == 0 || height == 0 || PipelinePixelSize(format) == 0)
+                return NULL;
+            if (format == SimdPixelFormatUv16 && ((width | height) & 1))
+                return NULL;
+            return new Pipeline(width, height, format);
+        }
+    }
+}
@@ -35,11 +35,68 @@ namespace Simd
     Base::PerformanceMeasurer * SynetConvolution32f::Perf(const char* func)
     {
         if (_perf == NULL)
-            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop(), Param().Bytes());
         return _perf;
     }
 #endif
 
+    size_t SynetConvolution32f::Export(void * data, size_t size) const
+    {
+        const ConvParam32f & p = _param;
+        SynetPackedBlocks blocks;
+        Packed(blocks);
+        if (blocks.empty())
+            return 0;
+        return Base::SynetPackedExport(Base::SynetPackedTag(p, p.batch, p.compatibility, Desc(), PackedTag()), blocks, data, size);
+    }
+
+    bool SynetConvolution32f::Import(const void * data, size_t size, const float * weight, SimdBool * internal, const float * bias, const float * params)
+    {
+        const ConvParam32f & p = _param;
+        if (Base::SynetPackedMatch(Base::SynetPackedTag(p, p.batch, p.compatibility, Desc(), PackedTag()), data, size))
+        {
+            _packedImport = true;
+            SetParams(weight, internal, bias, params);
+            _packedImport = false;
+            SynetPackedBlocks blocks;
+            Packed(blocks);
+            if (blocks.size() && Base::SynetPackedImport(data, size, blocks))
+                return true;
+        }
+        if (weight)
+            SetParams(weight, internal, bias, params);
+        return false;
+    }
+
+    bool SynetConvolution32f::ForwardAdd(const float * src, float * buf, float * dst)
+    {
+        const ConvParam32f & p = _param;
+        if (p.activation != ::SimdConvolutionActivationIdentity)
+            return false;
+        size_t size = p.batch * p.dstC * p.dstH * p.dstW;
+        Scratch scratch;
+        float * sum = scratch.Allocate<float>(size);
+        Forward(src, buf, sum);
+        for (size_t i = 0; i < size; ++i)
+            dst[i] += sum[i];
+        return true;
+    }
+
+    String SynetConvolution32f::PackedTag() const
+    {
+        std::stringstream ss;
+        ss << Base::AlgCacheL1() << "-" << Base::AlgCacheL2() << "-" << Base::AlgCacheL3();
+        if (_gemmCb.Size())
+            ss << "-" << _gemmCb.At(0).Name();
+        return ss.str();
+    }
+
+    void SynetConvolution32f::Packed(SynetPackedBlocks & blocks) const
+    {
+        if (_nhwcWeight.data)
+            blocks.push_back(SynetPackedBlock(_nhwcWeight.data, _nhwcWeight.RawSize()));
+    }
+
     namespace Base
     {
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst)
@@ -361,20 +418,37 @@ namespace Simd
             Simd::SynetConvolution32f::SetParams(weight, internal, bias, params);
             if (_nhwcWeight.data)
             {
-                if (_gemmCb.Size())
-                    _gemmCb.At(0).ReorderB(_M*_merge, _N, _K, weight, _nhwcWeight.data);
-                else
-                    _nhwcReorderB(_M*_merge, _N, _K, weight, _nhwcWeight.data, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+                if (!_packedImport)
+                {
+                    if (_gemmCb.Size())
+                        _gemmCb.At(0).ReorderB(_M*_merge, _N, _K, weight, _nhwcWeight.data);
+                    else
+                        _nhwcReorderB(_M*_merge, _N, _K, weight, _nhwcWeight.data, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+                }
                 if (internal)
                     *internal = SimdTrue;
             }
         }
 
         void SynetConvolution32fGemmNN::Forward(const float * src, float * buf, float * dst)
+        {
+            Forward(src, buf, dst, &_0);
+        }
+
+        bool SynetConvolution32fGemmNN::ForwardAdd(const float * src, float * buf, float * dst)
+        {
+            if (_nhwcWeight.data)
+                return Simd::SynetConvolution32f::ForwardAdd(src, buf, dst);
+            Forward(src, buf, dst, &_1);
+            return true;
+        }
+
+        void SynetConvolution32fGemmNN::Forward(const float * src, float * buf, float * dst, const float * beta)
         {
             const ConvParam32f & p = _param;
+            Scratch scratch;
             if (!_skipConv)
-                buf = Buffer(buf);
+                buf = Buffer(buf, scratch);
             if (_merge > 1)
             {
                 for (size_t b = 0; b < _batch; b += _merge)
@@ -394,7 +468,7 @@ namespace Simd
                             _nhwcRun(_M*_merge, _N, _K, tmp, _nhwcWeight.data, dst, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
                     }
                     else
-                        _gemm.Run(GemmArgs(_M*_merge, _N, _K, &_1, tmp, _ldS, _weight, _ldW, &_0, dst, _ldD));
+                        _gemm.Run(GemmArgs(_M*_merge, _N, _K, &_1, tmp, _ldS, _weight, _ldW, beta, dst, _ldD));
                     for (size_t m = 0; m < _merge; ++m)
                         _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst + m * _sizeD);
                     src += _sizeS * _merge;
@@ -426,10 +500,10 @@ namespace Simd
                                     _nhwcRun(_M, _N, _K, tmp, _nhwcWeight.data, dst, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
                             }
                             else
-                                _gemm.Run(GemmArgs(_M, _N, _K, &_1, tmp + _grS * g, _ldS, _weight + _grW * g, _ldW, &_0, dst + _grD * g, _ldD));
+                                _gemm.Run(GemmArgs(_M, _N, _K, &_1, tmp + _grS * g, _ldS, _weight + _grW * g, _ldW, beta, dst + _grD * g, _ldD));
                         }
                         else
-                            _gemm.Run(GemmArgs(_M, _N, _K, &_1, _weight + _grW * g, _ldW, tmp + _grS * g, _ldS, &_0, dst + _grD * g, _ldD));
+                            _gemm.Run(GemmArgs(_M, _N, _K, &_1, _weight + _grW * g, _ldW, tmp + _grS * g, _ldS, beta, dst + _grD * g, _ldD));
                     }
                     _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst);
                     src += _sizeS;
@@ -617,8 +691,9 @@ namespace Simd
         void SynetConvolution32fGemmNT::Forward(const float * src, float * buf, float * dst)
         {
             const ConvParam32f& p = _param;
+            Scratch scratch;
             if (p.trans == 0)
-                buf = Buffer(buf);
+                buf = Buffer(buf, scratch);
             for (size_t b = 0; b < _batch; ++b)
             {
                 if (p.trans)
@@ -823,27 +898,45 @@ namespace Simd
         void SynetConvolution32fWinograd::SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
         {
             Simd::SynetConvolution32f::SetParams(weight, internal, bias, params);
-            _winogradWeight.Resize(_strideW*_count);
-            _setFilter(weight, _param.srcC*_param.dstC, _winogradWeight.data, _param.trans);
-            if (_nhwcWeight.data)
+            if (_packedImport)
+                _winogradWeight.Resize(_nhwcWeight.data ? 0 : _strideW * _count);
+            else
             {
-                for (size_t i = 0; i < _count; ++i)
+                _winogradWeight.Resize(_strideW * _count);
+                _setFilter(weight, _param.srcC * _param.dstC, _winogradWeight.data, _param.trans);
+                if (_nhwcWeight.data)
                 {
-                    if (_gemmCb.Size())
-                        _gemmCb.At(0).ReorderB(_M * _merge, _N, _K, _winogradWeight.data + i * _strideW, _nhwcWeight.data + i * _nhwcStrideW);
-                    else
-                        _nhwcReorderB(_M * _merge, _N, _K, _winogradWeight.data + i * _strideW, _nhwcWeight.data + i * _nhwcStrideW, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+                    for (size_t i = 0; i < _count; ++i)
+                    {
+                        if (_gemmCb.Size())
+                            _gemmCb.At(0).ReorderB(_M * _merge, _N, _K, _winogradWeight.data + i * _strideW, _nhwcWeight.data + i * _nhwcStrideW);
+                        else
+                            _nhwcReorderB(_M * _merge, _N, _K, _winogradWeight.data + i * _strideW, _nhwcWeight.data + i * _nhwcStrideW, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+                    }
+                    _winogradWeight.Resize(0);
                 }
-                _winogradWeight.Resize(0);
             }
             if (internal)
                 *internal = SimdTrue;
         }
+
+        String SynetConvolution32fWinograd::PackedTag() const
+        {
+            return Simd::SynetConvolution32f::PackedTag() + "-" + ToStr(_blockY) + "x" + ToStr(_blockX);
+        }
+
+        void SynetConvolution32fWinograd::Packed(SynetPackedBlocks & blocks) const
+        {
+            Simd::SynetConvolution32f::Packed(blocks);
+            if (_winogradWeight.data)
+                blocks.push_back(SynetPackedBlock(_winogradWeight.data, _winogradWeight.RawSize()));
+        }
         
         void SynetConvolution32fWinograd::Forward(const float * src, float * buf, float * dst)
         {
             const ConvParam32f & p = _param;
-            float * bufS = Buffer(buf);
+            Scratch scratch;
+            float * bufS = Buffer(buf, scratch);
             float * bufD = bufS + _strideS * _count * _merge;
             if (p.trans)
             {
@@ -1047,8 +1140,9 @@ namespace Simd
         void SynetConvolution32fDirectNchw::Forward(const float * src, float * buf, float * dst)
         {
             const ConvParam32f & p = _param;
+            Scratch scratch;
             if(_pad)
-                buf = Buffer(buf);
+                buf = Buffer(buf, scratch);
             for (size_t b = 0; b < p.batch; ++b)
             {
                 const float * weight = _weight;
@@ -1276,12 +1370,11 @@ namespace Simd
 
         void SynetConvolution32fDirectNhwc::Forward(const float * src, float * buf, float * dst)
         {
-            for (size_t b = 0; b < _batch; ++b)
+            SynetParallel(_batch, 1, double(_param.Flop()), [&](size_t, size_t batchBeg, size_t batchEnd)
             {
-                _convolutionBiasActivation(src, _param, _weight, _bias, _params, dst);
-                src += _sizeS;
-                dst += _sizeD;
-            }
+                for (size_t b = batchBeg; b < batchEnd; ++b)
+                    _convolutionBiasActivation(src + b * _sizeS, _param, _weight, _bias, _params, dst + b * _sizeD);
+            });
         }
 
         bool SynetConvolution32fDirectNhwc::Preferable(const ConvParam32f & p)
@@ -1381,16 +1474,19 @@ namespace Simd
         {
             for (size_t b = 0; b < _batch; ++b)
             {
-                if (_bias)
-                {
-                    for (size_t i = 0; i < _count; ++i)
-                        dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size) + _bias[i];
-                }
-                else
+                SynetParallel(_count, 1, 2.0 * _count * _size, [&](size_t, size_t beg, size_t end)
                 {
-                    for (size_t i = 0; i < _count; ++i)
-                        dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size);
-                }
+                    if (_bias)
+                    {
+                        for (size_t i = beg; i < end; ++i)
+                            dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size) + _bias[i];
+                    }
+                    else
+                    {
+                        for (size_t i = beg; i < end; ++i)
+                            dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size);
+                    }
+                });
                 if (_param.activation)
                     ConvolutionBiasAndActivation(NULL, _count, 1, _param.activation, _params, ::SimdFalse, dst);                
                 src += _sizeS;
@@ -1427,7 +1523,7 @@ namespace Simd
 
         size_t SynetConvolution32fNhwcDirect::InternalBufferSize() const
         {
-            size_t size = _buffer.size + _rWeight.size + _rBias.size + _rParams.size;
+            size_t size = _rWeight.size + _rBias.size + _rParams.size;
             size += _old.weight.size;
             return size;
         }
@@ -1437,7 +1533,8 @@ namespace Simd
             SynetConvolution32f::SetParams(weight, internal, bias, params);
             if (_old.enable && _old.weight.data)
             {
-                OldReorderWeight(weight, _old.weight.data);
+                if (!_packedImport)
+                    OldReorderWeight(weight, _old.weight.data);
                 _weight = _old.weight.data;
                 if (internal)
                     *internal = SimdTrue;
@@ -1445,7 +1542,8 @@ namespace Simd
             else
             if (_rWeight.data)
             {
-                ReorderWeight(weight, _rWeight.data);
+                if (!_packedImport)
+                    ReorderWeight(weight, _rWeight.data);
                 _weight = _rWeight.data;
                 if (internal)
                     *internal = SimdTrue;
@@ -1513,13 +1611,65 @@ namespace Simd
                 if(_old.enable)
                     _old.convolution(src, _param, _old.alg, _weight, _bias, _params, dst);
                 else
-                _run.Run(RunArgs(src, _param, _weight, _bias, _params, dst));
+                _run.Run(RunArgs(src, _param, _weight, _bias, _params, dst, 0));
                 src += _sizeS;
                 dst += _sizeD;
             }
         }
 
-        void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst)
+        bool SynetConvolution32fNhwcDirect::ForwardAdd(const float * src, float * buf, float * dst)
+        {
+            const ConvParam32f & p = _param;
+            if (_old.enable)
+                return Simd::SynetConvolution32f::ForwardAdd(src, buf, dst);
+            for (size_t b = 0; b < p.batch; ++b)
+            {
+                _run.Run(RunArgs(src, _param, _weight, _bias, _params, dst, 1));
+                src += _sizeS;
+                dst += _sizeD;
+            }
+            return true;
+        }
+
+        String SynetConvolution32fNhwcDirect::PackedTag() const
+        {
+            std::stringstream ss;
+            ss << Simd::SynetConvolution32f::PackedTag();
+            if (_old.enable)
+                ss << "-" << _old.alg.microD << "x" << _old.alg.macroC << "x" << _old.alg.macroD;
+            else if (_run.Size())
+                ss << "-" << _run.At(0).alg.F;
+            return ss.str();
+        }
+
+        void SynetConvolution32fNhwcDirect::Packed(SynetPackedBlocks & blocks) const
+        {
+            if (_old.enable && _old.weight.data)
+                blocks.push_back(SynetPackedBlock(_old.weight.data, _old.weight.RawSize()));
+            else if (_rWeight.data)
+                blocks.push_back(SynetPackedBlock(_rWeight.data, _rWeight.RawSize()));
+        }
+
+        size_t SynetConvolution32fNhwcDirect::Variants() const
+        {
+            return _old.enable ? 1 : Simd::Max<size_t>(_run.Size(), 1);
+        }
+
+        void SynetConvolution32fNhwcDirect::SetVariant(size_t variant)
+        {
+            if (!_old.enable && _run.Size())
+                _run.Select(variant);
+        }
+
+        void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst, int add)
+        {
+            SynetParallel(p.dstH, 1, double(p.Flop()) / p.batch, [&](size_t, size_t dyBeg, size_t dyEnd)
+            {
+                Forward(src, p, a, dyBeg, dyEnd, weight, bias, params, dst, add);
+            });
+        }
+
+        void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam32f& p, const AlgParam& a, size_t dyBeg, size_t dyEnd, const float* weight, const float* bias, const float* params, float* dst, int add)
         {
             for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
             {
@@ -1527,13 +1677,13 @@ namespace Simd
                 for (size_t sc = 0; sc < p.srcC; sc += a.macroC)
                 {
                     size_t macroC = Simd::Min(p.srcC, sc + a.macroC) - sc;
-                    for (size_t yBeg = 0; yBeg < p.dstH;)
+                    for (size_t yBeg = dyBeg; yBeg < dyEnd;)
                     {
-                        size_t yEnd = Simd::Min(yBeg + a.macroH, p.dstH);
+                        size_t yEnd = Simd::Min(yBeg + a.macroH, dyEnd);
                         if (sc + macroC == p.srcC)
-                            a.convolutions[TermLast](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, macroC == p.srcC ? 1 : 0);
+                            a.convolutions[TermLast](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, macroC == p.srcC && !add ? 1 : 0);
                         else
-                            a.convolutions[TermInterim](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, sc == 0 ? 1 : 0);
+                            a.convolutions[TermInterim](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, sc == 0 && !add ? 1 : 0);
                         yBeg = yEnd;
                     }
                     weight += a.F * macroC;
@@ -1658,6 +1808,82 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        static void SynetConvolution32fTuneFill(Array32f & array, float lo, float hi)
+        {
+            uint32_t seed = 0x12345678;
+            for (size_t i = 0; i < array.size; ++i)
+            {
+                seed = seed * 1664525 + 1013904223;
+                array[i] = lo + (hi - lo) * float(seed >> 8) / float(1 << 24);
+            }
+        }
+
+        SynetConvolution32f* SynetConvolution32fTune(const ConvParam32f& p, const SynetConvolution32fCreatePtrs& candidates)
+        {
+            assert(candidates.size());
+            std::vector<SynetConvolution32f*> convs(candidates.size());
+            for (size_t i = 0; i < candidates.size(); ++i)
+                convs[i] = candidates[i](p);
+
+            String key = convs.back()->Ext() + " " + p.Info() + "-" + ToStr(p.activation), value;
+            size_t best = candidates.size(), variant = 0;
+            if (SynetTuningGet(key, value))
+            {
+                size_t tab = value.find('\t');
+                for (size_t i = 0; i < convs.size() && tab != String::npos; ++i)
+                {
+                    if (value.compare(0, tab, convs[i]->Desc()) == 0 && convs[i]->Desc().size() == tab)
+                    {
+                        best = i;
+                        variant = Simd::Min<size_t>(atoi(value.c_str() + tab + 1), convs[i]->Variants() - 1);
+                    }
+                }
+            }
+            if (best == candidates.size())
+            {
+                const size_t TUNE_RUNS = 3;
+                Array32f src(p.SizeS()), dst(p.SizeD()), weight(p.SizeW()), bias(p.dstC), params(Simd::Max<size_t>(p.dstC, 2)), buf;
+                SynetConvolution32fTuneFill(src, -1.0f, 1.0f);
+                SynetConvolution32fTuneFill(weight, -0.1f, 0.1f);
+                SynetConvolution32fTuneFill(bias, -0.1f, 0.1f);
+                SynetConvolution32fTuneFill(params, 0.1f, 0.2f);
+                params[1] = p.activation == SimdConvolutionActivationRestrictRange ? 6.0f : params[1];
+                int64_t min = std::numeric_limits<int64_t>::max();
+                for (size_t i = 0; i < convs.size(); ++i)
+                {
+                    convs[i]->SetParams(weight.data, NULL, bias.data, params.data);
+                    buf.Resize(convs[i]->ExternalBufferSize());
+                    for (size_t v = 0, n = convs[i]->Variants(); v < n; ++v)
+                    {
+                        convs[i]->SetVariant(v);
+                        convs[i]->Forward(src.data, buf.data, dst.data);
+                        int64_t time = std::numeric_limits<int64_t>::max();
+                        for (size_t r = 0; r < TUNE_RUNS; ++r)
+                        {
+                            int64_t start = TimeCounter();
+                            convs[i]->Forward(src.data, buf.data, dst.data);
+                            time = Simd::Min(time, TimeCounter() - start);
+                        }
+                        if (time < min)
+                        {
+                            min = time;
+                            best = i;
+                            variant = v;
+                        }
+                    }
+                }
+                SynetTuningSet(key, convs[best]->Desc() + "\t" + ToStr(variant));
+            }
+            for (size_t i = 0; i < convs.size(); ++i)
+                delete convs[i];
+
+            SynetConvolution32f* conv = candidates[best](p);
+            conv->SetVariant(variant);
+            return conv;
+        }
+
+        //---------------------------------------------------------------------
+
 //#define SIMD_BASE_ONLY_GEMM_NN
 
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility)
@@ -1670,6 +1896,24 @@ namespace Simd
                 return new SynetConvolution32fBf16Gemm(param);
             }
 #if !defined(SIMD_BASE_ONLY_GEMM_NN)
+            else if (SynetTuning())
+            {
+                SynetConvolution32fCreatePtrs candidates;
+                if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+                    candidates.push_back(SynetConvolution32fCreate<SynetConvolution32fDepthwiseDotProduct>);
+                if (SynetConvolution32fWinograd::Preferable(param))
+                    candidates.push_back(SynetConvolution32fCreate<SynetConvolution32fWinograd>);
+                if (SynetConvolution32fGemmNT::Preferable(param))
+                    candidates.push_back(SynetConvolution32fCreate<SynetConvolution32fGemmNT>);
+                if (SynetConvolution32fDirectNchw::Preferable(param))
+                    candidates.push_back(SynetConvolution32fCreate<SynetConvolution32fDirectNchw>);
+                if (SynetConvolution32fNhwcDirect::Preferable(param))
+                    candidates.push_back(SynetConvolution32fCreate<SynetConvolution32fNhwcDirect>);
+                if (SynetConvolution32fDirectNhwc::Preferable(param))
+                    candidates.push_back(SynetConvolution32fCreate<SynetConvolution32fDirectNhwc>);
+                candidates.push_back(SynetConvolution32fCreate<SynetConvolution32fGemmNN>);
+                return SynetConvolution32fTune(param, candidates);
+            }
             else if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
                 return new SynetConvolution32fDepthwiseDotProduct(param);
             else if (SynetConvolution32fWinograd::Preferable(param))
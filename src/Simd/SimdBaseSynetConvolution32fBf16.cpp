@@ -76,15 +76,22 @@ namespace Simd
         void SynetConvolution32fBf16Gemm::SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
         {
             Simd::SynetConvolution32f::SetParams(weight, internal, bias, params);
-            Float32ToBFloat16(weight, _weight.size, _weight.data);
+            if (!_packedImport)
+                Float32ToBFloat16(weight, _weight.size, _weight.data);
             if (internal)
                 *internal = SimdTrue;
         }
 
+        void SynetConvolution32fBf16Gemm::Packed(SynetPackedBlocks & blocks) const
+        {
+            blocks.push_back(SynetPackedBlock(_weight.data, _weight.RawSize()));
+        }
+
         void SynetConvolution32fBf16Gemm::Forward(const float * src, float * buf_, float * dst)
         {
             const ConvParam32f & p = _param;
-            uint16_t * buf = (uint16_t*)Buffer(buf_);
+            Scratch scratch;
+            uint16_t * buf = (uint16_t*)Buffer(buf_, scratch);
             const uint16_t* wgt = _weight.data;
             for (size_t b = 0; b < _batch; ++b)
             {
@@ -292,7 +299,7 @@ namespace Simd
 
         size_t SynetConvolution32fBf16Nhwc::InternalBufferSize() const
         {
-            return _buffer.size + _weight.size / 2 + _bias.size + _params.size;
+            return _weight.size / 2 + _bias.size + _params.size;
         }
 
         void SynetConvolution32fBf16Nhwc::SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params)
@@ -309,6 +316,8 @@ namespace Simd
             const ConvParam32f& p = _param;
             const AlgParam& a = _alg;
             _weight.Resize(p.kernelY * p.kernelX * AlignHi(p.srcC, 2) * AlignHiAny(p.dstC, a.microD));
+            if (_packedImport)
+                return;
             uint16_t * dst = _weight.data;
             for (size_t mad = 0; mad < p.dstC; mad += a.macroD)
             {
@@ -346,6 +355,19 @@ namespace Simd
             }
         }
 
+        String SynetConvolution32fBf16Nhwc::PackedTag() const
+        {
+            std::stringstream ss;
+            ss << Simd::SynetConvolution32f::PackedTag() << "-" << _alg.microD << "x" << _alg.macroC << "x" << _alg.macroD;
+            return ss.str();
+        }
+
+        void SynetConvolution32fBf16Nhwc::Packed(SynetPackedBlocks & blocks) const
+        {
+            if (_weight.data)
+                blocks.push_back(SynetPackedBlock(_weight.data, _weight.RawSize()));
+        }
+
         void SynetConvolution32fBf16Nhwc::SetBias(const float* bias)
         {
             const ConvParam32f& p = _param;
@@ -411,13 +433,29 @@ namespace Simd
         {
             const ConvParam32f& p = _param;
             const AlgParam& a = _alg;
-            buf = Buffer(buf);
+            Scratch scratch;
+            buf = Buffer(buf, scratch);
             for (size_t b = 0; b < p.batch; b += a.batch)
             {
-                if(a.mode)
-                    ForwardGemm(src, (uint16_t*)buf, dst);
+                if (p.dstC <= a.macroD && a.batch == 1)
+                {
+                    SynetParallel(p.dstH, 1, double(p.Flop()) / p.batch, [&](size_t stripe, size_t dyBeg, size_t dyEnd)
+                    {
+                        Scratch local;
+                        uint16_t* stripeBuf = (uint16_t*)(stripe ? Buffer(NULL, local) : buf);
+                        if (a.mode)
+                            ForwardGemm(src, stripeBuf, dst, dyBeg, dyEnd);
+                        else
+                            ForwardConv(src, stripeBuf, dst, dyBeg, dyEnd);
+                    });
+                }
                 else
-                    ForwardConv(src, (uint16_t*)buf, dst);
+                {
+                    if (a.mode)
+                        ForwardGemm(src, (uint16_t*)buf, dst, 0, p.dstH * a.batch);
+                    else
+                        ForwardConv(src, (uint16_t*)buf, dst, 0, p.dstH);
+                }
                 src += p.srcH * p.srcW * p.srcC * a.batch;
                 dst += p.dstH * p.dstW * p.dstC * a.batch;
             }
@@ -428,7 +466,7 @@ namespace Simd
             return p.trans != 0 && p.group == 1;
         }
 
-        void SynetConvolution32fBf16Nhwc::ForwardConv(const float* src, uint16_t* buf, float* dst)
+        void SynetConvolution32fBf16Nhwc::ForwardConv(const float* src, uint16_t* buf, float* dst, size_t dyBeg, size_t dyEnd)
         {
             const ConvParam32f& p = _param;
             const AlgParam& a = _alg;
@@ -440,9 +478,9 @@ namespace Simd
                 for (size_t sc = 0; sc < p.srcC; sc += a.macroC)
                 {
                     size_t macroC = Simd::Min(p.srcC, sc + a.macroC) - sc;
-                    for (size_t yBeg = 0; yBeg < p.dstH;)
+                    for (size_t yBeg = dyBeg; yBeg < dyEnd;)
                     {
-                        size_t yEnd = Simd::Min(yBeg + a.macroH, p.dstH);
+                        size_t yEnd = Simd::Min(yBeg + a.macroH, dyEnd);
                         size_t offs = Offset(yBeg, sc, sc + macroC);
                         if (dc == 0)
                             _convert(src + sc, p, yBeg, yEnd, macroC, buf + offs);
@@ -463,13 +501,12 @@ namespace Simd
             }
         }
 
-        void SynetConvolution32fBf16Nhwc::ForwardGemm(const float* src, uint16_t* buf, float* dst)
+        void SynetConvolution32fBf16Nhwc::ForwardGemm(const float* src, uint16_t* buf, float* dst, size_t dyBeg, size_t dyEnd)
         {
             const ConvParam32f& p = _param;
             const AlgParam& a = _alg;
             const uint16_t* weight = _weight.data;
             const float* bias = _bias.data, * params = _params.data;
-            size_t dstH = p.dstH * a.batch;
             for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
             {
                 size_t macroD = Simd::Min(p.dstC, dc + a.macroD) - dc;
@@ -477,9 +514,9 @@ namespace Simd
                 {
                     size_t macroC = Simd::Min(p.srcC, sc + a.macroC) - sc;
                     size_t macroK = macroC * p.kernelY * p.kernelX;
-                    for (size_t yBeg = 0; yBeg < dstH;)
+                    for (size_t yBeg = dyBeg; yBeg < dyEnd;)
                     {
-                        size_t yEnd = Simd::Min(yBeg + a.macroH, dstH);
+                        size_t yEnd = Simd::Min(yBeg + a.macroH, dyEnd);
                         size_t offs = Offset(yBeg, sc, sc + macroC);
                         if (dc == 0)
                         {
@@ -76,6 +76,7 @@ namespace Simd
         _merge = 1;
         _src8u = p.srcT == SimdTensorData8u;
         _dst8u = p.dstT == SimdTensorData8u;
+        _packedImport = false;
         _weight.Resize(p.kernelY * p.kernelX * p.srcC / p.group * p.dstC);
         _norm.Resize(p.dstC);
         _bias.Resize(p.dstC);
@@ -92,7 +93,7 @@ namespace Simd
 
     size_t SynetConvolution8i::InternalBufferSize() const
     {
-        return (_buffer.size + _weight.size) * sizeof(uint8_t) + _srcCvt.Size() + 
+        return _weight.size * sizeof(uint8_t) + _srcCvt.Size() + 
             _dstCvt.Size() + (_norm.size + _bias.size + _params.size) * sizeof(float);
     }
 
@@ -112,7 +113,7 @@ namespace Simd
         float* pNorm = _norm.data;
         float* pBias = _bias.data;
         bool avoidOverflow = _srcCvt.neg && Base::Overflow(p.compatibility);
-        for (size_t g = 0; g < G; ++g)
+        for (size_t g = 0; g < G && !_packedImport; ++g)
         {
             for (size_t d = 0; d < D; ++d)
             {
@@ -237,13 +238,55 @@ namespace Simd
         }
     }
 
-    void SynetConvolution8i::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+    size_t SynetConvolution8i::Export(void* data, size_t size) const
     {
-        if (buf == NULL)
+        const ConvParam8i& p = _param;
+        SynetPackedBlocks blocks;
+        Packed(blocks);
+        return Base::SynetPackedExport(Base::SynetPackedTag(p, p.batch, p.compatibility, Desc(), PackedTag()), blocks, data, size);
+    }
+
+    bool SynetConvolution8i::Import(const void* data, size_t size, const float* weight, const float* bias, const float* params, const float* const* stats)
+    {
+        const ConvParam8i& p = _param;
+        _srcCvt.Init(stats[0], stats[1], p.srcC, p.compatibility);
+        if (Base::SynetPackedMatch(Base::SynetPackedTag(p, p.batch, p.compatibility, Desc(), PackedTag()), data, size))
         {
-            _buffer.Resize(ExternalBufferSize());
-            buf = _buffer.data;
+            _packedImport = true;
+            SetParams(weight, bias, params, stats);
+            _packedImport = false;
+            SynetPackedBlocks blocks;
+            Packed(blocks);
+            if (Base::SynetPackedImport(data, size, blocks))
+                return true;
         }
+        if (weight)
+            SetParams(weight, bias, params, stats);
+        return false;
+    }
+
+    String SynetConvolution8i::PackedTag() const
+    {
+        const CvtParam& s = _srcCvt;
+        uint64_t hash = Base::SynetPackedHash(s.scale.data, s.scale.RawSize());
+        hash = Base::SynetPackedHash(s.shift.data, s.shift.RawSize(), hash);
+        std::stringstream ss;
+        ss << Base::AlgCacheL1() << "-" << Base::AlgCacheL2() << "-" << Base::AlgCacheL3() << "-" << std::hex << hash;
+        return ss.str();
+    }
+
+    void SynetConvolution8i::Packed(SynetPackedBlocks& blocks) const
+    {
+        blocks.push_back(SynetPackedBlock(_weight.data, _weight.RawSize()));
+        blocks.push_back(SynetPackedBlock(_norm.data, _norm.RawSize()));
+        blocks.push_back(SynetPackedBlock(_bias.data, _bias.RawSize()));
+    }
+
+    void SynetConvolution8i::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+    {
+        Scratch scratch;
+        if (buf == NULL)
+            buf = scratch.Allocate<uint8_t>(ExternalBufferSize());
         const ConvParam8i& p = _param;
         uint8_t* src8u = _src8u ? NULL : Allocate<uint8_t>(buf, _sizeS * _merge);
         for (size_t b = 0; b < p.batch; b += _merge)
@@ -258,7 +301,7 @@ namespace Simd
     Base::PerformanceMeasurer * SynetConvolution8i::Perf(const char* func)
     {
         if (_perf == NULL)
-            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop(), Param().Bytes());
         return _perf;
     }
 #endif
@@ -432,6 +475,11 @@ namespace Simd
             return false;
         }
 
+        String SynetConvolution8iNhwcDirect::PackedTag() const
+        {
+            return SynetConvolution8i::PackedTag() + "-" + ToStr(_alg.F);
+        }
+
         bool SynetConvolution8iNhwcDirect::PadEnable(size_t microC)
         {
             const ConvParam8i& p = _param;
@@ -477,7 +525,7 @@ namespace Simd
             size_t C = DivHi(p.srcC, 4), D = DivHi(p.dstC, _alg.F);
             Array8i weight(p.kernelY * p.kernelX * C * D * _alg.F * 4);
             int8_t* dst = weight.data;
-            for (size_t d = 0; d < D; d++)
+            for (size_t d = 0; d < D && !_packedImport; d++)
             {
                 for (size_t ky = 0; ky < p.kernelY; ++ky)
                 {
@@ -537,6 +585,14 @@ namespace Simd
         }
 
         void SynetConvolution8iNhwcDirect::Forward8u(const uint8_t* src, const ConvParam8i& p, int32_t* buf, uint8_t* dst)
+        {
+            SynetParallel(p.dstH, 1, 2.0 * p.kernelY * p.kernelX * p.srcC * _sizeD, [&](size_t, size_t dyBeg, size_t dyEnd)
+            {
+                Forward8u(src, p, dyBeg, dyEnd, buf, dst);
+            });
+        }
+
+        void SynetConvolution8iNhwcDirect::Forward8u(const uint8_t* src, const ConvParam8i& p, size_t dyBeg, size_t dyEnd, int32_t* buf, uint8_t* dst)
         {
             const int8_t* weight = _weight.data;
             const float* norm = _norm.data;
@@ -550,9 +606,9 @@ namespace Simd
                 for (size_t sc = 0; sc < p.srcC; sc += _alg.macroC)
                 {
                     size_t macroC = Simd::Min(p.srcC, sc + _alg.macroC) - sc;
-                    for (size_t yBeg = 0; yBeg < p.dstH;)
+                    for (size_t yBeg = dyBeg; yBeg < dyEnd;)
                     {
-                        size_t yEnd = Simd::Min(yBeg + _alg.macroH, p.dstH);
+                        size_t yEnd = Simd::Min(yBeg + _alg.macroH, dyEnd);
                         if (sc + macroC == p.srcC)
                         {
                             int first = macroC == p.srcC ? 1 : 0;
@@ -615,12 +671,12 @@ namespace Simd
             const float* params = _params.data;
             const float* scale = _dstCvt.scale.data;
             const float* shift = _dstCvt.shift.data;
-            for (size_t m = 0; m < _merge; ++m)
+            const ConvParam8i& p = _param;
+            SynetParallel(p.dstH, 1, 2.0 * p.kernelY * p.kernelX * _sizeD * _merge, [&](size_t, size_t dyBeg, size_t dyEnd)
             {
-                _convolution(src, _param, _alg, weight, norm, bias, params, scale, shift, dst);
-                src += _sizeS;
-                dst += _sizeD * _alg.size;
-            }
+                for (size_t m = 0; m < _merge; ++m)
+                    _convolution(src + m * _sizeS, p, _alg, dyBeg, dyEnd, weight, norm, bias, params, scale, shift, dst + m * _sizeD * _alg.size);
+            });
         }
 
         //---------------------------------------------------------------------
@@ -35,7 +35,7 @@ namespace Simd
     Base::PerformanceMeasurer * SynetDeconvolution32f::Perf(const String& func)
     {
         if (_perf == NULL)
-            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop(), Param().Bytes());
         return _perf;
     }
 #endif
@@ -132,8 +132,9 @@ namespace Simd
         void SynetDeconvolution32fGemmNN::Forward(const float * src, float * buf, float * dst)
         {
             const DeconvParam32f & p = _param;
+            Scratch scratch;
             if (!_is1x1)
-                buf = Buffer(buf);
+                buf = Buffer(buf, scratch);
             if (_merge > 1)
             {
                 for (size_t b = 0; b < _batch; b += _merge)
@@ -347,7 +348,7 @@ namespace Simd
 
         size_t SynetDeconvolution32fNhwcDirect2x2::InternalBufferSize() const
         {
-            return _buffer.size + _rWeight.size + _rBias.size + _rParams.size;
+            return _rWeight.size + _rBias.size + _rParams.size;
         }
 
         void SynetDeconvolution32fNhwcDirect2x2::SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
@@ -34,7 +34,7 @@ namespace Simd
     Base::PerformanceMeasurer * SynetInnerProduct32f::Perf(const String& func)
     {
         if (_perf == NULL)
-            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop(), Param().Bytes());
         return _perf;
     }
 #endif
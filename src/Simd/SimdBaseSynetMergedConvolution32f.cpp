@@ -150,7 +150,7 @@ namespace Simd
 
         size_t SynetMergedConvolution32f::InternalBufferSize() const
         {
-            size_t size = _buffer.size;
+            size_t size = 0;
             for (size_t i = 0; i < _param.count; ++i)
                 size += _rWeight[i].size + _rBias[i].size + _rParams[i].size;
             return size;
@@ -242,7 +242,8 @@ namespace Simd
         void SynetMergedConvolution32f::Forward(const float* src, float* buf, float* dst)
         {
             const MergConvParam32f& p = _param;
-            float* buf0 = Buffer(buf);
+            Scratch scratch;
+            float* buf0 = Buffer(buf, scratch);
             float* buf1 = buf0 + _sizeB[0];
             for (size_t b = 0; b < p.conv[0].batch; ++b)
             {
@@ -373,35 +374,43 @@ namespace Simd
                 return;
             }
             const MergConvParam32f & p = _param;
-            float * buf0 = Buffer(buf);
-            float * buf1 = buf0 + _sizeB[0];
-            for (size_t b = 0; b < p.conv[0].batch; ++b)
+            Scratch scratch;
+            buf = Buffer(buf, scratch);
+            SynetParallel(p.conv[1].dstH, 1, Flop(), [&](size_t stripe, size_t dyBeg, size_t dyEnd)
             {
-                for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
+                Scratch local;
+                float * buf0 = stripe ? Buffer(NULL, local) : buf;
+                float * buf1 = buf0 + _sizeB[0];
+                const float * s = src;
+                float * d = dst;
+                for (size_t b = 0; b < p.conv[0].batch; ++b)
                 {
-                    size_t maC = Simd::Min(C, c + _maC) - c;
-                    for (size_t yBeg1 = 0, yBeg0 = 0; yBeg1 < p.conv[1].dstH;)
+                    for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
                     {
-                        size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], p.conv[1].dstH);
-                        size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], (_yStep[1] - 1)*p.conv[1].strideY + p.conv[1].kernelY - p.conv[1].padY), p.conv[0].dstH);
-                        _convolution[0](src, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
-                        _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], buf1, 1);
-                        if (p.add && c == 0)
+                        size_t maC = Simd::Min(C, c + _maC) - c;
+                        for (size_t yBeg1 = dyBeg, yBeg0 = SynetSrcRowBeg(p.conv[1], dyBeg); yBeg1 < dyEnd;)
                         {
-                            size_t offset = yBeg1 * p.conv[2].dstW * p.conv[2].dstC, size = (yEnd1 - yBeg1)*p.conv[2].dstW * p.conv[2].dstC;
-                            memcpy(dst + offset, src + offset, sizeof(float)*size);
+                            size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], dyEnd);
+                            size_t yEnd0 = SynetSrcRowEnd(p.conv[1], yEnd1);
+                            _convolution[0](s, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
+                            _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], buf1, 1);
+                            if (p.add && c == 0)
+                            {
+                                size_t offset = yBeg1 * p.conv[2].dstW * p.conv[2].dstC, size = (yEnd1 - yBeg1)*p.conv[2].dstW * p.conv[2].dstC;
+                                memcpy(d + offset, s + offset, sizeof(float)*size);
+                            }
+                            if(c + maC == C)
+                                _convolution[2](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], d, (maC != C || p.add) ? 0 : 1);
+                            else
+                                _convolution[3](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], d, (c != 0 || p.add) ? 0 : 1);
+                            yBeg1 = yEnd1;
+                            yBeg0 = yEnd0;
                         }
-                        if(c + maC == C)
-                            _convolution[2](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst, (maC != C || p.add) ? 0 : 1);
-                        else
-                            _convolution[3](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst, (c != 0 || p.add) ? 0 : 1);
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
                     }
+                    s += _sizeS;
+                    d += _sizeD;
                 }
-                src += _sizeS;
-                dst += _sizeD;
-            }
+            });
         }
 
         bool SynetMergedConvolution32fCdc::Preferable(const MergConvParam32f& p)
@@ -497,25 +506,33 @@ namespace Simd
                 return;
             }
             const MergConvParam32f& p = _param;
-            float* buf0 = Buffer(buf);
-            for (size_t b = 0; b < p.conv[0].batch; ++b)
+            Scratch scratch;
+            buf = Buffer(buf, scratch);
+            SynetParallel(p.conv[1].dstH, 1, Flop(), [&](size_t stripe, size_t dyBeg, size_t dyEnd)
             {
-                for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
+                Scratch local;
+                float* buf0 = stripe ? Buffer(NULL, local) : buf;
+                const float* s = src;
+                float* d = dst;
+                for (size_t b = 0; b < p.conv[0].batch; ++b)
                 {
-                    size_t maC = Simd::Min(C, c + _maC) - c;
-                    for (size_t yBeg1 = 0, yBeg0 = 0; yBeg1 < p.conv[1].dstH;)
+                    for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
                     {
-                        size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], p.conv[1].dstH);
-                        size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], (_yStep[1] - 1) * p.conv[1].strideY + p.conv[1].kernelY - p.conv[1].padY), p.conv[0].dstH);
-                        _convolution[0](src, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
-                        _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], dst + c, 1);
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
+                        size_t maC = Simd::Min(C, c + _maC) - c;
+                        for (size_t yBeg1 = dyBeg, yBeg0 = SynetSrcRowBeg(p.conv[1], dyBeg); yBeg1 < dyEnd;)
+                        {
+                            size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], dyEnd);
+                            size_t yEnd0 = SynetSrcRowEnd(p.conv[1], yEnd1);
+                            _convolution[0](s, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
+                            _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], d + c, 1);
+                            yBeg1 = yEnd1;
+                            yBeg0 = yEnd0;
+                        }
                     }
+                    s += _sizeS;
+                    d += _sizeD;
                 }
-                src += _sizeS;
-                dst += _sizeD;
-            }
+            });
         }
 
         bool SynetMergedConvolution32fCd::Preferable(const MergConvParam32f& p)
@@ -615,26 +632,34 @@ namespace Simd
                 return;
             }
             const MergConvParam32f& p = _param;
-            float* buf0 = Buffer(buf);
-            for (size_t b = 0; b < p.conv[0].batch; ++b)
+            Scratch scratch;
+            buf = Buffer(buf, scratch);
+            SynetParallel(p.conv[0].dstH, 1, Flop(), [&](size_t stripe, size_t dyBeg, size_t dyEnd)
             {
-                for (size_t c = 0, C = p.conv[0].dstC; c < C; c += _maC)
+                Scratch local;
+                float* buf0 = stripe ? Buffer(NULL, local) : buf;
+                const float* s = src;
+                float* d = dst;
+                for (size_t b = 0; b < p.conv[0].batch; ++b)
                 {
-                    size_t maC = Simd::Min(C, c + _maC) - c;
-                    for (size_t yBeg0 = 0; yBeg0 < p.conv[0].dstH;)
+                    for (size_t c = 0, C = p.conv[0].dstC; c < C; c += _maC)
                     {
-                        size_t yEnd0 = Simd::Min(yBeg0 + _yStep[0], p.conv[0].dstH);
-                        _convolution[0](src + c, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
-                        if (c + maC == C)
-                            _convolution[1](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], dst, maC == C ? 1 : 0);
-                        else
-                            _convolution[2](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], dst, c == 0 ? 1 : 0);
-                        yBeg0 = yEnd0;
+                        size_t maC = Simd::Min(C, c + _maC) - c;
+                        for (size_t yBeg0 = dyBeg; yBeg0 < dyEnd;)
+                        {
+                            size_t yEnd0 = Simd::Min(yBeg0 + _yStep[0], dyEnd);
+                            _convolution[0](s + c, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
+                            if (c + maC == C)
+                                _convolution[1](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], d, maC == C ? 1 : 0);
+                            else
+                                _convolution[2](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], d, c == 0 ? 1 : 0);
+                            yBeg0 = yEnd0;
+                        }
                     }
+                    s += _sizeS;
+                    d += _sizeD;
                 }
-                src += _sizeS;
-                dst += _sizeD;
-            }
+            });
         }
 
         bool SynetMergedConvolution32fDc::Preferable(const MergConvParam32f& p)
@@ -214,7 +214,7 @@ namespace Simd
 
         size_t SynetMergedConvolution32fBf16::InternalBufferSize() const
         {
-            size_t size = _buffer.size + _weightD.size;
+            size_t size = _weightD.size;
             size += (_weightI.size + _weightO.size) / 2;
             for (size_t i = 0; i < _param.count; ++i)
                 size += _bias[i].size + _params[i].size;
@@ -407,7 +407,8 @@ namespace Simd
 
         void SynetMergedConvolution32fBf16::Forward(const float* src, float* buf, float* dst)
         {
-            uint8_t* buffer = (uint8_t*)Buffer(buf);
+            Scratch scratch;
+            uint8_t* buffer = (uint8_t*)Buffer(buf, scratch);
             float* buf0 = Allocate<float>(buffer, _sizeB[0]);
             float* buf1 = Allocate<float>(buffer, _sizeB[1]);
             const MergConvParam32f& p = _param;
@@ -453,40 +454,48 @@ namespace Simd
             const ConvParam32f& c2 = p.conv[2];
             const AlgParam& a = _alg;
 
-            uint8_t* buffer = (uint8_t*)Buffer(buf);
-            uint16_t* buf0 = Allocate<uint16_t>(buffer, _sizeB[0]);
-            float* buf1 = Allocate<float>(buffer, _sizeB[1]);
-            uint16_t* buf2 = Allocate<uint16_t>(buffer, _sizeB[2]);
-
-            for (size_t b = 0; b < c0.batch; ++b)
+            Scratch scratch;
+            buf = Buffer(buf, scratch);
+            SynetParallel(c1.dstH, 1, Flop(), [&](size_t stripe, size_t dyBeg, size_t dyEnd)
             {
-                for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
+                Scratch local;
+                uint8_t* buffer = (uint8_t*)(stripe ? Buffer(NULL, local) : buf);
+                uint16_t* buf0 = Allocate<uint16_t>(buffer, _sizeB[0]);
+                float* buf1 = Allocate<float>(buffer, _sizeB[1]);
+                uint16_t* buf2 = Allocate<uint16_t>(buffer, _sizeB[2]);
+                const float* s = src;
+                float* d = dst;
+                for (size_t b = 0; b < c0.batch; ++b)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                    for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
                     {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
-                        size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
-                        _convert(src, c0, yBeg0, yEnd0, buf0, a.bufH[0]);
-                        _input(buf0, c0, a, maC, yBeg1, yEnd1, _weightI.data + c * a.dw[0], 
-                            _bias[0].data + c, _params[0].data + c * a.dp[0], buf1);
-                        _depthwise(buf1, c1, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[1], 
-                            _bias[1].data + c, _params[1].data + c * a.dp[1], buf2);
-                        if (c + maC == C)
-                            _output[0](buf2, c2, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[2], 
-                                _bias[2].data, _params[2].data, dst, (maC != C || p.add) ? 0 : 1);
-                        else
-                            _output[1](buf2, c2, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[2], 
-                                _bias[2].data, _params[2].data, dst, (c != 0 || p.add) ? 0 : 1);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
+                        size_t maC = Simd::Min(C, c + a.maC) - c;
+                        size_t yBeg2 = dyBeg, yBeg1 = SynetSrcRowBeg(c1, yBeg2), yBeg0 = SynetSrcRowBeg(c0, yBeg1);
+                        while (yBeg2 < dyEnd)
+                        {
+                            size_t yEnd2 = Simd::Min(yBeg2 + a.yStep[2], dyEnd);
+                            size_t yEnd1 = SynetSrcRowEnd(c1, yEnd2);
+                            size_t yEnd0 = SynetSrcRowEnd(c0, yEnd1);
+                            _convert(s, c0, yBeg0, yEnd0, buf0, a.bufH[0]);
+                            _input(buf0, c0, a, maC, yBeg1, yEnd1, _weightI.data + c * a.dw[0], 
+                                _bias[0].data + c, _params[0].data + c * a.dp[0], buf1);
+                            _depthwise(buf1, c1, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[1], 
+                                _bias[1].data + c, _params[1].data + c * a.dp[1], buf2);
+                            if (c + maC == C)
+                                _output[0](buf2, c2, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[2], 
+                                    _bias[2].data, _params[2].data, d, (maC != C || p.add) ? 0 : 1);
+                            else
+                                _output[1](buf2, c2, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[2], 
+                                    _bias[2].data, _params[2].data, d, (c != 0 || p.add) ? 0 : 1);
+                            yBeg2 = yEnd2;
+                            yBeg1 = yEnd1;
+                            yBeg0 = yEnd0;
+                        }
                     }
+                    s += _sizeS;
+                    d += _sizeD;
                 }
-                src += _sizeS;
-                dst += _sizeD;
-            }
+            });
         }
 
         bool SynetMergedConvolution32fBf16Cdc::Preferable(const MergConvParam32f& p)
@@ -556,33 +565,41 @@ namespace Simd
             const ConvParam32f& c1 = p.conv[1];
             const AlgParam& a = _alg;
 
-            uint8_t* buffer = (uint8_t*)Buffer(buf);
-            uint16_t* buf0 = Allocate<uint16_t>(buffer, _sizeB[0]);
-            float* buf1 = Allocate<float>(buffer, _sizeB[1]);
-
-            for (size_t b = 0; b < c0.batch; ++b)
+            Scratch scratch;
+            buf = Buffer(buf, scratch);
+            SynetParallel(c1.dstH, 1, Flop(), [&](size_t stripe, size_t dyBeg, size_t dyEnd)
             {
-                for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
+                Scratch local;
+                uint8_t* buffer = (uint8_t*)(stripe ? Buffer(NULL, local) : buf);
+                uint16_t* buf0 = Allocate<uint16_t>(buffer, _sizeB[0]);
+                float* buf1 = Allocate<float>(buffer, _sizeB[1]);
+                const float* s = src;
+                float* d = dst;
+                for (size_t b = 0; b < c0.batch; ++b)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                    for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
                     {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
-                        size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
-                        _convert(src, c0, yBeg0, yEnd0, buf0, a.bufH[0]);
-                        _input(buf0, c0, a, maC, yBeg1, yEnd1, _weightI.data + c * a.dw[0],
-                            _bias[0].data + c, _params[0].data + c * a.dp[0], buf1);
-                        _depthwise(buf1, c1, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[1],
-                            _bias[1].data + c, _params[1].data + c * a.dp[1], (uint16_t*)dst);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
+                        size_t maC = Simd::Min(C, c + a.maC) - c;
+                        size_t yBeg2 = dyBeg, yBeg1 = SynetSrcRowBeg(c1, yBeg2), yBeg0 = SynetSrcRowBeg(c0, yBeg1);
+                        while (yBeg2 < dyEnd)
+                        {
+                            size_t yEnd2 = Simd::Min(yBeg2 + a.yStep[2], dyEnd);
+                            size_t yEnd1 = SynetSrcRowEnd(c1, yEnd2);
+                            size_t yEnd0 = SynetSrcRowEnd(c0, yEnd1);
+                            _convert(s, c0, yBeg0, yEnd0, buf0, a.bufH[0]);
+                            _input(buf0, c0, a, maC, yBeg1, yEnd1, _weightI.data + c * a.dw[0],
+                                _bias[0].data + c, _params[0].data + c * a.dp[0], buf1);
+                            _depthwise(buf1, c1, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[1],
+                                _bias[1].data + c, _params[1].data + c * a.dp[1], (uint16_t*)d);
+                            yBeg2 = yEnd2;
+                            yBeg1 = yEnd1;
+                            yBeg0 = yEnd0;
+                        }
                     }
+                    s += _sizeS;
+                    d += _sizeD;
                 }
-                src += _sizeS;
-                dst += _sizeD;
-            }
+            });
         }
 
         bool SynetMergedConvolution32fBf16Cd::Preferable(const MergConvParam32f& p)
@@ -648,33 +665,38 @@ namespace Simd
             const ConvParam32f& c1 = p.conv[1];
             const AlgParam& a = _alg;
 
-            uint8_t* buffer = (uint8_t*)Buffer(buf);
-            uint16_t* buf2 = Allocate<uint16_t>(buffer, _sizeB[2]);
-
-            for (size_t b = 0; b < c0.batch; ++b)
+            Scratch scratch;
+            buf = Buffer(buf, scratch);
+            SynetParallel(c0.dstH, 1, Flop(), [&](size_t stripe, size_t dyBeg, size_t dyEnd)
             {
-                for (size_t c = 0, C = c0.dstC; c < C; c += a.maC)
+                Scratch local;
+                uint8_t* buffer = (uint8_t*)(stripe ? Buffer(NULL, local) : buf);
+                uint16_t* buf2 = Allocate<uint16_t>(buffer, _sizeB[2]);
+                const float* s = src;
+                float* d = dst;
+                for (size_t b = 0; b < c0.batch; ++b)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                    for (size_t c = 0, C = c0.dstC; c < C; c += a.maC)
                     {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c0.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c0.srcH);
-                        _depthwise(src + c, c0, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[0], _bias[0].data + c,
-                            _params[0].data + c * a.dp[0], buf2);
-                        if (c + maC == C)
-                            _output[0](buf2, c1, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[1],
-                                _bias[1].data, _params[1].data, dst, maC != C ? 0 : 1);
-                        else
-                            _output[1](buf2, c1, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[1],
-                                _bias[1].data, _params[1].data, dst, c != 0 ? 0 : 1);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
+                        size_t maC = Simd::Min(C, c + a.maC) - c;
+                        for (size_t yBeg2 = dyBeg; yBeg2 < dyEnd;)
+                        {
+                            size_t yEnd2 = Simd::Min(yBeg2 + a.yStep[2], dyEnd);
+                            _depthwise(s + c, c0, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[0], _bias[0].data + c,
+                                _params[0].data + c * a.dp[0], buf2);
+                            if (c + maC == C)
+                                _output[0](buf2, c1, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[1],
+                                    _bias[1].data, _params[1].data, d, maC != C ? 0 : 1);
+                            else
+                                _output[1](buf2, c1, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[1],
+                                    _bias[1].data, _params[1].data, d, c != 0 ? 0 : 1);
+                            yBeg2 = yEnd2;
+                        }
                     }
+                    s += _sizeS;
+                    d += _sizeD;
                 }
-                src += _sizeS;
-                dst += _sizeD;
-            }
+            });
         }
 
         bool SynetMergedConvolution32fBf16Dc::Preferable(const MergConvParam32f& p)
@@ -129,7 +129,7 @@ namespace Simd
 
         size_t SynetMergedConvolution8i::InternalBufferSize() const
         {
-            size_t size = _buffer.RawSize() + _weight32f.RawSize();
+            size_t size = _weight32f.RawSize();
             for (size_t i = 0; i < 3; ++i)
             {
                 if (i < 2) 
@@ -228,7 +228,8 @@ namespace Simd
             const ConvParam8i& c1 = p.conv[1];
             const ConvParam8i& c2 = p.conv[2];
 
-            buf = GetBuffer(buf);
+            Scratch scratch;
+            buf = GetBuffer(buf, scratch);
             float* buf0 = Allocate<float>(buf, _sizeB[0]);
             float* buf1 = Allocate<float>(buf, _sizeB[1]);
             uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
@@ -287,20 +288,30 @@ namespace Simd
         Base::PerformanceMeasurer* SynetMergedConvolution8i::Perf(const char* func)
         {
             if (_perf == NULL)
-                _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
+                _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop(), Param().Bytes());
             return _perf;
         }
 #endif
 
-        uint8_t* SynetMergedConvolution8i::GetBuffer(uint8_t* buffer)
+        uint8_t* SynetMergedConvolution8i::GetBuffer(uint8_t* buffer, Scratch& scratch)
         {
-            if (buffer)
-                return buffer;
-            else
+            return buffer ? buffer : scratch.Allocate<uint8_t>(ExternalBufferSize());
+        }
+
+        uint8_t* SynetMergedConvolution8i::GetStripeBuffer(Scratch& scratch)
+        {
+            return scratch.Allocate<uint8_t>((_sizeB[0] + _sizeB[1]) * 4 + _sizeB[2] + _sizeB[3] + SIMD_ALIGN);
+        }
+
+        double SynetMergedConvolution8i::Flop() const
+        {
+            double flop = 0;
+            for (size_t i = 0; i < _param.count; ++i)
             {
-                _buffer.Resize(ExternalBufferSize());
-                return _buffer.data;
+                const ConvParam8i& c = _param.conv[i];
+                flop += 2.0 * c.batch * c.dstC * c.dstH * c.dstW * c.kernelY * c.kernelX * c.srcC / c.group;
             }
+            return flop;
         }
 
         void SynetMergedConvolution8i::Quantize(const float* weight, const float* bias, size_t i, size_t q)
@@ -499,42 +510,50 @@ namespace Simd
             const ConvParam8i& c2 = p.conv[2];
             const AlgParam& a = _alg;
 
-            buf = GetBuffer(buf);
-            float* buf0 = Allocate<float>(buf, _sizeB[0]);
-            uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
-            uint8_t* buf3 = Allocate<uint8_t>(buf, _sizeB[3]);
+            Scratch scratch;
+            buf = GetBuffer(buf, scratch);
             int32_t* buf4 = Allocate<int32_t>(buf, _sizeB[4]);
-
-            for (size_t b = 0; b < c0.batch; ++b)
+            SynetParallel(c1.dstH, 1, Flop(), [&](size_t stripe, size_t dyBeg, size_t dyEnd)
             {
-                for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
+                Scratch local;
+                uint8_t* stripeBuf = stripe ? GetStripeBuffer(local) : buf;
+                float* buf0 = Allocate<float>(stripeBuf, _sizeB[0]);
+                uint8_t* buf2 = Allocate<uint8_t>(stripeBuf, _sizeB[2]);
+                uint8_t* buf3 = Allocate<uint8_t>(stripeBuf, _sizeB[3]);
+                const uint8_t* s = src;
+                uint8_t* d = dst;
+                for (size_t b = 0; b < c0.batch; ++b)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                    for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
                     {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
-                        size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
-                        if (!_s8u)
-                            _cvt32fTo8u((float*)src, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
-                        _input(_s8u ? src : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c, 
-                            _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
-                        _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c, 
-                            _params[1].data + c * a.dp[1], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf3);
-                        if (c + maC == C)
-                            _output[0](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data, 
-                                _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, maC == C ? NULL : buf4, dst, maC == C ? 1 : 0);
-                        else
-                            _output[1](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data,
-                                _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, c == 0 ? 1 : 0);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
+                        size_t maC = Simd::Min(C, c + a.maC) - c;
+                        size_t yBeg2 = dyBeg, yBeg1 = SynetSrcRowBeg(c1, yBeg2), yBeg0 = SynetSrcRowBeg(c0, yBeg1);
+                        while (yBeg2 < dyEnd)
+                        {
+                            size_t yEnd2 = Simd::Min(yBeg2 + a.yStep[2], dyEnd);
+                            size_t yEnd1 = SynetSrcRowEnd(c1, yEnd2);
+                            size_t yEnd0 = SynetSrcRowEnd(c0, yEnd1);
+                            if (!_s8u)
+                                _cvt32fTo8u((float*)s, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
+                            _input(_s8u ? s : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c, 
+                                _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
+                            _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c, 
+                                _params[1].data + c * a.dp[1], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf3);
+                            if (c + maC == C)
+                                _output[0](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data, 
+                                    _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, maC == C ? NULL : buf4, d, maC == C ? 1 : 0);
+                            else
+                                _output[1](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data,
+                                    _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, d, c == 0 ? 1 : 0);
+                            yBeg2 = yEnd2;
+                            yBeg1 = yEnd1;
+                            yBeg0 = yEnd0;
+                        }
                     }
+                    s += _sizeS * (_s8u ? 1 : 4);
+                    d += _sizeD * (_d8u ? 1 : 4);
                 }
-                src += _sizeS * (_s8u ? 1 : 4);
-                dst += _sizeD * (_d8u ? 1 : 4);
-            }
+            });
         }
 
         bool SynetMergedConvolution8iCdc::Preferable(const MergConvParam8i& p)
@@ -603,34 +622,42 @@ namespace Simd
             const ConvParam8i& c1 = p.conv[1];
             const AlgParam& a = _alg;
 
-            buf = GetBuffer(buf);
-            float* buf0 = Allocate<float>(buf, _sizeB[0]);
-            uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
-
-            for (size_t b = 0; b < c0.batch; ++b)
+            Scratch scratch;
+            buf = GetBuffer(buf, scratch);
+            SynetParallel(c1.dstH, 1, Flop(), [&](size_t stripe, size_t dyBeg, size_t dyEnd)
             {
-                for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
+                Scratch local;
+                uint8_t* stripeBuf = stripe ? GetStripeBuffer(local) : buf;
+                float* buf0 = Allocate<float>(stripeBuf, _sizeB[0]);
+                uint8_t* buf2 = Allocate<uint8_t>(stripeBuf, _sizeB[2]);
+                const uint8_t* s = src;
+                uint8_t* d = dst;
+                for (size_t b = 0; b < c0.batch; ++b)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                    for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
                     {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
-                        size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
-                        if (!_s8u)
-                            _cvt32fTo8u((float*)src, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
-                        _input(_s8u ? src : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c,
-                            _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
-                        _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c,
-                            _params[1].data + c * a.dp[1], _cvt[2].scale.data + c, _cvt[2].shift.data + c, dst + c);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
+                        size_t maC = Simd::Min(C, c + a.maC) - c;
+                        size_t yBeg2 = dyBeg, yBeg1 = SynetSrcRowBeg(c1, yBeg2), yBeg0 = SynetSrcRowBeg(c0, yBeg1);
+                        while (yBeg2 < dyEnd)
+                        {
+                            size_t yEnd2 = Simd::Min(yBeg2 + a.yStep[2], dyEnd);
+                            size_t yEnd1 = SynetSrcRowEnd(c1, yEnd2);
+                            size_t yEnd0 = SynetSrcRowEnd(c0, yEnd1);
+                            if (!_s8u)
+                                _cvt32fTo8u((float*)s, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
+                            _input(_s8u ? s : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c,
+                                _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
+                            _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c,
+                                _params[1].data + c * a.dp[1], _cvt[2].scale.data + c, _cvt[2].shift.data + c, d + c);
+                            yBeg2 = yEnd2;
+                            yBeg1 = yEnd1;
+                            yBeg0 = yEnd0;
+                        }
                     }
+                    s += _sizeS * (_s8u ? 1 : 4);
+                    d += _sizeD * (_d8u ? 1 : 4);
                 }
-                src += _sizeS * (_s8u ? 1 : 4);
-                dst += _sizeD * (_d8u ? 1 : 4);
-            }
+            });
         }
 
         bool SynetMergedConvolution8iCd::Preferable(const MergConvParam8i& p)
@@ -698,38 +725,46 @@ namespace Simd
             const ConvParam8i& c1 = p.conv[1];
             const AlgParam& a = _alg;
 
-            buf = GetBuffer(buf);
-            float* buf0 = Allocate<float>(buf, _sizeB[0]);
-            uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
+            Scratch scratch;
+            buf = GetBuffer(buf, scratch);
             int32_t* buf4 = Allocate<int32_t>(buf, _sizeB[4]);
-
-            for (size_t b = 0; b < c0.batch; ++b)
+            SynetParallel(c0.dstH, 1, Flop(), [&](size_t stripe, size_t dyBeg, size_t dyEnd)
             {
-                for (size_t c = 0, C = c0.dstC; c < C; c += a.maC)
+                Scratch local;
+                uint8_t* stripeBuf = stripe ? GetStripeBuffer(local) : buf;
+                float* buf0 = Allocate<float>(stripeBuf, _sizeB[0]);
+                uint8_t* buf2 = Allocate<uint8_t>(stripeBuf, _sizeB[2]);
+                const uint8_t* s = src;
+                uint8_t* d = dst;
+                for (size_t b = 0; b < c0.batch; ++b)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c0.dstH;)
+                    for (size_t c = 0, C = c0.dstC; c < C; c += a.maC)
                     {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c0.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c0.srcH);
-                        if (_s8u)
-                            _cvt8uTo32f(src + c, maC, yBeg1, yEnd1, c0.srcW, c0.srcC, _cvt[0].iScale.data + c, 
-                                _cvt[0].iShift.data + c, buf0, a.bufH[1], c0.compatibility);
-                        _depthwise(_s8u ? buf0 : (float*)src + c, c0, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[0], _bias[0].data + c,
-                            _params[0].data + c * a.dp[0], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf2);
-                        if (c + maC == C)
-                            _output[0](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
-                                _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, maC == C ? NULL : buf4, dst, maC == C ? 1 : 0);
-                        else
-                            _output[1](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
-                                _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, c == 0 ? 1 : 0);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
+                        size_t maC = Simd::Min(C, c + a.maC) - c;
+                        size_t yBeg2 = dyBeg, yBeg1 = SynetSrcRowBeg(c0, yBeg2);
+                        while (yBeg2 < dyEnd)
+                        {
+                            size_t yEnd2 = Simd::Min(yBeg2 + a.yStep[2], dyEnd);
+                            size_t yEnd1 = SynetSrcRowEnd(c0, yEnd2);
+                            if (_s8u)
+                                _cvt8uTo32f(s + c, maC, yBeg1, yEnd1, c0.srcW, c0.srcC, _cvt[0].iScale.data + c, 
+                                    _cvt[0].iShift.data + c, buf0, a.bufH[1], c0.compatibility);
+                            _depthwise(_s8u ? buf0 : (float*)s + c, c0, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[0], _bias[0].data + c,
+                                _params[0].data + c * a.dp[0], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf2);
+                            if (c + maC == C)
+                                _output[0](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
+                                    _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, maC == C ? NULL : buf4, d, maC == C ? 1 : 0);
+                            else
+                                _output[1](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
+                                    _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, d, c == 0 ? 1 : 0);
+                            yBeg2 = yEnd2;
+                            yBeg1 = yEnd1;
+                        }
                     }
+                    s += _sizeS * (_s8u ? 1 : 4);
+                    d += _sizeD * (_d8u ? 1 : 4);
                 }
-                src += _sizeS * (_s8u ? 1 : 4);
-                dst += _sizeD * (_d8u ? 1 : 4);
-            }
+            });
         }
 
         bool SynetMergedConvolution8iDc::Preferable(const MergConvParam8i& p)
@@ -0,0 +1,156 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetPacked.h"
+
+#include <sstream>
+
+namespace Simd
+{
+    namespace Base
+    {
+        const uint32_t SYNET_PACKED_MAGIC = 0x4B505953;
+        const uint32_t SYNET_PACKED_VERSION = 1;
+        const size_t SYNET_PACKED_ALIGN = 64;
+
+        SIMD_INLINE size_t SynetPackedAlign(size_t offset)
+        {
+            return (offset + SYNET_PACKED_ALIGN - 1) & ~(SYNET_PACKED_ALIGN - 1);
+        }
+
+        struct SynetPackedHeader
+        {
+            uint32_t magic, version;
+            uint64_t tag, count;
+        };
+
+        static bool SynetPackedLayout(const void * data, size_t size, std::string * tag, std::vector<uint64_t> * sizes, size_t * offset)
+        {
+            const uint8_t * src = (const uint8_t*)data;
+            SynetPackedHeader header;
+            if (data == NULL || size < sizeof(header))
+                return false;
+            memcpy(&header, src, sizeof(header));
+            if (header.magic != SYNET_PACKED_MAGIC || header.version != SYNET_PACKED_VERSION)
+                return false;
+            size_t pos = sizeof(header);
+            if (header.tag > size - pos || header.count > (size - pos - header.tag) / sizeof(uint64_t))
+                return false;
+            if (tag)
+                tag->assign((const char*)src + pos, (size_t)header.tag);
+            pos += (size_t)header.tag;
+            if (sizes)
+            {
+                sizes->resize((size_t)header.count);
+                if (header.count)
+                    memcpy(sizes->data(), src + pos, (size_t)header.count * sizeof(uint64_t));
+            }
+            pos += (size_t)header.count * sizeof(uint64_t);
+            if (offset)
+                *offset = SynetPackedAlign(pos);
+            return true;
+        }
+
+        uint64_t SynetPackedHash(const void * data, size_t size, uint64_t hash)
+        {
+            const uint8_t * src = (const uint8_t*)data;
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash ^= src[i];
+                hash *= 0x100000001b3ULL;
+            }
+            return hash;
+        }
+
+        std::string SynetPackedTag(const SimdConvolutionParameters & c, size_t batch, int compatibility, const std::string & desc, const std::string & blocking)
+        {
+            std::stringstream ss;
+            ss << desc << " " << batch << "x" << c.srcC << "x" << c.srcH << "x" << c.srcW << "-" << c.dstC << "x" << c.dstH << "x" << c.dstW;
+            ss << "-" << c.kernelY << "x" << c.kernelX << "-" << c.dilationY << "x" << c.dilationX << "-" << c.strideY << "x" << c.strideX;
+            ss << "-" << c.padY << "x" << c.padX << "x" << c.padH << "x" << c.padW << "-" << c.group << "-" << int(c.activation);
+            ss << "-" << int(c.srcT) << int(c.srcF) << int(c.dstT) << int(c.dstF) << "-" << compatibility << " " << blocking;
+            return ss.str();
+        }
+
+        size_t SynetPackedExport(const std::string & tag, const SynetPackedBlocks & blocks, void * data, size_t size)
+        {
+            size_t total = SynetPackedAlign(sizeof(SynetPackedHeader) + tag.size() + blocks.size() * sizeof(uint64_t));
+            for (size_t i = 0; i < blocks.size(); ++i)
+                total += SynetPackedAlign(blocks[i].size);
+            if (data == NULL || size < total)
+                return total;
+            uint8_t * dst = (uint8_t*)data;
+            memset(dst, 0, total);
+            SynetPackedHeader header;
+            header.magic = SYNET_PACKED_MAGIC;
+            header.version = SYNET_PACKED_VERSION;
+            header.tag = tag.size();
+            header.count = blocks.size();
+            memcpy(dst, &header, sizeof(header));
+            size_t pos = sizeof(header);
+            memcpy(dst + pos, tag.data(), tag.size());
+            pos += tag.size();
+            for (size_t i = 0; i < blocks.size(); ++i, pos += sizeof(uint64_t))
+            {
+                uint64_t blockSize = blocks[i].size;
+                memcpy(dst + pos, &blockSize, sizeof(blockSize));
+            }
+            pos = SynetPackedAlign(pos);
+            for (size_t i = 0; i < blocks.size(); ++i)
+            {
+                if (blocks[i].size)
+                    memcpy(dst + pos, blocks[i].data, blocks[i].size);
+                pos += SynetPackedAlign(blocks[i].size);
+            }
+            return total;
+        }
+
+        bool SynetPackedMatch(const std::string & tag, const void * data, size_t size)
+        {
+            std::string stored;
+            return SynetPackedLayout(data, size, &stored, NULL, NULL) && stored == tag;
+        }
+
+        bool SynetPackedImport(const void * data, size_t size, const SynetPackedBlocks & blocks)
+        {
+            std::vector<uint64_t> sizes;
+            size_t begin;
+            if (!SynetPackedLayout(data, size, NULL, &sizes, &begin) || sizes.size() != blocks.size())
+                return false;
+            for (size_t i = 0, pos = begin; i < blocks.size(); ++i)
+            {
+                if (sizes[i] != blocks[i].size || pos + blocks[i].size > size)
+                    return false;
+                pos += SynetPackedAlign(blocks[i].size);
+            }
+            size_t pos = begin;
+            for (size_t i = 0; i < blocks.size(); ++i)
+            {
+                if (blocks[i].size)
+                    memcpy(blocks[i].data, (const uint8_t*)data + pos, blocks[i].size);
+                pos += SynetPackedAlign(blocks[i].size);
+            }
+            return true;
+        }
+    }
+}
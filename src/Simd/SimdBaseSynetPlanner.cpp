@@ -0,0 +1,135 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetPlanner.h"
+
+#include <algorithm>
+
+namespace Simd
+{
+    namespace Base
+    {
+        SynetPlanner::SynetPlanner()
+            : _total(0)
+            , _planned(false)
+        {
+        }
+
+        size_t SynetPlanner::AddTensor(size_t size)
+        {
+            _planned = false;
+            _tensors.push_back(Block(size));
+            return _tensors.size() - 1;
+        }
+
+        size_t SynetPlanner::AddLayer(size_t buffer, const size_t * src, size_t srcCount, const size_t * dst, size_t dstCount)
+        {
+            for (size_t i = 0; i < srcCount; ++i)
+                if (src[i] >= _tensors.size())
+                    return SIZE_MAX;
+            for (size_t i = 0; i < dstCount; ++i)
+                if (dst[i] >= _tensors.size())
+                    return SIZE_MAX;
+            size_t layer = _buffers.size();
+            for (size_t i = 0; i < srcCount; ++i)
+            {
+                Block & t = _tensors[src[i]];
+                t.first = Simd::Min(t.first, layer);
+                t.last = layer;
+                t.consumed = true;
+            }
+            for (size_t i = 0; i < dstCount; ++i)
+            {
+                Block & t = _tensors[dst[i]];
+                t.first = Simd::Min(t.first, layer);
+                t.last = Simd::Max(t.last, layer);
+                t.produced = true;
+            }
+            Block b(buffer);
+            b.first = layer;
+            b.last = layer;
+            _buffers.push_back(b);
+            _planned = false;
+            return layer;
+        }
+
+        size_t SynetPlanner::Plan()
+        {
+            if (_planned)
+                return _total;
+            std::vector<Block*> blocks;
+            size_t end = _buffers.size();
+            for (size_t i = 0; i < _tensors.size(); ++i)
+            {
+                Block & t = _tensors[i];
+                if (!t.produced)
+                    t.first = 0;
+                if (!t.consumed)
+                    t.last = end;
+                blocks.push_back(&t);
+            }
+            for (size_t i = 0; i < _buffers.size(); ++i)
+                blocks.push_back(&_buffers[i]);
+            std::stable_sort(blocks.begin(), blocks.end(), [](const Block * a, const Block * b) { return a->size > b->size; });
+
+            std::vector<Block*> placed, overlapped;
+            _total = 0;
+            for (size_t i = 0; i < blocks.size(); ++i)
+            {
+                Block & b = *blocks[i];
+                overlapped.clear();
+                for (size_t j = 0; j < placed.size(); ++j)
+                    if (placed[j]->first <= b.last && b.first <= placed[j]->last)
+                        overlapped.push_back(placed[j]);
+                std::sort(overlapped.begin(), overlapped.end(), [](const Block * a, const Block * b) { return a->offset < b->offset; });
+                size_t offset = 0;
+                for (size_t j = 0; j < overlapped.size(); ++j)
+                {
+                    if (overlapped[j]->offset >= offset + b.size)
+                        break;
+                    offset = Simd::Max(offset, AlignHi(overlapped[j]->offset + overlapped[j]->size, SIMD_ALIGN));
+                }
+                b.offset = offset;
+                if (b.size)
+                {
+                    _total = Simd::Max(_total, AlignHi(offset + b.size, SIMD_ALIGN));
+                    placed.push_back(&b);
+                }
+            }
+            _planned = true;
+            return _total;
+        }
+
+        size_t SynetPlanner::TensorOffset(size_t tensor) const
+        {
+            assert(_planned && tensor < _tensors.size());
+            return _tensors[tensor].offset;
+        }
+
+        size_t SynetPlanner::BufferOffset(size_t layer) const
+        {
+            assert(_planned && layer < _buffers.size());
+            return _buffers[layer].offset;
+        }
+    }
+}
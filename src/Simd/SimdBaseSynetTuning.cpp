@@ -0,0 +1,117 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetTuning.h"
+#include "Simd/SimdCpu.h"
+
+#include <map>
+#include <mutex>
+#include <fstream>
+
+namespace Simd
+{
+    namespace Base
+    {
+        std::atomic<bool> g_synetTuning(false);
+
+        class SynetTuningDatabase
+        {
+        public:
+            static SynetTuningDatabase & Instance()
+            {
+                static SynetTuningDatabase database;
+                return database;
+            }
+
+            void Open(const char * path)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _items.clear();
+                _path = path ? path : "";
+                if (_path.empty())
+                    return;
+                std::ifstream ifs(_path.c_str());
+                for (std::string line; std::getline(ifs, line);)
+                {
+                    size_t model = line.find('\t'), key = line.find('\t', model + 1);
+                    if (model == std::string::npos || key == std::string::npos)
+                        continue;
+                    if (line.compare(0, model, _model) == 0 && model == _model.size())
+                        _items[line.substr(model + 1, key - model - 1)] = line.substr(key + 1);
+                }
+            }
+
+            bool Get(const std::string & key, std::string & value)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                std::map<std::string, std::string>::const_iterator it = _items.find(key);
+                if (it == _items.end())
+                    return false;
+                value = it->second;
+                return true;
+            }
+
+            void Set(const std::string & key, const std::string & value)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _items[key] = value;
+                if (_path.empty())
+                    return;
+                std::ofstream ofs(_path.c_str(), std::ios::app);
+                if (ofs.is_open())
+                    ofs << _model << '\t' << key << '\t' << value << std::endl;
+            }
+
+        private:
+            SynetTuningDatabase()
+                : _model(CpuModel())
+            {
+                for (size_t i = 0; i < _model.size(); ++i)
+                    if (_model[i] == '\t')
+                        _model[i] = ' ';
+            }
+
+            std::mutex _mutex;
+            std::string _model, _path;
+            std::map<std::string, std::string> _items;
+        };
+
+        //-----------------------------------------------------------------------------------------
+
+        void SynetSetTuning(SimdBool enable, const char * path)
+        {
+            SynetTuningDatabase::Instance().Open(enable ? path : NULL);
+            g_synetTuning.store(enable == SimdTrue, std::memory_order_relaxed);
+        }
+
+        bool SynetTuningGet(const std::string & key, std::string & value)
+        {
+            return SynetTuningDatabase::Instance().Get(key, value);
+        }
+
+        void SynetTuningSet(const std::string & key, const std::string & value)
+        {
+            SynetTuningDatabase::Instance().Set(key, value);
+        }
+    }
+}
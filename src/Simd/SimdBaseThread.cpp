@@ -1,7 +1,7 @@
 /*
 * Simd Library (http://ermig1979.github.io/Simd).
 *
-* Copyright (c) 2011-2018 Yermalayeu Ihar.
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
 *
 * Permission is hereby granted, free of charge, to any person obtaining a copy
 * of this software and associated documentation files (the "Software"), to deal
@@ -22,24 +22,743 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMath.h"
+#include "Simd/SimdMemory.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdCpu.h"
 
 #include <thread>
+#include <vector>
+#include <deque>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <cstdlib>
+#include <condition_variable>
+
+#if defined(_MSC_VER)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <sched.h>
+#endif
 
 namespace Simd
 {
     namespace Base
     {
+        thread_local const ThreadBudget * s_budget = NULL;
+
+        static void BindCurrentThread(const std::vector<size_t> & cpus)
+        {
+#if defined(_MSC_VER)
+            DWORD_PTR mask = 0;
+            for (size_t i = 0; i < cpus.size(); ++i)
+                if (cpus[i] < sizeof(DWORD_PTR) * 8)
+                    mask |= DWORD_PTR(1) << cpus[i];
+            if (mask)
+                ::SetThreadAffinityMask(::GetCurrentThread(), mask);
+#elif defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (size_t i = 0; i < cpus.size(); ++i)
+                if (cpus[i] < CPU_SETSIZE)
+                    CPU_SET(cpus[i], &set);
+            if (CPU_COUNT(&set))
+                ::sched_setaffinity(0, sizeof(set), &set);
+#endif
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        struct ParallelJob
+        {
+            SimdParallelTaskPtr task;
+            void * context;
+            const ThreadBudget * budget;
+            std::atomic<size_t> pending;
+            std::atomic<bool> failed;
+            std::exception_ptr error;
+
+            ParallelJob(SimdParallelTaskPtr t, void * c)
+                : task(t)
+                , context(c)
+                , budget(s_budget)
+                , pending(0)
+                , failed(false)
+            {
+            }
+
+            void Run(size_t thread, size_t begin, size_t end)
+            {
+                const ThreadBudget * previous = s_budget;
+                s_budget = budget;
+                try
+                {
+                    task(context, thread, begin, end);
+                }
+                catch (...)
+                {
+                    if (!failed.exchange(true))
+                        error = std::current_exception();
+                }
+                s_budget = previous;
+            }
+        };
+
+        struct ParallelTask
+        {
+            ParallelJob * job;
+            size_t thread, begin, end;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ThreadPool
+        {
+        public:
+            typedef ParallelTask Task;
+
+            static ThreadPool & Global()
+            {
+                static ThreadPool * pool = &Get(std::vector<size_t>());
+                return *pool;
+            }
+
+            static ThreadPool & Get(const std::vector<size_t> & cpus)
+            {
+                Pools & pools = GetPools();
+                std::lock_guard<std::mutex> lock(pools.mutex);
+                ThreadPool *& pool = pools.map[cpus];
+                if (pool == NULL)
+                    pool = new ThreadPool(cpus);
+                return *pool;
+            }
+
+            size_t Size() const
+            {
+                return _started.load(std::memory_order_acquire);
+            }
+
+            void Reserve(size_t size)
+            {
+                size = Simd::Min(size, _workers.size());
+                if (Size() >= size)
+                    return;
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_stop)
+                    return;
+                for (size_t i = _started.load(); i < size; ++i)
+                {
+                    _workers[i]->thread = std::thread(&ThreadPool::Work, this, i);
+                    _started.store(i + 1, std::memory_order_release);
+                }
+            }
+
+            void Submit(const Task * tasks, size_t count)
+            {
+                size_t size = Size();
+                if (size == 0)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                        Finish(tasks[i]);
+                    return;
+                }
+                for (size_t i = 0; i < count; ++i)
+                {
+                    size_t index = s_index < size ? s_index : _next.fetch_add(1, std::memory_order_relaxed) % size;
+                    Worker & worker = *_workers[index];
+                    std::lock_guard<std::mutex> lock(worker.mutex);
+                    worker.tasks.push_back(tasks[i]);
+                    _queued.fetch_add(1);
+                }
+                if (_sleeping.load() > 0)
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (count > 1)
+                        _condition.notify_all();
+                    else
+                        _condition.notify_one();
+                }
+            }
+
+            void Wait(ParallelJob & job)
+            {
+                for (size_t attempt = 0; job.pending.load(std::memory_order_acquire) > 0;)
+                {
+                    Task task;
+                    if (Take(job, task, false))
+                    {
+                        Finish(task);
+                        attempt = 0;
+                    }
+                    else if (attempt < BACKOFF_MAX)
+                    {
+                        for (size_t i = 0, n = size_t(1) << Simd::Min<size_t>(attempt, 6); i < n; ++i)
+                            std::this_thread::yield();
+                        attempt++;
+                    }
+                    else if (Take(job, task, true))
+                        Finish(task);
+                    else
+                    {
+                        _waiting.fetch_add(1);
+                        {
+                            std::unique_lock<std::mutex> lock(_doneMutex);
+                            while (job.pending.load() > 0)
+                                _doneCondition.wait(lock);
+                        }
+                        _waiting.fetch_sub(1);
+                    }
+                }
+            }
+
+            void SetAffinity(const std::vector<size_t> & cpus)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _affinity = cpus;
+                    _affinityVersion++;
+                }
+                _condition.notify_all();
+            }
+
+            bool Help(ParallelJob & job)
+            {
+                Task task;
+                if (!Take(job, task, false))
+                    return false;
+                Finish(task);
+                return true;
+            }
+
+            size_t Topology(size_t * cpus, size_t * nodes, size_t size) const
+            {
+                size_t started = Size();
+                for (size_t i = 0, n = Simd::Min(started, size); i < n; ++i)
+                {
+                    size_t cpu = _workers[i]->cpu.load();
+                    if (cpus)
+                        cpus[i] = cpu;
+                    if (nodes)
+                        nodes[i] = cpu == size_t(-1) ? size_t(-1) : CpuNumaNode(cpu);
+                }
+                return started;
+            }
+
+        private:
+            static const size_t BACKOFF_MAX = 16;
+
+            struct Worker
+            {
+                std::deque<Task> tasks;
+                std::mutex mutex;
+                std::thread thread;
+                std::atomic<size_t> cpu;
+
+                Worker() : cpu(size_t(-1)) {}
+            };
+
+            struct Pools
+            {
+                std::mutex mutex;
+                std::map<std::vector<size_t>, ThreadPool*> map;
+            };
+
+            std::vector<Worker*> _workers;
+            std::vector<size_t> _affinity;
+            std::atomic<size_t> _started, _next, _queued, _sleeping, _waiting, _affinityVersion;
+            std::mutex _mutex, _doneMutex;
+            std::condition_variable _condition, _doneCondition;
+            bool _stop;
+
+            static thread_local size_t s_index;
+
+            ThreadPool(const std::vector<size_t> & cpus)
+                : _workers(cpus.empty() ? Simd::Max<size_t>(std::thread::hardware_concurrency(), 1) : cpus.size())
+                , _affinity(cpus)
+                , _started(0)
+                , _next(0)
+                , _queued(0)
+                , _sleeping(0)
+                , _waiting(0)
+                , _affinityVersion(cpus.empty() ? 0 : 1)
+                , _stop(false)
+            {
+                for (size_t i = 0; i < _workers.size(); ++i)
+                    _workers[i] = new Worker();
+            }
+
+            static Pools & GetPools()
+            {
+                static Pools * pools = CreatePools();
+                return *pools;
+            }
+
+            static Pools * CreatePools()
+            {
+                Pools * pools = new Pools();
+                std::atexit(Shutdown);
+                return pools;
+            }
+
+            static void Shutdown()
+            {
+                Pools & pools = GetPools();
+                std::lock_guard<std::mutex> lock(pools.mutex);
+                for (std::map<std::vector<size_t>, ThreadPool*>::iterator it = pools.map.begin(); it != pools.map.end(); ++it)
+                    it->second->Stop();
+            }
+
+            size_t UpdateAffinity(size_t index)
+            {
+                std::vector<size_t> cpus;
+                size_t version;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    version = _affinityVersion.load();
+                    if (_affinity.size())
+                        cpus.push_back(_affinity[index % _affinity.size()]);
+                }
+                if (cpus.empty())
+                {
+                    for (size_t cpu = 0, n = std::thread::hardware_concurrency(); cpu < n; ++cpu)
+                        cpus.push_back(cpu);
+                }
+                BindCurrentThread(cpus);
+                _workers[index]->cpu = cpus.size() == 1 ? cpus[0] : size_t(-1);
+                return version;
+            }
+
+            void Stop()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _stop = true;
+                    for (size_t i = 0; i < _workers.size(); ++i)
+                        if (_workers[i]->thread.joinable())
+                            _workers[i]->thread.detach();
+                }
+                _condition.notify_all();
+            }
+
+            void Finish(const Task & task)
+            {
+                ParallelJob & job = *task.job;
+                job.Run(task.thread, task.begin, task.end);
+                if (job.pending.fetch_sub(1) == 1 && _waiting.load() > 0)
+                {
+                    std::lock_guard<std::mutex> lock(_doneMutex);
+                    _doneCondition.notify_all();
+                }
+            }
+
+            bool Take(const ParallelJob & job, Task & task, bool blocking)
+            {
+                size_t size = Size();
+                for (size_t i = 0; i < size; ++i)
+                {
+                    Worker & worker = *_workers[s_index < size ? (s_index + i) % size : i];
+                    std::unique_lock<std::mutex> lock(worker.mutex, std::defer_lock);
+                    if (blocking)
+                        lock.lock();
+                    else
+                        lock.try_lock();
+                    if (!lock.owns_lock())
+                        continue;
+                    for (size_t j = worker.tasks.size(); j > 0; --j)
+                    {
+                        if (worker.tasks[j - 1].job == &job)
+                        {
+                            task = worker.tasks[j - 1];
+                            worker.tasks.erase(worker.tasks.begin() + (j - 1));
+                            _queued.fetch_sub(1);
+                            return true;
+                        }
+                    }
+                }
+                return false;
+            }
+
+            bool Steal(size_t index, Task & task)
+            {
+                size_t size = Size();
+                for (size_t i = 0; i < size; ++i)
+                {
+                    Worker & worker = *_workers[(index + i) % size];
+                    std::lock_guard<std::mutex> lock(worker.mutex);
+                    if (worker.tasks.empty())
+                        continue;
+                    if (i == 0)
+                    {
+                        task = worker.tasks.back();
+                        worker.tasks.pop_back();
+                    }
+                    else
+                    {
+                        task = worker.tasks.front();
+                        worker.tasks.pop_front();
+                    }
+                    _queued.fetch_sub(1);
+                    return true;
+                }
+                return false;
+            }
+
+            void Work(size_t index)
+            {
+                s_index = index;
+                size_t affinityVersion = 0;
+                for (;;)
+                {
+                    if (affinityVersion != _affinityVersion.load())
+                        affinityVersion = UpdateAffinity(index);
+                    Task task;
+                    if (Steal(index, task))
+                    {
+                        Finish(task);
+                        continue;
+                    }
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _sleeping.fetch_add(1);
+                    while (!_stop && _queued.load() == 0 && affinityVersion == _affinityVersion.load())
+                        _condition.wait(lock);
+                    _sleeping.fetch_sub(1);
+                    if (_stop)
+                        return;
+                }
+            }
+        };
+
+        thread_local size_t ThreadPool::s_index = size_t(-1);
+
+        //-------------------------------------------------------------------------------------------------
+
+        const size_t PARALLEL_TASK_BUFFER = 64;
+
         size_t g_threadNumber = 1;
 
         size_t GetThreadNumber()
         {
+            if (s_budget && s_budget->threadNumber)
+                return s_budget->threadNumber;
             return g_threadNumber;
         }
 
         void SetThreadNumber(size_t threadNumber)
         {
             g_threadNumber = Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency());
+            ThreadPool::Global().Reserve(g_threadNumber - 1);
+        }
+
+        void RunParallel(size_t begin, size_t end, SimdParallelTaskPtr task, void * context, size_t threadNumber, size_t blockAlign)
+        {
+            threadNumber = Simd::Min<size_t>(threadNumber, std::thread::hardware_concurrency());
+            if (threadNumber <= 1 || size_t(blockAlign * 1.5) >= (end - begin))
+            {
+                task(context, 0, begin, end);
+                return;
+            }
+
+            ThreadPool & pool = s_budget && s_budget->pool ? *(ThreadPool*)s_budget->pool : ThreadPool::Global();
+            pool.Reserve(threadNumber - 1);
+
+            size_t blockSize = AlignHiAny(DivHi(end - begin, threadNumber), blockAlign);
+
+            ParallelJob job(task, context);
+            ParallelTask buffer[PARALLEL_TASK_BUFFER];
+            std::vector<ParallelTask> heap(threadNumber > PARALLEL_TASK_BUFFER ? threadNumber : 0);
+            ParallelTask * tasks = heap.empty() ? buffer : heap.data();
+            size_t count = 0;
+            for (size_t blockBegin = begin + blockSize; count + 1 < threadNumber && blockBegin < end; ++count)
+            {
+                size_t blockEnd = Simd::Min(blockBegin + blockSize, end);
+                ParallelTask & block = tasks[count];
+                block.job = &job;
+                block.thread = count + 1;
+                block.begin = blockBegin;
+                block.end = blockEnd;
+                blockBegin = blockEnd;
+            }
+            job.pending.store(count + 1);
+            pool.Submit(tasks, count);
+
+            job.Run(0, begin, Simd::Min(begin + blockSize, end));
+            job.pending.fetch_sub(1);
+
+            pool.Wait(job);
+
+            if (job.failed.load())
+                std::rethrow_exception(job.error);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SetThreadBudget(void * context, size_t threadNumber, const size_t * cpus, size_t cpuCount)
+        {
+            ThreadBudget & budget = ((Deletable*)context)->budget;
+            budget.cpus.clear();
+            for (size_t i = 0; i < cpuCount; ++i)
+                if (cpus[i] < std::thread::hardware_concurrency())
+                    budget.cpus.push_back(cpus[i]);
+            if (threadNumber == 0 && budget.cpus.size())
+                threadNumber = budget.cpus.size();
+            budget.threadNumber = threadNumber ? Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency()) : 0;
+            budget.pool = NULL;
+            if (budget.cpus.size())
+            {
+                ThreadPool & pool = ThreadPool::Get(budget.cpus);
+                pool.Reserve(budget.threadNumber - 1);
+                budget.pool = &pool;
+            }
+        }
+
+        size_t GetThreadBudget(const void * context)
+        {
+            const ThreadBudget & budget = ((const Deletable*)context)->budget;
+            return budget.threadNumber ? budget.threadNumber : g_threadNumber;
+        }
+
+        ThreadBudgetScope::ThreadBudgetScope(const void * context)
+            : _previous(s_budget)
+        {
+            const ThreadBudget & budget = ((const Deletable*)context)->budget;
+            if (!budget.Empty())
+                s_budget = &budget;
+        }
+
+        ThreadBudgetScope::~ThreadBudgetScope()
+        {
+            s_budget = (const ThreadBudget*)_previous;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SetThreadAffinity(const size_t * cpus, size_t cpuCount)
+        {
+            std::vector<size_t> affinity;
+            for (size_t i = 0; i < cpuCount; ++i)
+                if (cpus[i] < std::thread::hardware_concurrency())
+                    affinity.push_back(cpus[i]);
+            ThreadPool::Global().SetAffinity(affinity);
+        }
+
+        size_t GetThreadTopology(size_t * cpus, size_t * nodes, size_t size)
+        {
+            return ThreadPool::Global().Topology(cpus, nodes, size);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        class TaskGraph : public Deletable
+        {
+        public:
+            TaskGraph()
+                : _job(Execute, this)
+                , _pool(NULL)
+                , _next(1)
+            {
+            }
+
+            virtual ~TaskGraph()
+            {
+                WaitAll();
+                while (_job.pending.load(std::memory_order_acquire) > 0)
+                    std::this_thread::yield();
+            }
+
+            size_t Submit(SimdTaskGraphTaskPtr task, void * context, const size_t * deps, size_t depCount)
+            {
+                size_t id;
+                bool ready;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    for (size_t i = 0; i < depCount; ++i)
+                        if (deps[i] == 0 || deps[i] >= _next)
+                            return 0;
+                    id = _next++;
+                    Node & node = _nodes[id];
+                    node.task = task;
+                    node.context = context;
+                    node.unfinished = 0;
+                    node.failed = false;
+                    for (size_t i = 0; i < depCount; ++i)
+                    {
+                        std::unordered_map<size_t, Node>::iterator it = _nodes.find(deps[i]);
+                        if (it != _nodes.end())
+                        {
+                            it->second.dependents.push_back(id);
+                            node.unfinished++;
+                        }
+                        else if (_failed.count(deps[i]))
+                            node.failed = true;
+                    }
+                    ready = node.unfinished == 0;
+                }
+                if (ready && !Launch(id))
+                    Run(id);
+                return id;
+            }
+
+            bool Wait(size_t id)
+            {
+                for (;;)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        if (_nodes.find(id) == _nodes.end())
+                            return _failed.erase(id) == 0;
+                    }
+                    if (Help())
+                        continue;
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    if (_nodes.find(id) != _nodes.end())
+                        _done.wait_for(lock, std::chrono::milliseconds(1));
+                }
+            }
+
+            bool WaitAll()
+            {
+                for (;;)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        if (_nodes.empty())
+                        {
+                            bool result = _failed.empty();
+                            _failed.clear();
+                            return result;
+                        }
+                    }
+                    if (Help())
+                        continue;
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    if (!_nodes.empty())
+                        _done.wait_for(lock, std::chrono::milliseconds(1));
+                }
+            }
+
+        private:
+            struct Node
+            {
+                SimdTaskGraphTaskPtr task;
+                void * context;
+                size_t unfinished;
+                bool failed;
+                std::vector<size_t> dependents;
+            };
+
+            ParallelJob _job;
+            std::atomic<ThreadPool*> _pool;
+            std::unordered_map<size_t, Node> _nodes;
+            std::set<size_t> _failed;
+            size_t _next;
+            std::mutex _mutex;
+            std::condition_variable _done;
+
+            static void Execute(void * context, size_t thread, size_t begin, size_t end)
+            {
+                ((TaskGraph*)context)->Run(begin);
+            }
+
+            bool Launch(size_t id)
+            {
+                size_t threads = budget.threadNumber ? budget.threadNumber : g_threadNumber;
+                if (threads <= 1)
+                    return false;
+                ThreadPool & pool = budget.pool ? *(ThreadPool*)budget.pool : ThreadPool::Global();
+                pool.Reserve(threads - 1);
+                if (pool.Size() == 0)
+                    return false;
+                _pool.store(&pool);
+                ParallelTask task;
+                task.job = &_job;
+                task.thread = 0;
+                task.begin = id;
+                task.end = id + 1;
+                _job.pending.fetch_add(1);
+                pool.Submit(&task, 1);
+                return true;
+            }
+
+            bool Help()
+            {
+                ThreadPool * pool = _pool.load();
+                return pool && pool->Help(_job);
+            }
+
+            void Run(size_t id)
+            {
+                std::vector<size_t> ready(1, id), next;
+                while (ready.size())
+                {
+                    size_t current = ready.back();
+                    ready.pop_back();
+                    SimdTaskGraphTaskPtr task;
+                    void * context;
+                    bool failed;
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        const Node & node = _nodes[current];
+                        task = node.task;
+                        context = node.context;
+                        failed = node.failed;
+                    }
+                    try
+                    {
+                        ThreadBudgetScope scope(this);
+                        task(context, failed ? SimdTrue : SimdFalse);
+                    }
+                    catch (...)
+                    {
+                        failed = true;
+                    }
+                    next.clear();
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        Node & node = _nodes[current];
+                        for (size_t i = 0; i < node.dependents.size(); ++i)
+                        {
+                            Node & dependent = _nodes[node.dependents[i]];
+                            dependent.failed = dependent.failed || failed;
+                            if (--dependent.unfinished == 0)
+                                next.push_back(node.dependents[i]);
+                        }
+                        if (failed)
+                            _failed.insert(current);
+                        _nodes.erase(current);
+                        _done.notify_all();
+                    }
+                    for (size_t i = 0; i < next.size(); ++i)
+                        if (!Launch(next[i]))
+                            ready.push_back(next[i]);
+                }
+            }
+        };
+
+        void * TaskGraphInit()
+        {
+            return new TaskGraph();
+        }
+
+        size_t TaskGraphSubmit(void * graph, SimdTaskGraphTaskPtr task, void * context, const size_t * deps, size_t depCount)
+        {
+            return ((TaskGraph*)graph)->Submit(task, context, deps, depCount);
+        }
+
+        bool TaskGraphWait(void * graph, size_t task)
+        {
+            return ((TaskGraph*)graph)->Wait(task);
+        }
+
+        bool TaskGraphWaitAll(void * graph)
+        {
+            return ((TaskGraph*)graph)->WaitAll();
         }
     }
 }
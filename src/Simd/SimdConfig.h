@@ -70,6 +70,8 @@
 
 //#define SIMD_PERF_STAT_IN_DEBUG
 
+//#define SIMD_PERFORMANCE_COUNTERS
+
 //#define SIMD_RUNTIME_STATISTIC
 
 //#define SIMD_FUTURE_DISABLE
@@ -26,6 +26,8 @@
 
 #include "Simd/SimdDefs.h"
 
+#include <string>
+
 namespace Simd
 {
 #if defined(SIMD_X86_ENABLE) || defined(SIMD_X64_ENABLE)
@@ -114,6 +116,25 @@ namespace Simd
 
         size_t CpuCacheSize(size_t level);
 
+        size_t CpuNumaNode(size_t cpu);
+
+        std::string CpuModel();
+
+        double CpuPeak32f();
+
+        double CpuPeak8i();
+
+        SIMD_INLINE double CpuPeakCalibrate(double (*measure)(size_t count))
+        {
+            double peak = 0;
+            for (size_t i = 0; i < 3; ++i)
+            {
+                double value = measure(size_t(1) << 20);
+                peak = value > peak ? value : peak;
+            }
+            return peak;
+        }
+
         SIMD_INLINE size_t AlgCacheL1()
         {
             return Cpu::L1_CACHE_SIZE;
@@ -130,6 +151,42 @@ namespace Simd
         }
     }
 
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        double CpuPeak32f();
+
+        double CpuPeak8i();
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        double CpuPeak32f();
+
+        double CpuPeak8i();
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        double CpuPeak32f();
+
+        double CpuPeak8i();
+    }
+#endif
+
+#ifdef SIMD_AVX512VNNI_ENABLE
+    namespace Avx512vnni
+    {
+        double CpuPeak32f();
+
+        double CpuPeak8i();
+    }
+#endif
+
 #ifdef SIMD_SSE2_ENABLE
     namespace Sse2
     {
@@ -433,6 +433,7 @@ namespace Simd
         std::vector<Data> _data;
         Size _imageSize;
         bool _needNormalization;
+        View _gray;
         ptrdiff_t _threadNumber;
         LevelPtrs _levels;
 
@@ -526,12 +527,12 @@ namespace Simd
 
         void FillLevels(View src)
         {
-            View gray;
             if (src.format != View::Gray8)
             {
-                gray.Recreate(src.Size(), View::Gray8);
-                Convert(src, gray);
-                src = gray;
+                if (_gray.Size() != src.Size())
+                    _gray.Recreate(src.Size(), View::Gray8);
+                Convert(src, _gray);
+                src = _gray;
             }
 
             Simd::ResizeBilinear(src, _levels[0]->src);
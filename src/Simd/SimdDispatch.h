@@ -0,0 +1,151 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdDispatch_h__
+#define __SimdDispatch_h__
+
+#include "Simd/SimdEnable.h"
+
+#include <atomic>
+#include <initializer_list>
+
+namespace Simd
+{
+    namespace Base
+    {
+        extern std::atomic<int> g_maxIsa;
+
+        SIMD_INLINE int MaxIsa()
+        {
+            return g_maxIsa.load(std::memory_order_relaxed);
+        }
+
+        void SetMaxIsa(SimdCpuInfoType isa);
+    }
+
+    template<class Ptr> struct DispatchImpl
+    {
+        Ptr func;
+        size_t min;
+        int isa;
+        bool enable;
+    };
+
+    template<class Ptr> class Dispatch
+    {
+    public:
+        typedef DispatchImpl<Ptr> Impl;
+
+        Dispatch(std::initializer_list<Impl> impls)
+            : _size(0)
+        {
+            for (const Impl * impl = impls.begin(); impl != impls.end() && _size < SIZE; ++impl)
+                if (impl->enable)
+                    _impls[_size++] = *impl;
+        }
+
+        SIMD_INLINE Ptr operator()(size_t size = 0) const
+        {
+            const Impl * impl = _impls;
+            int max = Base::MaxIsa();
+            while (impl->isa > max || size < impl->min)
+                impl++;
+            return impl->func;
+        }
+
+    private:
+        static const size_t SIZE = 12;
+        Impl _impls[SIZE];
+        size_t _size;
+    };
+}
+
+#define SIMD_BASE_IMPL(func) { Simd::Base::func, 0, 0, true }
+
+#ifdef SIMD_SSE2_ENABLE
+#define SIMD_SSE2_IMPL(func, min) { Simd::Sse2::func, size_t(min), SimdCpuInfoSse2, Simd::Sse2::Enable },
+#else
+#define SIMD_SSE2_IMPL(func, min)
+#endif
+
+#ifdef SIMD_SSE41_ENABLE
+#define SIMD_SSE41_IMPL(func, min) { Simd::Sse41::func, size_t(min), SimdCpuInfoSse41, Simd::Sse41::Enable },
+#else
+#define SIMD_SSE41_IMPL(func, min)
+#endif
+
+#ifdef SIMD_AVX_ENABLE
+#define SIMD_AVX_IMPL(func, min) { Simd::Avx::func, size_t(min), SimdCpuInfoAvx, Simd::Avx::Enable },
+#else
+#define SIMD_AVX_IMPL(func, min)
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+#define SIMD_AVX2_IMPL(func, min) { Simd::Avx2::func, size_t(min), SimdCpuInfoAvx2, Simd::Avx2::Enable },
+#else
+#define SIMD_AVX2_IMPL(func, min)
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+#define SIMD_AVX512BW_IMPL(func, min) { Simd::Avx512bw::func, size_t(min), SimdCpuInfoAvx512bw, Simd::Avx512bw::Enable },
+#else
+#define SIMD_AVX512BW_IMPL(func, min)
+#endif
+
+#ifdef SIMD_AVX512VNNI_ENABLE
+#define SIMD_AVX512VNNI_IMPL(func, min) { Simd::Avx512vnni::func, size_t(min), SimdCpuInfoAvx512vnni, Simd::Avx512vnni::Enable },
+#else
+#define SIMD_AVX512VNNI_IMPL(func, min)
+#endif
+
+#ifdef SIMD_AVX512BF16_ENABLE
+#define SIMD_AVX512BF16_IMPL(func, min) { Simd::Avx512bf16::func, size_t(min), SimdCpuInfoAvx512bf16, Simd::Avx512bf16::Enable },
+#else
+#define SIMD_AVX512BF16_IMPL(func, min)
+#endif
+
+#ifdef SIMD_AMX_ENABLE
+#define SIMD_AMX_IMPL(func, min) { Simd::Amx::func, size_t(min), SimdCpuInfoAmx, Simd::Amx::Enable },
+#else
+#define SIMD_AMX_IMPL(func, min)
+#endif
+
+#ifdef SIMD_VMX_ENABLE
+#define SIMD_VMX_IMPL(func, min) { Simd::Vmx::func, size_t(min), SimdCpuInfoVmx, Simd::Vmx::Enable },
+#else
+#define SIMD_VMX_IMPL(func, min)
+#endif
+
+#ifdef SIMD_VSX_ENABLE
+#define SIMD_VSX_IMPL(func, min) { Simd::Vsx::func, size_t(min), SimdCpuInfoVsx, Simd::Vsx::Enable },
+#else
+#define SIMD_VSX_IMPL(func, min)
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+#define SIMD_NEON_IMPL(func, min) { Simd::Neon::func, size_t(min), SimdCpuInfoNeon, Simd::Neon::Enable },
+#else
+#define SIMD_NEON_IMPL(func, min)
+#endif
+
+#endif//__SimdDispatch_h__
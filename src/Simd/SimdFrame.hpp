@@ -830,6 +830,14 @@ namespace Simd
         }
     }
 
+    /*! \cond PRIVATE */
+    template <template<class> class A> SIMD_INLINE View<A> ScratchView(const Point<ptrdiff_t> & size, typename View<A>::Format format)
+    {
+        size_t stride = SimdAlign(size.x * View<A>::PixelSize(format), SimdAlignment());
+        return View<A>(size.x, size.y, stride, format, SimdScratchAllocate(stride * size.y, SimdAlignment()));
+    }
+    /*! \endcond */
+
     template <template<class> class A> SIMD_INLINE void Convert(const Frame<A> & src, Frame<A> & dst)
     {
         assert(EqualSize(src, dst) && src.format && dst.format && src.flipped == dst.flipped);
@@ -840,6 +848,7 @@ namespace Simd
             return;
         }
 
+        size_t mark = SimdScratchMark();
         switch (src.format)
         {
         case Frame<A>::Nv12:
@@ -851,14 +860,14 @@ namespace Simd
                 break;
             case Frame<A>::Bgra32:
             {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
+                View<A> u = ScratchView<A>(src.planes[1].Size(), View<A>::Gray8), v = ScratchView<A>(src.planes[1].Size(), View<A>::Gray8);
                 DeinterleaveUv(src.planes[1], u, v);
                 Yuv420pToBgra(src.planes[0], u, v, dst.planes[0]);
                 break;
             }
             case Frame<A>::Bgr24:
             {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
+                View<A> u = ScratchView<A>(src.planes[1].Size(), View<A>::Gray8), v = ScratchView<A>(src.planes[1].Size(), View<A>::Gray8);
                 DeinterleaveUv(src.planes[1], u, v);
                 Yuv420pToBgr(src.planes[0], u, v, dst.planes[0]);
                 break;
@@ -868,16 +877,16 @@ namespace Simd
                 break;
             case Frame<A>::Rgb24:
             {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
+                View<A> u = ScratchView<A>(src.planes[1].Size(), View<A>::Gray8), v = ScratchView<A>(src.planes[1].Size(), View<A>::Gray8);
                 DeinterleaveUv(src.planes[1], u, v);
                 Yuv420pToRgb(src.planes[0], u, v, dst.planes[0]);
                 break;
             }
             case Frame<A>::Rgba32:
             {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
+                View<A> u = ScratchView<A>(src.planes[1].Size(), View<A>::Gray8), v = ScratchView<A>(src.planes[1].Size(), View<A>::Gray8);
                 DeinterleaveUv(src.planes[1], u, v);
-                View<A> bgr(src.Size(), View<A>::Bgr24);
+                View<A> bgr = ScratchView<A>(src.Size(), View<A>::Bgr24);
                 Yuv420pToBgr(src.planes[0], u, v, bgr);
                 BgrToRgba(bgr, dst.planes[0]);
                 break;
@@ -908,7 +917,7 @@ namespace Simd
                 break;
             case Frame<A>::Rgba32:
             {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
+                View<A> bgr = ScratchView<A>(src.Size(), View<A>::Bgr24);
                 Yuv420pToBgr(src.planes[0], src.planes[1], src.planes[2], bgr);
                 BgrToRgba(bgr, dst.planes[0]);
                 break;
@@ -923,7 +932,7 @@ namespace Simd
             {
             case Frame<A>::Nv12:
             {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
+                View<A> u = ScratchView<A>(dst.planes[1].Size(), View<A>::Gray8), v = ScratchView<A>(dst.planes[1].Size(), View<A>::Gray8);
                 BgraToYuv420p(src.planes[0], dst.planes[0], u, v);
                 InterleaveUv(u, v, dst.planes[1]);
                 break;
@@ -953,7 +962,7 @@ namespace Simd
             {
             case Frame<A>::Nv12:
             {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
+                View<A> u = ScratchView<A>(dst.planes[1].Size(), View<A>::Gray8), v = ScratchView<A>(dst.planes[1].Size(), View<A>::Gray8);
                 BgrToYuv420p(src.planes[0], dst.planes[0], u, v);
                 InterleaveUv(u, v, dst.planes[1]);
                 break;
@@ -1012,16 +1021,16 @@ namespace Simd
             {
             case Frame<A>::Nv12:
             {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
+                View<A> bgr = ScratchView<A>(src.Size(), View<A>::Bgr24);
                 RgbToBgr(src.planes[0], bgr);
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
+                View<A> u = ScratchView<A>(dst.planes[1].Size(), View<A>::Gray8), v = ScratchView<A>(dst.planes[1].Size(), View<A>::Gray8);
                 BgrToYuv420p(bgr, dst.planes[0], u, v);
                 InterleaveUv(u, v, dst.planes[1]);
                 break;
             }
             case Frame<A>::Yuv420p:
             {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
+                View<A> bgr = ScratchView<A>(src.Size(), View<A>::Bgr24);
                 RgbToBgr(src.planes[0], bgr);
                 BgrToYuv420p(bgr, dst.planes[0], dst.planes[1], dst.planes[2]);
                 break;
@@ -1047,16 +1056,16 @@ namespace Simd
             {
             case Frame<A>::Nv12:
             {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
+                View<A> bgr = ScratchView<A>(src.Size(), View<A>::Bgr24);
                 RgbaToBgr(src.planes[0], bgr);
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
+                View<A> u = ScratchView<A>(dst.planes[1].Size(), View<A>::Gray8), v = ScratchView<A>(dst.planes[1].Size(), View<A>::Gray8);
                 BgrToYuv420p(bgr, dst.planes[0], u, v);
                 InterleaveUv(u, v, dst.planes[1]);
                 break;
             }
             case Frame<A>::Yuv420p:
             {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
+                View<A> bgr = ScratchView<A>(src.Size(), View<A>::Bgr24);
                 RgbaToBgr(src.planes[0], bgr);
                 BgrToYuv420p(bgr, dst.planes[0], dst.planes[1], dst.planes[2]);
                 break;
@@ -1080,6 +1089,7 @@ namespace Simd
         default:
             assert(0);
         }
+        SimdScratchReset(mark);
     }
 }
 
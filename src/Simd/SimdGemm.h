@@ -24,10 +24,6 @@
 #ifndef __SimdGemm_h__
 #define __SimdGemm_h__
 
-#if defined(__GNUC__) && ((__GNUC__ > 10) || ((__GNUC__ == 10) && (__GNUC_MINOR__ >= 1) && (__GNUC_MINOR__ <= 3)))
-#define SIMD_FUTURE_DISABLE
-#endif
-
 #include "Simd/SimdArray.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdParallel.hpp"
@@ -72,11 +68,6 @@ namespace Simd
                 _threadNumber = 1;
             _pA.resize(_threadNumber);
             _pB.resize(_threadNumber);
-            for (size_t t = 0; t < _threadNumber; ++t) 
-            {
-                _pA[t].Resize(_macroM * _macroK);
-                _pB[t].Resize(_macroN * _macroK);
-            }
             size_t NF = AlignLo(_N, F);
             if (tailMask)
             {
@@ -102,6 +93,11 @@ namespace Simd
 
         void ThreadKernel(size_t N, T alpha, const T * A, size_t lda, const T * B, size_t ldb, T beta, T * C, size_t ldc, size_t thread)
         {
+            if (_pB[thread].size == 0)
+            {
+                _pA[thread].Resize(_macroM * _macroK);
+                _pB[thread].Resize(_macroN * _macroK);
+            }
             for (size_t j = 0; j < N; j += _macroN)
             {
                 size_t macroN = Simd::Min(N, j + _macroN) - j;
@@ -26,6 +26,7 @@
 
 #include "Simd/SimdMemoryStream.h"
 #include "Simd/SimdArray.h"
+#include "Simd/SimdScratch.h"
 #include "Simd/SimdAlignment.h"
 
 #include "Simd/SimdView.hpp"
@@ -170,7 +171,7 @@ namespace Simd
             uint32_t _width, _height, _channels;
             uint16_t _tc16[3];
             uint8_t _depth, _color, _interlace, _paletteChannels, _tc[3];
-            Array8u _palette, _idat;
+            Array8u _palette;
 
             struct Chunk
             {
@@ -188,7 +189,7 @@ namespace Simd
             bool ReadPalette(const Chunk& chunk);
             bool ReadTransparency(const Chunk& chunk);
             bool ReadData(const Chunk& chunk);
-            InputMemoryStream MergedDataStream();
+            InputMemoryStream MergedDataStream(Scratch& scratch);
         };
 
         class ImageJpegLoader : public ImageLoader
@@ -65,6 +65,29 @@ namespace Simd
         }
     }
 
+    template <class T, bool square> void IntegralBandOrigin(const uint8_t * src, size_t width, const T * prev, const T * last, T * origin)
+    {
+        T rowSum = 0;
+        origin[0] = 0;
+        for (size_t col = 0; col < width; col++)
+        {
+            T value = src[col];
+            rowSum += square ? value * value : value;
+            origin[col + 1] = prev[col + 1] + last[col + 1] + rowSum;
+        }
+    }
+
+    template <class T> void IntegralBandShift(T * dst, size_t stride, size_t width, size_t height)
+    {
+        const T * origin = dst;
+        for (size_t row = 1; row <= height; row++)
+        {
+            dst += stride;
+            for (size_t col = 0; col <= width; col++)
+                dst[col] += origin[col];
+        }
+    }
+
     template <class TSum, class TSqsum> void IntegralSumSqsum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         TSum * sum, size_t sumStride, TSqsum * sqsum, size_t sqsumStride)
     {
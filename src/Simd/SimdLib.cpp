@@ -55,16 +55,21 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdLib.h"
 
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdScratch.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdEnable.h"
+#include "Simd/SimdDispatch.h"
 #include "Simd/SimdAlignment.h"
 #include "Simd/SimdConst.h"
 #include "Simd/SimdLog.h"
 #include "Simd/SimdPerformance.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdArray.h"
 
 #include "Simd/SimdGaussianBlur.h"
 #include "Simd/SimdImageLoad.h"
 #include "Simd/SimdImageSave.h"
+#include "Simd/SimdPipeline.h"
 #include "Simd/SimdResizer.h"
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution32f.h"
@@ -73,6 +78,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdSynetMergedConvolution32f.h"
 #include "Simd/SimdSynetMergedConvolution8i.h"
 #include "Simd/SimdSynetScale8i.h"
+#include "Simd/SimdSynetPlanner.h"
 
 #include "Simd/SimdBase.h"
 #include "Simd/SimdSse2.h"
@@ -94,6 +100,59 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 namespace Simd
 {
     const size_t ALIGNMENT = GetAlignment();
+
+    const size_t ROW_BAND_AREA_MIN = 128 * 1024;
+
+    SIMD_INLINE size_t RowBandNumber(size_t height, size_t area, size_t align)
+    {
+        size_t number = Simd::Min(Base::GetThreadNumber(), area / ROW_BAND_AREA_MIN);
+        return Simd::Max<size_t>(Simd::Min(number, height / (2 * align)), 1);
+    }
+
+    SIMD_INLINE size_t RowBand(size_t band, size_t number, size_t height, size_t align)
+    {
+        return band < number ? AlignLoAny(height * band / number, align) : height;
+    }
+
+    template<class Function> SIMD_INLINE void ParallelRows(size_t height, size_t area, size_t align, const Function & function)
+    {
+        size_t number = RowBandNumber(height, area, align);
+        if (number > 1)
+        {
+            Parallel(0, number, [&](size_t, size_t begin, size_t end)
+            {
+                for (size_t band = begin; band < end; ++band)
+                    function(RowBand(band, number, height, align), RowBand(band + 1, number, height, align));
+            }, number);
+        }
+        else
+            function(0, height);
+    }
+
+    template<class Filter> SIMD_INLINE void ParallelFilterRows(const uint8_t * src, size_t srcStride, size_t height, size_t area,
+        size_t half, uint8_t * dst, size_t dstStride, size_t dstRowSize, const Filter & filter)
+    {
+        ParallelRows(height, area, 2 * half, [&](size_t begin, size_t end)
+        {
+            filter(src + begin * srcStride, end - begin, dst + begin * dstStride, dstStride);
+            if (begin == 0 && end == height)
+                return;
+            size_t bufferStride = AlignHi(dstRowSize, ALIGNMENT);
+            Scratch scratch;
+            uint8_t * buffer = scratch.Allocate<uint8_t>(3 * half * bufferStride, ALIGNMENT);
+            auto restore = [&](size_t yBeg, size_t yEnd)
+            {
+                size_t wBeg = yBeg > half ? yBeg - half : 0, wEnd = Simd::Min(yEnd + half, height);
+                filter(src + wBeg * srcStride, wEnd - wBeg, buffer, bufferStride);
+                for (size_t y = yBeg; y < yEnd; ++y)
+                    memcpy(dst + y * dstStride, buffer + (y - wBeg) * bufferStride, dstRowSize);
+            };
+            if (begin > 0)
+                restore(begin, Simd::Min(begin + half, end));
+            if (end < height)
+                restore(Simd::Max(end - half, begin), end);
+        });
+    }
 }
 
 SIMD_API const char * SimdVersion()
@@ -151,6 +210,11 @@ SIMD_API size_t SimdCpuInfo(SimdCpuInfoType type)
     }
 }
 
+SIMD_API void SimdSetMaxIsa(SimdCpuInfoType isa)
+{
+    Base::SetMaxIsa(isa);
+}
+
 SIMD_API const char * SimdPerformanceStatistic()
 {
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
@@ -160,6 +224,15 @@ SIMD_API const char * SimdPerformanceStatistic()
 #endif
 }
 
+SIMD_API const char * SimdPerformanceStatisticExport(SimdPerformanceFormatType format, SimdBool reset)
+{
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+    return Base::PerformanceMeasurerStorage::s_storage.Export(format, reset == SimdTrue);
+#else
+    return "";
+#endif
+}
+
 SIMD_API void * SimdAllocate(size_t size, size_t align)
 {
     return Allocate(size, align);
@@ -180,9 +253,39 @@ SIMD_API size_t SimdAlignment()
     return Simd::ALIGNMENT;
 }
 
+SIMD_API size_t SimdScratchMark()
+{
+    return ScratchArena::Thread().Mark();
+}
+
+SIMD_API void * SimdScratchAllocate(size_t size, size_t align)
+{
+    return ScratchArena::Thread().Allocate(size, align);
+}
+
+SIMD_API void SimdScratchReset(size_t mark)
+{
+    ScratchArena::Thread().Reset(mark);
+}
+
+SIMD_API size_t SimdGetHugePageThreshold()
+{
+    return Base::g_hugePageThreshold;
+}
+
+SIMD_API void SimdSetHugePageThreshold(size_t threshold)
+{
+    Base::g_hugePageThreshold = threshold;
+}
+
+SIMD_API size_t SimdGetHugePageBytes()
+{
+    return Base::HugePageBytes();
+}
+
 SIMD_API void SimdRelease(void * context)
 {
-    delete (Deletable*)context;
+    ((Deletable*)context)->Release();
 }
 
 SIMD_API size_t SimdGetThreadNumber()
@@ -195,6 +298,51 @@ SIMD_API void SimdSetThreadNumber(size_t threadNumber)
     Base::SetThreadNumber(threadNumber);
 }
 
+SIMD_API void SimdParallel(size_t begin, size_t end, SimdParallelTaskPtr task, void * context, size_t threadNumber, size_t blockAlign)
+{
+    Base::RunParallel(begin, end, task, context, threadNumber, blockAlign);
+}
+
+SIMD_API void SimdSetThreadBudget(void * context, size_t threadNumber, const size_t * cpus, size_t cpuCount)
+{
+    Base::SetThreadBudget(context, threadNumber, cpus, cpuCount);
+}
+
+SIMD_API size_t SimdGetThreadBudget(const void * context)
+{
+    return Base::GetThreadBudget(context);
+}
+
+SIMD_API void SimdSetThreadAffinity(const size_t * cpus, size_t cpuCount)
+{
+    Base::SetThreadAffinity(cpus, cpuCount);
+}
+
+SIMD_API size_t SimdGetThreadTopology(size_t * cpus, size_t * nodes, size_t size)
+{
+    return Base::GetThreadTopology(cpus, nodes, size);
+}
+
+SIMD_API void * SimdTaskGraphInit()
+{
+    return Base::TaskGraphInit();
+}
+
+SIMD_API size_t SimdTaskGraphSubmit(void * graph, SimdTaskGraphTaskPtr task, void * context, const size_t * deps, size_t depCount)
+{
+    return Base::TaskGraphSubmit(graph, task, context, deps, depCount);
+}
+
+SIMD_API SimdBool SimdTaskGraphWait(void * graph, size_t task)
+{
+    return Base::TaskGraphWait(graph, task) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdTaskGraphWaitAll(void * graph)
+{
+    return Base::TaskGraphWaitAll(graph) ? SimdTrue : SimdFalse;
+}
+
 SIMD_API SimdBool SimdGetFastMode()
 {
 #ifdef SIMD_SSE2_ENABLE
@@ -229,502 +377,198 @@ SIMD_API uint32_t SimdCrc32(const void* src, size_t size)
 
 SIMD_API uint32_t SimdCrc32c(const void * src, size_t size)
 {
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable)
-        return Sse41::Crc32c(src, size);
-    else
-#endif
-        return Base::Crc32c(src, size);
+    const static Simd::Dispatch<decltype(&Base::Crc32c)> simdCrc32c = { SIMD_SSE41_IMPL(Crc32c, 0) SIMD_BASE_IMPL(Crc32c) };
+
+    return simdCrc32c()(src, size);
 }
 
 SIMD_API void SimdAbsDifference(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride, uint8_t *c, size_t cStride,
     size_t width, size_t height)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AbsDifference(a, aStride, b, bStride, c, cStride, width, height);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::AbsDifference(a, aStride, b, bStride, c, cStride, width, height);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::AbsDifference(a, aStride, b, bStride, c, cStride, width, height);
-    else
-#endif 
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AbsDifference(a, aStride, b, bStride, c, cStride, width, height);
-    else
-#endif
-        Base::AbsDifference(a, aStride, b, bStride, c, cStride, width, height);
+    typedef void(*SimdAbsDifferencePtr) (const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride, uint8_t *c, size_t cStride, size_t width, size_t height);
+    const static Simd::Dispatch<SimdAbsDifferencePtr> simdAbsDifference = {
+        SIMD_AVX512BW_IMPL(AbsDifference, 0) SIMD_AVX2_IMPL(AbsDifference, Avx2::A)
+        SIMD_SSE2_IMPL(AbsDifference, Sse2::A) SIMD_NEON_IMPL(AbsDifference, Neon::A) SIMD_BASE_IMPL(AbsDifference) };
+
+    simdAbsDifference(width)(a, aStride, b, bStride, c, cStride, width, height);
 }
 
 SIMD_API void SimdAbsDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride,
                                    size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-        Base::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
+    const static Simd::Dispatch<decltype(&Base::AbsDifferenceSum)> simdAbsDifferenceSum = {
+        SIMD_AVX512BW_IMPL(AbsDifferenceSum, 0) SIMD_AVX2_IMPL(AbsDifferenceSum, Avx2::A)
+        SIMD_SSE2_IMPL(AbsDifferenceSum, Sse2::A) SIMD_VMX_IMPL(AbsDifferenceSum, Vmx::A)
+        SIMD_NEON_IMPL(AbsDifferenceSum, Neon::A) SIMD_BASE_IMPL(AbsDifferenceSum) };
+
+    simdAbsDifferenceSum(width)(a, aStride, b, bStride, width, height, sum);
 }
 
 SIMD_API void SimdAbsDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                                          const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-        Base::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
+    const static Simd::Dispatch<decltype(&Base::AbsDifferenceSumMasked)> simdAbsDifferenceSumMasked = {
+        SIMD_AVX512BW_IMPL(AbsDifferenceSumMasked, 0) SIMD_AVX2_IMPL(AbsDifferenceSumMasked, Avx2::A)
+        SIMD_SSE2_IMPL(AbsDifferenceSumMasked, Sse2::A) SIMD_VMX_IMPL(AbsDifferenceSumMasked, Vmx::A)
+        SIMD_NEON_IMPL(AbsDifferenceSumMasked, Neon::A) SIMD_BASE_IMPL(AbsDifferenceSumMasked) };
+
+    simdAbsDifferenceSumMasked(width)(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
 }
 
 SIMD_API void SimdAbsDifferenceSums3x3(const uint8_t *current, size_t currentStride, const uint8_t * background, size_t backgroundStride,
                                        size_t width, size_t height, uint64_t * sums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2)
-        Vmx::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-    else
-#endif
-        Base::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
+    const static Simd::Dispatch<decltype(&Base::AbsDifferenceSums3x3)> simdAbsDifferenceSums3x3 = {
+        SIMD_AVX512BW_IMPL(AbsDifferenceSums3x3, 0) SIMD_AVX2_IMPL(AbsDifferenceSums3x3, Avx2::A + 2)
+        SIMD_SSE2_IMPL(AbsDifferenceSums3x3, Sse2::A + 2) SIMD_VMX_IMPL(AbsDifferenceSums3x3, Vmx::A + 2)
+        SIMD_NEON_IMPL(AbsDifferenceSums3x3, Neon::A + 2) SIMD_BASE_IMPL(AbsDifferenceSums3x3) };
+
+    simdAbsDifferenceSums3x3(width)(current, currentStride, background, backgroundStride, width, height, sums);
 }
 
 SIMD_API void SimdAbsDifferenceSums3x3Masked(const uint8_t *current, size_t currentStride, const uint8_t *background, size_t backgroundStride,
                                              const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sums)
 {
+    const static Simd::Dispatch<decltype(&Base::AbsDifferenceSums3x3Masked)> simdAbsDifferenceSums3x3Masked = {
 #if defined(SIMD_AVX512BW_ENABLE) && !defined(SIMD_MASKZ_LOAD_ERROR)
-    if (Avx512bw::Enable)
-        Avx512bw::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2)
-        Vmx::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-    else
+        SIMD_AVX512BW_IMPL(AbsDifferenceSums3x3Masked, 0)
 #endif
-        Base::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
+        SIMD_AVX2_IMPL(AbsDifferenceSums3x3Masked, Avx2::A + 2)
+        SIMD_SSE2_IMPL(AbsDifferenceSums3x3Masked, Sse2::A + 2)
+        SIMD_VMX_IMPL(AbsDifferenceSums3x3Masked, Vmx::A + 2)
+        SIMD_NEON_IMPL(AbsDifferenceSums3x3Masked, Neon::A + 2)
+        SIMD_BASE_IMPL(AbsDifferenceSums3x3Masked)
+    };
+
+    simdAbsDifferenceSums3x3Masked(width)(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
 }
 
 SIMD_API void SimdAbsGradientSaturatedSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                           uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Simd::Avx512bw::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Simd::Avx2::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::AbsGradientSaturatedSum)> simdAbsGradientSaturatedSum = {
+        SIMD_AVX512BW_IMPL(AbsGradientSaturatedSum, 0) SIMD_AVX2_IMPL(AbsGradientSaturatedSum, Avx2::A)
+        SIMD_SSE2_IMPL(AbsGradientSaturatedSum, Sse2::A) SIMD_VMX_IMPL(AbsGradientSaturatedSum, Vmx::A)
+        SIMD_NEON_IMPL(AbsGradientSaturatedSum, Neon::A) SIMD_BASE_IMPL(AbsGradientSaturatedSum) };
+
+    simdAbsGradientSaturatedSum(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdAddFeatureDifference(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                        const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride,
                                        uint16_t weight, uint8_t * difference, size_t differenceStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-    else
-#endif
-        Base::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
+    const static Simd::Dispatch<decltype(&Base::AddFeatureDifference)> simdAddFeatureDifference = {
+        SIMD_AVX512BW_IMPL(AddFeatureDifference, 0) SIMD_AVX2_IMPL(AddFeatureDifference, Avx2::A)
+        SIMD_SSE2_IMPL(AddFeatureDifference, Sse2::A) SIMD_VMX_IMPL(AddFeatureDifference, Vmx::A)
+        SIMD_NEON_IMPL(AddFeatureDifference, Neon::A) SIMD_BASE_IMPL(AddFeatureDifference) };
+
+    simdAddFeatureDifference(width)(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
+}
+
+static void AlphaBlendingBand(const uint8_t *src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+                   const uint8_t *alpha, size_t alphaStride, uint8_t *dst, size_t dstStride)
+{
+    const static Simd::Dispatch<decltype(&Base::AlphaBlending)> simdAlphaBlendingBand = {
+        SIMD_AVX512BW_IMPL(AlphaBlending, 0) SIMD_AVX2_IMPL(AlphaBlending, Avx2::A)
+        SIMD_SSE41_IMPL(AlphaBlending, Sse41::A) SIMD_SSE2_IMPL(AlphaBlending, Sse2::A)
+        SIMD_VMX_IMPL(AlphaBlending, Vmx::A) SIMD_NEON_IMPL(AlphaBlending, Neon::A) SIMD_BASE_IMPL(AlphaBlending) };
+
+    simdAlphaBlendingBand(width)(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
 }
 
 SIMD_API void SimdAlphaBlending(const uint8_t *src, size_t srcStride, size_t width, size_t height, size_t channelCount,
                    const uint8_t *alpha, size_t alphaStride, uint8_t *dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A)
-        Sse41::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
-#endif
-        Base::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
+    ParallelRows(height, width * height, 1, [=](size_t begin, size_t end)
+    {
+        AlphaBlendingBand(src + begin * srcStride, srcStride, width, end - begin, channelCount,
+            alpha + begin * alphaStride, alphaStride, dst + begin * dstStride, dstStride);
+    });
 }
 
 SIMD_API void SimdAlphaBlendingUniform(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t alpha, uint8_t* dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AlphaBlendingUniform(src, srcStride, width, height, channelCount, alpha, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::AlphaBlendingUniform(src, srcStride, width, height, channelCount, alpha, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::AlphaBlendingUniform(src, srcStride, width, height, channelCount, alpha, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AlphaBlendingUniform(src, srcStride, width, height, channelCount, alpha, dst, dstStride);
-    else
-#endif
-        Base::AlphaBlendingUniform(src, srcStride, width, height, channelCount, alpha, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::AlphaBlendingUniform)> simdAlphaBlendingUniform = {
+        SIMD_AVX512BW_IMPL(AlphaBlendingUniform, 0) SIMD_AVX2_IMPL(AlphaBlendingUniform, Avx2::A)
+        SIMD_SSE2_IMPL(AlphaBlendingUniform, Sse2::A) SIMD_NEON_IMPL(AlphaBlendingUniform, Neon::A)
+        SIMD_BASE_IMPL(AlphaBlendingUniform) };
+
+    simdAlphaBlendingUniform(width)(src, srcStride, width, height, channelCount, alpha, dst, dstStride);
 }
 
 SIMD_API void SimdAlphaFilling(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * channel, size_t channelCount, const uint8_t * alpha, size_t alphaStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AlphaFilling(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::AlphaFilling(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::AlphaFilling(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::AlphaFilling(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AlphaFilling(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
-    else
-#endif
-        Base::AlphaFilling(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
+    const static Simd::Dispatch<decltype(&Base::AlphaFilling)> simdAlphaFilling = {
+        SIMD_AVX512BW_IMPL(AlphaFilling, 0) SIMD_AVX2_IMPL(AlphaFilling, Avx2::A)
+        SIMD_SSE41_IMPL(AlphaFilling, Sse41::A) SIMD_SSE2_IMPL(AlphaFilling, Sse2::A)
+        SIMD_NEON_IMPL(AlphaFilling, Neon::A) SIMD_BASE_IMPL(AlphaFilling) };
+
+    simdAlphaFilling(width)(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
 }
 
 SIMD_API void SimdAlphaPremultiply(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable)
-        Sse2::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::AlphaPremultiply)> simdAlphaPremultiply = {
+        SIMD_AVX512BW_IMPL(AlphaPremultiply, 0) SIMD_AVX2_IMPL(AlphaPremultiply, 0) SIMD_SSE41_IMPL(AlphaPremultiply, 0)
+        SIMD_SSE2_IMPL(AlphaPremultiply, 0) SIMD_NEON_IMPL(AlphaPremultiply, 0) SIMD_BASE_IMPL(AlphaPremultiply) };
+
+    simdAlphaPremultiply()(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdAlphaUnpremultiply(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AlphaUnpremultiply(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::AlphaUnpremultiply(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::AlphaUnpremultiply(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::AlphaUnpremultiply(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::AlphaUnpremultiply(src, srcStride, width, height, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::AlphaUnpremultiply)> simdAlphaUnpremultiply = {
+        SIMD_AVX512BW_IMPL(AlphaUnpremultiply, 0) SIMD_AVX2_IMPL(AlphaUnpremultiply, 0)
+        SIMD_SSE41_IMPL(AlphaUnpremultiply, 0) SIMD_NEON_IMPL(AlphaUnpremultiply, 0) SIMD_BASE_IMPL(AlphaUnpremultiply) };
+
+    simdAlphaUnpremultiply()(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                           uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-        Base::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
+    const static Simd::Dispatch<decltype(&Base::BackgroundGrowRangeSlow)> simdBackgroundGrowRangeSlow = {
+        SIMD_AVX512BW_IMPL(BackgroundGrowRangeSlow, 0) SIMD_AVX2_IMPL(BackgroundGrowRangeSlow, Avx2::A)
+        SIMD_SSE2_IMPL(BackgroundGrowRangeSlow, Sse2::A) SIMD_VMX_IMPL(BackgroundGrowRangeSlow, Vmx::A)
+        SIMD_NEON_IMPL(BackgroundGrowRangeSlow, Neon::A) SIMD_BASE_IMPL(BackgroundGrowRangeSlow) };
+
+    simdBackgroundGrowRangeSlow(width)(value, valueStride, width, height, lo, loStride, hi, hiStride);
 }
 
 SIMD_API void SimdBackgroundGrowRangeFast(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                           uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-        Base::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
+    const static Simd::Dispatch<decltype(&Base::BackgroundGrowRangeFast)> simdBackgroundGrowRangeFast = {
+        SIMD_AVX512BW_IMPL(BackgroundGrowRangeFast, 0) SIMD_AVX2_IMPL(BackgroundGrowRangeFast, Avx2::A)
+        SIMD_SSE2_IMPL(BackgroundGrowRangeFast, Sse2::A) SIMD_VMX_IMPL(BackgroundGrowRangeFast, Vmx::A)
+        SIMD_NEON_IMPL(BackgroundGrowRangeFast, Neon::A) SIMD_BASE_IMPL(BackgroundGrowRangeFast) };
+
+    simdBackgroundGrowRangeFast(width)(value, valueStride, width, height, lo, loStride, hi, hiStride);
 }
 
 SIMD_API void SimdBackgroundIncrementCount(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                            const uint8_t * loValue, size_t loValueStride, const uint8_t * hiValue, size_t hiValueStride,
                                            uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-    else
-#endif
-        Base::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
+    const static Simd::Dispatch<decltype(&Base::BackgroundIncrementCount)> simdBackgroundIncrementCount = {
+        SIMD_AVX512BW_IMPL(BackgroundIncrementCount, 0) SIMD_AVX2_IMPL(BackgroundIncrementCount, Avx2::A)
+        SIMD_SSE2_IMPL(BackgroundIncrementCount, Sse2::A) SIMD_VMX_IMPL(BackgroundIncrementCount, Vmx::A)
+        SIMD_NEON_IMPL(BackgroundIncrementCount, Neon::A) SIMD_BASE_IMPL(BackgroundIncrementCount) };
+
+    simdBackgroundIncrementCount(width)(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
 }
 
 SIMD_API void SimdBackgroundAdjustRange(uint8_t * loCount, size_t loCountStride, size_t width, size_t height,
                                         uint8_t * loValue, size_t loValueStride, uint8_t * hiCount, size_t hiCountStride,
                                         uint8_t * hiValue, size_t hiValueStride, uint8_t threshold)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-            hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-            hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-    else
-#endif
-        Base::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
+    const static Simd::Dispatch<decltype(&Base::BackgroundAdjustRange)> simdBackgroundAdjustRange = {
+        SIMD_AVX512BW_IMPL(BackgroundAdjustRange, 0) SIMD_AVX2_IMPL(BackgroundAdjustRange, Avx2::A)
+        SIMD_SSE2_IMPL(BackgroundAdjustRange, Sse2::A) SIMD_VMX_IMPL(BackgroundAdjustRange, Vmx::A)
+        SIMD_NEON_IMPL(BackgroundAdjustRange, Neon::A) SIMD_BASE_IMPL(BackgroundAdjustRange) };
+
+    simdBackgroundAdjustRange(width)(loCount, loCountStride, width, height, loValue, loValueStride,
         hiCount, hiCountStride, hiValue, hiValueStride, threshold);
 }
 
@@ -732,401 +576,146 @@ SIMD_API void SimdBackgroundAdjustRangeMasked(uint8_t * loCount, size_t loCountS
                                               uint8_t * loValue, size_t loValueStride, uint8_t * hiCount, size_t hiCountStride,
                                               uint8_t * hiValue, size_t hiValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride,hiValue, hiValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride,hiValue, hiValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride,hiValue, hiValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-            hiCount, hiCountStride, hiValue, hiValueStride, threshold, mask, maskStride);
-    else
-#endif
-        Base::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
+    const static Simd::Dispatch<decltype(&Base::BackgroundAdjustRangeMasked)> simdBackgroundAdjustRangeMasked = {
+        SIMD_AVX512BW_IMPL(BackgroundAdjustRangeMasked, 0) SIMD_AVX2_IMPL(BackgroundAdjustRangeMasked, Avx2::A)
+        SIMD_SSE2_IMPL(BackgroundAdjustRangeMasked, Sse2::A) SIMD_VMX_IMPL(BackgroundAdjustRangeMasked, Vmx::A)
+        SIMD_NEON_IMPL(BackgroundAdjustRangeMasked, Neon::A) SIMD_BASE_IMPL(BackgroundAdjustRangeMasked) };
+
+    simdBackgroundAdjustRangeMasked(width)(loCount, loCountStride, width, height, loValue, loValueStride,
         hiCount, hiCountStride, hiValue, hiValueStride, threshold, mask, maskStride);
 }
 
 SIMD_API void SimdBackgroundShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                        uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-        Base::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
+    const static Simd::Dispatch<decltype(&Base::BackgroundShiftRange)> simdBackgroundShiftRange = {
+        SIMD_AVX512BW_IMPL(BackgroundShiftRange, 0) SIMD_AVX2_IMPL(BackgroundShiftRange, Avx2::A)
+        SIMD_SSE2_IMPL(BackgroundShiftRange, Sse2::A) SIMD_VMX_IMPL(BackgroundShiftRange, Vmx::A)
+        SIMD_NEON_IMPL(BackgroundShiftRange, Neon::A) SIMD_BASE_IMPL(BackgroundShiftRange) };
+
+    simdBackgroundShiftRange(width)(value, valueStride, width, height, lo, loStride, hi, hiStride);
 }
 
 SIMD_API void SimdBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                              uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride, const uint8_t * mask, size_t maskStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-    else
-#endif
-        Base::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
+    const static Simd::Dispatch<decltype(&Base::BackgroundShiftRangeMasked)> simdBackgroundShiftRangeMasked = {
+        SIMD_AVX512BW_IMPL(BackgroundShiftRangeMasked, 0) SIMD_AVX2_IMPL(BackgroundShiftRangeMasked, Avx2::A)
+        SIMD_SSE2_IMPL(BackgroundShiftRangeMasked, Sse2::A) SIMD_VMX_IMPL(BackgroundShiftRangeMasked, Vmx::A)
+        SIMD_NEON_IMPL(BackgroundShiftRangeMasked, Neon::A) SIMD_BASE_IMPL(BackgroundShiftRangeMasked) };
+
+    simdBackgroundShiftRangeMasked(width)(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
 }
 
 SIMD_API void SimdBackgroundInitMask(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                      uint8_t index, uint8_t value, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-    else
-#endif
-        Base::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::BackgroundInitMask)> simdBackgroundInitMask = {
+        SIMD_AVX512BW_IMPL(BackgroundInitMask, 0) SIMD_AVX2_IMPL(BackgroundInitMask, Avx2::A)
+        SIMD_SSE2_IMPL(BackgroundInitMask, Sse2::A) SIMD_VMX_IMPL(BackgroundInitMask, Vmx::A)
+        SIMD_NEON_IMPL(BackgroundInitMask, Neon::A) SIMD_BASE_IMPL(BackgroundInitMask) };
+
+    simdBackgroundInitMask(width)(src, srcStride, width, height, index, value, dst, dstStride);
 }
 
 SIMD_API void SimdBase64Decode(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t* dstSize)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Base64Decode(src, srcSize, dst, dstSize);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::Base64Decode(src, srcSize, dst, dstSize);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::Base64Decode(src, srcSize, dst, dstSize);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::Base64Decode(src, srcSize, dst, dstSize);
-    else
-#endif
-    Base::Base64Decode(src, srcSize, dst, dstSize);
+    const static Simd::Dispatch<decltype(&Base::Base64Decode)> simdBase64Decode = {
+        SIMD_AVX512BW_IMPL(Base64Decode, 0) SIMD_AVX2_IMPL(Base64Decode, 0) SIMD_SSE41_IMPL(Base64Decode, 0)
+        SIMD_NEON_IMPL(Base64Decode, 0) SIMD_BASE_IMPL(Base64Decode) };
+
+    simdBase64Decode()(src, srcSize, dst, dstSize);
 }
 
 SIMD_API void SimdBase64Encode(const uint8_t* src, size_t size, uint8_t* dst)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Base64Encode(src, size, dst);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::Base64Encode(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::Base64Encode(src, size, dst);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::Base64Encode(src, size, dst);
-    else
-#endif
-        Base::Base64Encode(src, size, dst);
+    const static Simd::Dispatch<decltype(&Base::Base64Encode)> simdBase64Encode = {
+        SIMD_AVX512BW_IMPL(Base64Encode, 0) SIMD_AVX2_IMPL(Base64Encode, 0) SIMD_SSE41_IMPL(Base64Encode, 0)
+        SIMD_NEON_IMPL(Base64Encode, 0) SIMD_BASE_IMPL(Base64Encode) };
+
+    simdBase64Encode()(src, size, dst);
 }
 
 SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
-        Avx512bw::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A + 2)
-        Sse41::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
-    else
-#endif
-        Base::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+    const static Simd::Dispatch<decltype(&Base::BayerToBgr)> simdBayerToBgr = {
+        SIMD_AVX512BW_IMPL(BayerToBgr, Avx512bw::A + 2) SIMD_AVX2_IMPL(BayerToBgr, Avx2::A + 2)
+        SIMD_SSE41_IMPL(BayerToBgr, Sse41::A + 2) SIMD_NEON_IMPL(BayerToBgr, Neon::A + 2) SIMD_BASE_IMPL(BayerToBgr) };
+
+    simdBayerToBgr(width)(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
 }
 
 SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
-        Avx512bw::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
-    else
-#endif
-        Base::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+    const static Simd::Dispatch<decltype(&Base::BayerToBgra)> simdBayerToBgra = {
+        SIMD_AVX512BW_IMPL(BayerToBgra, Avx512bw::A + 2) SIMD_AVX2_IMPL(BayerToBgra, Avx2::A + 2)
+        SIMD_SSE2_IMPL(BayerToBgra, Sse2::A + 2) SIMD_NEON_IMPL(BayerToBgra, Neon::A + 2) SIMD_BASE_IMPL(BayerToBgra) };
+
+    simdBayerToBgra(width)(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
 }
 
 SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A)
-        Sse41::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
-    else
-#endif
-        Base::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
+    const static Simd::Dispatch<decltype(&Base::BgraToBayer)> simdBgraToBayer = {
+        SIMD_AVX512BW_IMPL(BgraToBayer, 0) SIMD_SSE41_IMPL(BgraToBayer, Sse41::A) SIMD_VMX_IMPL(BgraToBayer, Vmx::A)
+        SIMD_NEON_IMPL(BgraToBayer, Neon::A) SIMD_BASE_IMPL(BgraToBayer) };
+
+    simdBgraToBayer(width)(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
 }
 
 SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A)
-        Sse41::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
-    else
-#endif
-        Base::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
+    typedef void(*SimdBgraToBgrPtr) (const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride);
+    const static Simd::Dispatch<SimdBgraToBgrPtr> simdBgraToBgr = {
+        SIMD_AVX512BW_IMPL(BgraToBgr, 0) SIMD_AVX2_IMPL(BgraToBgr, Avx2::F) SIMD_SSE41_IMPL(BgraToBgr, Sse41::A)
+        SIMD_VMX_IMPL(BgraToBgr, Vmx::A) SIMD_NEON_IMPL(BgraToBgr, Neon::A) SIMD_BASE_IMPL(BgraToBgr) };
+
+    simdBgraToBgr(width)(bgra, width, height, bgraStride, bgr, bgrStride);
+}
+
+static void BgraToGrayBand(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
+{
+    const static Simd::Dispatch<decltype(&Base::BgraToGray)> simdBgraToGrayBand = {
+        SIMD_AVX512BW_IMPL(BgraToGray, 0) SIMD_AVX2_IMPL(BgraToGray, Avx2::A) SIMD_SSE2_IMPL(BgraToGray, Sse2::A)
+        SIMD_VMX_IMPL(BgraToGray, Vmx::A) SIMD_NEON_IMPL(BgraToGray, Neon::HA) SIMD_BASE_IMPL(BgraToGray) };
+
+    simdBgraToGrayBand(width)(bgra, width, height, bgraStride, gray, grayStride);
 }
 
 SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
-#endif
-        Base::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
+    ParallelRows(height, width * height, 1, [=](size_t begin, size_t end)
+    {
+        BgraToGrayBand(bgra + begin * bgraStride, width, end - begin, bgraStride, gray + begin * grayStride, grayStride);
+    });
 }
 
 SIMD_API void SimdBgraToRgb(const uint8_t* bgra, size_t width, size_t height, size_t bgraStride, uint8_t* rgb, size_t rgbStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
-    else
-#endif
-        Base::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
+    const static Simd::Dispatch<decltype(&Base::BgraToRgb)> simdBgraToRgb = {
+        SIMD_AVX512BW_IMPL(BgraToRgb, 0) SIMD_AVX2_IMPL(BgraToRgb, Avx2::F) SIMD_SSE41_IMPL(BgraToRgb, Sse41::A)
+        SIMD_NEON_IMPL(BgraToRgb, Neon::A) SIMD_BASE_IMPL(BgraToRgb) };
+
+    simdBgraToRgb(width)(bgra, width, height, bgraStride, rgb, rgbStride);
 }
 
 SIMD_API void SimdBgraToRgba(const uint8_t* bgra, size_t width, size_t height, size_t bgraStride, uint8_t* rgba, size_t rgbaStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToRgba(bgra, width, height, bgraStride, rgba, rgbaStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::BgraToRgba(bgra, width, height, bgraStride, rgba, rgbaStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::BgraToRgba(bgra, width, height, bgraStride, rgba, rgbaStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgraToRgba(bgra, width, height, bgraStride, rgba, rgbaStride);
-    else
-#endif
-        Base::BgraToRgba(bgra, width, height, bgraStride, rgba, rgbaStride);
+    const static Simd::Dispatch<decltype(&Base::BgraToRgba)> simdBgraToRgba = {
+        SIMD_AVX512BW_IMPL(BgraToRgba, 0) SIMD_AVX2_IMPL(BgraToRgba, Avx2::A) SIMD_SSE41_IMPL(BgraToRgba, Sse41::A)
+        SIMD_NEON_IMPL(BgraToRgba, Neon::A) SIMD_BASE_IMPL(BgraToRgba) };
+
+    simdBgraToRgba(width)(bgra, width, height, bgraStride, rgba, rgbaStride);
 }
 
 SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::DA)
-        Sse41::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-        Base::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    const static Simd::Dispatch<decltype(&Base::BgraToYuv420p)> simdBgraToYuv420p = {
+        SIMD_AVX512BW_IMPL(BgraToYuv420p, 0) SIMD_AVX2_IMPL(BgraToYuv420p, Avx2::DA)
+        SIMD_SSE41_IMPL(BgraToYuv420p, Sse41::DA) SIMD_SSE2_IMPL(BgraToYuv420p, Sse2::DA)
+        SIMD_VMX_IMPL(BgraToYuv420p, Vmx::DA) SIMD_NEON_IMPL(BgraToYuv420p, Neon::DA) SIMD_BASE_IMPL(BgraToYuv420p) };
+
+    simdBgraToYuv420p(width)(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
 SIMD_API void SimdBgraToYuv420pV2(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height,
@@ -1137,67 +726,22 @@ SIMD_API void SimdBgraToYuv420pV2(const uint8_t* bgra, size_t bgraStride, size_t
 
 SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::DA)
-        Sse41::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-        Base::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    const static Simd::Dispatch<decltype(&Base::BgraToYuv422p)> simdBgraToYuv422p = {
+        SIMD_AVX512BW_IMPL(BgraToYuv422p, 0) SIMD_AVX2_IMPL(BgraToYuv422p, Avx2::DA)
+        SIMD_SSE41_IMPL(BgraToYuv422p, Sse41::DA) SIMD_SSE2_IMPL(BgraToYuv422p, Sse2::DA)
+        SIMD_VMX_IMPL(BgraToYuv422p, Vmx::DA) SIMD_NEON_IMPL(BgraToYuv422p, Neon::DA) SIMD_BASE_IMPL(BgraToYuv422p) };
+
+    simdBgraToYuv422p(width)(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
 SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-        Base::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    const static Simd::Dispatch<decltype(&Base::BgraToYuv444p)> simdBgraToYuv444p = {
+        SIMD_AVX512BW_IMPL(BgraToYuv444p, 0) SIMD_AVX2_IMPL(BgraToYuv444p, Avx2::A)
+        SIMD_SSE2_IMPL(BgraToYuv444p, Sse2::A) SIMD_VMX_IMPL(BgraToYuv444p, Vmx::A)
+        SIMD_NEON_IMPL(BgraToYuv444p, Neon::A) SIMD_BASE_IMPL(BgraToYuv444p) };
+
+    simdBgraToYuv444p(width)(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
 SIMD_API void SimdBgraToYuv444pV2(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height, 
@@ -1209,153 +753,66 @@ SIMD_API void SimdBgraToYuv444pV2(const uint8_t* bgra, size_t bgraStride, size_t
 SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, 
     uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::DA)
-        Sse41::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::DA)
-        Sse2::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
-    else
-#endif
-        Base::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+    const static Simd::Dispatch<decltype(&Base::BgraToYuva420p)> simdBgraToYuva420p = {
+        SIMD_AVX512BW_IMPL(BgraToYuva420p, 0) SIMD_AVX2_IMPL(BgraToYuva420p, Avx2::DA)
+        SIMD_SSE41_IMPL(BgraToYuva420p, Sse41::DA) SIMD_SSE2_IMPL(BgraToYuva420p, Sse2::DA)
+        SIMD_NEON_IMPL(BgraToYuva420p, Neon::DA) SIMD_BASE_IMPL(BgraToYuva420p) };
+
+    simdBgraToYuva420p(width)(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
 }
 
 SIMD_API void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A)
-        Sse41::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
-    else
-#endif
-        Base::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
+    const static Simd::Dispatch<decltype(&Base::BgrToBayer)> simdBgrToBayer = {
+        SIMD_AVX512BW_IMPL(BgrToBayer, 0) SIMD_SSE41_IMPL(BgrToBayer, Sse41::A) SIMD_VMX_IMPL(BgrToBayer, Vmx::A)
+        SIMD_NEON_IMPL(BgrToBayer, Neon::A) SIMD_BASE_IMPL(BgrToBayer) };
+
+    simdBgrToBayer(width)(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
 }
 
 SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-    else
-#endif
+    typedef void(*SimdBgrToBgraPtr) (const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha);
+    const static Simd::Dispatch<SimdBgrToBgraPtr> simdBgrToBgra = {
+        SIMD_AVX512BW_IMPL(BgrToBgra, 0)
 #if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A)
-        Sse41::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-    else
+        SIMD_AVX2_IMPL(BgrToBgra, Avx2::A)
 #endif
-        Base::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+        SIMD_SSE41_IMPL(BgrToBgra, Sse41::A)
+        SIMD_VMX_IMPL(BgrToBgra, Vmx::A)
+        SIMD_NEON_IMPL(BgrToBgra, Neon::A)
+        SIMD_BASE_IMPL(BgrToBgra)
+    };
+
+    simdBgrToBgra(width)(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
 }
 
 SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
     const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
-#endif
-        Base::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
+    const static Simd::Dispatch<decltype(&Base::Bgr48pToBgra32)> simdBgr48pToBgra32 = {
+        SIMD_AVX512BW_IMPL(Bgr48pToBgra32, 0) SIMD_AVX2_IMPL(Bgr48pToBgra32, Avx2::HA)
+        SIMD_SSE2_IMPL(Bgr48pToBgra32, Sse2::HA) SIMD_VMX_IMPL(Bgr48pToBgra32, Vmx::HA)
+        SIMD_NEON_IMPL(Bgr48pToBgra32, Neon::A) SIMD_BASE_IMPL(Bgr48pToBgra32) };
+
+    simdBgr48pToBgra32(width)(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
 }
 
 SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
-#endif
+    const static Simd::Dispatch<decltype(&Base::BgrToGray)> simdBgrToGray = {
+        SIMD_AVX512BW_IMPL(BgrToGray, 0)
 #if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A)
-        Sse41::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
+        SIMD_AVX2_IMPL(BgrToGray, Avx2::A)
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
-#endif
-        Base::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
+        SIMD_SSE41_IMPL(BgrToGray, Sse41::A)
+        SIMD_SSE2_IMPL(BgrToGray, Sse2::A)
+        SIMD_VMX_IMPL(BgrToGray, Vmx::A)
+        SIMD_NEON_IMPL(BgrToGray, Neon::A)
+        SIMD_BASE_IMPL(BgrToGray)
+    };
+
+    simdBgrToGray(width)(bgr, width, height, bgrStride, gray, grayStride);
 }
 
 SIMD_API void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
@@ -1370,180 +827,63 @@ SIMD_API void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, siz
 
 SIMD_API void SimdBgrToRgb(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgb, size_t rgbStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToRgb(bgr, width, height, bgrStride, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToRgb(bgr, width, height, bgrStride, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::BgrToRgb(bgr, width, height, bgrStride, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToRgb(bgr, width, height, bgrStride, rgb, rgbStride);
-    else
-#endif
-        Base::BgrToRgb(bgr, width, height, bgrStride, rgb, rgbStride);
+    const static Simd::Dispatch<decltype(&Base::BgrToRgb)> simdBgrToRgb = {
+        SIMD_AVX512BW_IMPL(BgrToRgb, 0) SIMD_AVX2_IMPL(BgrToRgb, Avx2::A) SIMD_SSE41_IMPL(BgrToRgb, Sse41::A)
+        SIMD_NEON_IMPL(BgrToRgb, Neon::A) SIMD_BASE_IMPL(BgrToRgb) };
+
+    simdBgrToRgb(width)(bgr, width, height, bgrStride, rgb, rgbStride);
 }
 
 SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::DA)
-        Sse41::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-        Base::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    const static Simd::Dispatch<decltype(&Base::BgrToYuv420p)> simdBgrToYuv420p = {
+        SIMD_AVX512BW_IMPL(BgrToYuv420p, 0) SIMD_AVX2_IMPL(BgrToYuv420p, Avx2::DA)
+        SIMD_SSE41_IMPL(BgrToYuv420p, Sse41::DA) SIMD_VMX_IMPL(BgrToYuv420p, Vmx::DA)
+        SIMD_NEON_IMPL(BgrToYuv420p, Neon::DA) SIMD_BASE_IMPL(BgrToYuv420p) };
+
+    simdBgrToYuv420p(width)(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
 SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::DA)
-        Sse41::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-        Base::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    const static Simd::Dispatch<decltype(&Base::BgrToYuv422p)> simdBgrToYuv422p = {
+        SIMD_AVX512BW_IMPL(BgrToYuv422p, 0) SIMD_AVX2_IMPL(BgrToYuv422p, Avx2::DA)
+        SIMD_SSE41_IMPL(BgrToYuv422p, Sse41::DA) SIMD_VMX_IMPL(BgrToYuv422p, Vmx::DA)
+        SIMD_NEON_IMPL(BgrToYuv422p, Neon::DA) SIMD_BASE_IMPL(BgrToYuv422p) };
+
+    simdBgrToYuv422p(width)(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
 SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A)
-        Sse41::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-        Base::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    const static Simd::Dispatch<decltype(&Base::BgrToYuv444p)> simdBgrToYuv444p = {
+        SIMD_AVX512BW_IMPL(BgrToYuv444p, 0) SIMD_AVX2_IMPL(BgrToYuv444p, Avx2::A)
+        SIMD_SSE41_IMPL(BgrToYuv444p, Sse41::A) SIMD_VMX_IMPL(BgrToYuv444p, Vmx::A)
+        SIMD_NEON_IMPL(BgrToYuv444p, Neon::A) SIMD_BASE_IMPL(BgrToYuv444p) };
+
+    simdBgrToYuv444p(width)(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
 SIMD_API void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                   uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-        Base::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
+    const static Simd::Dispatch<decltype(&Base::Binarization)> simdBinarization = {
+        SIMD_AVX512BW_IMPL(Binarization, 0) SIMD_AVX2_IMPL(Binarization, Avx2::A) SIMD_SSE2_IMPL(Binarization, Sse2::A)
+        SIMD_VMX_IMPL(Binarization, Vmx::A) SIMD_NEON_IMPL(Binarization, Neon::A) SIMD_BASE_IMPL(Binarization) };
+
+    simdBinarization(width)(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
 }
 
 SIMD_API void SimdAveragingBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                            uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
                            uint8_t * dst, size_t dstStride, SimdCompareType compareType)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-        Base::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
+    const static Simd::Dispatch<decltype(&Base::AveragingBinarization)> simdAveragingBinarization = {
+        SIMD_AVX512BW_IMPL(AveragingBinarization, 0) SIMD_AVX2_IMPL(AveragingBinarization, Avx2::A)
+        SIMD_SSE2_IMPL(AveragingBinarization, Sse2::A) SIMD_VMX_IMPL(AveragingBinarization, Vmx::A)
+        SIMD_NEON_IMPL(AveragingBinarization, Neon::A) SIMD_BASE_IMPL(AveragingBinarization) };
+
+    simdAveragingBinarization(width)(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
 }
 
 SIMD_API void SimdAveragingBinarizationV2(const uint8_t* src, size_t srcStride, size_t width, size_t height,
@@ -1555,186 +895,67 @@ SIMD_API void SimdAveragingBinarizationV2(const uint8_t* src, size_t srcStride,
 SIMD_API void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
                                    uint8_t value, SimdCompareType compareType, uint32_t * count)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-    else
-#endif
-        Base::ConditionalCount8u(src, stride, width, height, value, compareType, count);
+    const static Simd::Dispatch<decltype(&Base::ConditionalCount8u)> simdConditionalCount8u = {
+        SIMD_AVX512BW_IMPL(ConditionalCount8u, 0) SIMD_AVX2_IMPL(ConditionalCount8u, Avx2::A)
+        SIMD_SSE2_IMPL(ConditionalCount8u, Sse2::A) SIMD_VMX_IMPL(ConditionalCount8u, Vmx::A)
+        SIMD_NEON_IMPL(ConditionalCount8u, Neon::A) SIMD_BASE_IMPL(ConditionalCount8u) };
+
+    simdConditionalCount8u(width)(src, stride, width, height, value, compareType, count);
 }
 
 SIMD_API void SimdConditionalCount16i(const uint8_t * src, size_t stride, size_t width, size_t height,
                                      int16_t value, SimdCompareType compareType, uint32_t * count)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-    else
-#endif
-        Base::ConditionalCount16i(src, stride, width, height, value, compareType, count);
+    const static Simd::Dispatch<decltype(&Base::ConditionalCount16i)> simdConditionalCount16i = {
+        SIMD_AVX512BW_IMPL(ConditionalCount16i, 0) SIMD_AVX2_IMPL(ConditionalCount16i, Avx2::HA)
+        SIMD_SSE2_IMPL(ConditionalCount16i, Sse2::HA) SIMD_VMX_IMPL(ConditionalCount16i, Vmx::HA)
+        SIMD_NEON_IMPL(ConditionalCount16i, Neon::HA) SIMD_BASE_IMPL(ConditionalCount16i) };
+
+    simdConditionalCount16i(width)(src, stride, width, height, value, compareType, count);
 }
 
 SIMD_API void SimdConditionalSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                  const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-        Base::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+    const static Simd::Dispatch<decltype(&Base::ConditionalSum)> simdConditionalSum = {
+        SIMD_AVX512BW_IMPL(ConditionalSum, 0) SIMD_AVX2_IMPL(ConditionalSum, Avx2::A)
+        SIMD_SSE2_IMPL(ConditionalSum, Sse2::A) SIMD_VMX_IMPL(ConditionalSum, Vmx::A)
+        SIMD_NEON_IMPL(ConditionalSum, Neon::A) SIMD_BASE_IMPL(ConditionalSum) };
+
+    simdConditionalSum(width)(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
 }
 
 SIMD_API void SimdConditionalSquareSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-        Base::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+    const static Simd::Dispatch<decltype(&Base::ConditionalSquareSum)> simdConditionalSquareSum = {
+        SIMD_AVX512BW_IMPL(ConditionalSquareSum, 0) SIMD_AVX2_IMPL(ConditionalSquareSum, Avx2::A)
+        SIMD_SSE2_IMPL(ConditionalSquareSum, Sse2::A) SIMD_VMX_IMPL(ConditionalSquareSum, Vmx::A)
+        SIMD_NEON_IMPL(ConditionalSquareSum, Neon::A) SIMD_BASE_IMPL(ConditionalSquareSum) };
+
+    simdConditionalSquareSum(width)(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
 }
 
 SIMD_API void SimdConditionalSquareGradientSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2)
-        Vmx::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-        Base::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+    const static Simd::Dispatch<decltype(&Base::ConditionalSquareGradientSum)> simdConditionalSquareGradientSum = {
+        SIMD_AVX512BW_IMPL(ConditionalSquareGradientSum, 0) SIMD_AVX2_IMPL(ConditionalSquareGradientSum, Avx2::A + 2)
+        SIMD_SSE2_IMPL(ConditionalSquareGradientSum, Sse2::A + 2)
+        SIMD_VMX_IMPL(ConditionalSquareGradientSum, Vmx::A + 2)
+        SIMD_NEON_IMPL(ConditionalSquareGradientSum, Neon::A + 2) SIMD_BASE_IMPL(ConditionalSquareGradientSum) };
+
+    simdConditionalSquareGradientSum(width)(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
 }
 
 SIMD_API void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, SimdCompareType compareType, uint8_t value, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if (Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-    else
-#endif
-        Base::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::ConditionalFill)> simdConditionalFill = {
+        SIMD_AVX512BW_IMPL(ConditionalFill, 0) SIMD_AVX2_IMPL(ConditionalFill, Avx2::A)
+        SIMD_SSE2_IMPL(ConditionalFill, Sse2::A) SIMD_VMX_IMPL(ConditionalFill, Vmx::A)
+        SIMD_NEON_IMPL(ConditionalFill, Neon::A) SIMD_BASE_IMPL(ConditionalFill) };
+
+    simdConditionalFill(width)(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
 }
 
 SIMD_API void SimdCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride)
@@ -1751,84 +972,34 @@ SIMD_API void SimdCopyFrame(const uint8_t * src, size_t srcStride, size_t width,
 SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
                     uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-    else
-#endif
-        Base::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
+    const static Simd::Dispatch<decltype(&Base::DeinterleaveUv)> simdDeinterleaveUv = {
+        SIMD_AVX512BW_IMPL(DeinterleaveUv, 0) SIMD_AVX2_IMPL(DeinterleaveUv, Avx2::A)
+        SIMD_SSE2_IMPL(DeinterleaveUv, Sse2::A) SIMD_VMX_IMPL(DeinterleaveUv, Vmx::A)
+        SIMD_NEON_IMPL(DeinterleaveUv, Neon::A) SIMD_BASE_IMPL(DeinterleaveUv) };
+
+    simdDeinterleaveUv(width)(uv, uvStride, width, height, u, uStride, v, vStride);
 }
 
 SIMD_API void SimdDeinterleaveBgr(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height,
     uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
-    else
-#endif
-        Base::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
+    const static Simd::Dispatch<decltype(&Base::DeinterleaveBgr)> simdDeinterleaveBgr = {
+        SIMD_AVX512BW_IMPL(DeinterleaveBgr, 0) SIMD_AVX2_IMPL(DeinterleaveBgr, Avx2::A)
+        SIMD_SSE41_IMPL(DeinterleaveBgr, Sse41::A) SIMD_NEON_IMPL(DeinterleaveBgr, Neon::A)
+        SIMD_BASE_IMPL(DeinterleaveBgr) };
+
+    simdDeinterleaveBgr(width)(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
 }
 
 SIMD_API void SimdDeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height,
     uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
-    else
-#endif
-        Base::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
+    const static Simd::Dispatch<decltype(&Base::DeinterleaveBgra)> simdDeinterleaveBgra = {
+        SIMD_AVX512BW_IMPL(DeinterleaveBgra, 0) SIMD_AVX2_IMPL(DeinterleaveBgra, Avx2::A)
+        SIMD_SSE41_IMPL(DeinterleaveBgra, Sse41::A) SIMD_NEON_IMPL(DeinterleaveBgra, Neon::A)
+        SIMD_BASE_IMPL(DeinterleaveBgra) };
+
+    simdDeinterleaveBgra(width)(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
 }
 
 SIMD_API void * SimdDetectionLoadStringXml(char * xml)
@@ -1861,317 +1032,127 @@ SIMD_API void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
     size_t width = right - left;
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-        Base::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::DetectionHaarDetect32fp)> simdDetectionHaarDetect32fp = {
+        SIMD_AVX512BW_IMPL(DetectionHaarDetect32fp, 0) SIMD_AVX2_IMPL(DetectionHaarDetect32fp, Avx2::A)
+        SIMD_SSE41_IMPL(DetectionHaarDetect32fp, Sse41::A) SIMD_NEON_IMPL(DetectionHaarDetect32fp, Neon::A)
+        SIMD_BASE_IMPL(DetectionHaarDetect32fp) };
+
+    simdDetectionHaarDetect32fp(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
 SIMD_API void SimdDetectionHaarDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
     size_t width = right - left;
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-        Base::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::DetectionHaarDetect32fi)> simdDetectionHaarDetect32fi = {
+        SIMD_AVX512BW_IMPL(DetectionHaarDetect32fi, 0) SIMD_AVX2_IMPL(DetectionHaarDetect32fi, Avx2::A)
+        SIMD_SSE41_IMPL(DetectionHaarDetect32fi, Sse41::A) SIMD_NEON_IMPL(DetectionHaarDetect32fi, Neon::A)
+        SIMD_BASE_IMPL(DetectionHaarDetect32fi) };
+
+    simdDetectionHaarDetect32fi(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
 SIMD_API void SimdDetectionLbpDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
     size_t width = right - left;
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-        Base::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::DetectionLbpDetect32fp)> simdDetectionLbpDetect32fp = {
+        SIMD_AVX512BW_IMPL(DetectionLbpDetect32fp, 0) SIMD_AVX2_IMPL(DetectionLbpDetect32fp, Avx2::A)
+        SIMD_SSE41_IMPL(DetectionLbpDetect32fp, Sse41::A) SIMD_NEON_IMPL(DetectionLbpDetect32fp, Neon::A)
+        SIMD_BASE_IMPL(DetectionLbpDetect32fp) };
+
+    simdDetectionLbpDetect32fp(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
 SIMD_API void SimdDetectionLbpDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
     size_t width = right - left;
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-        Base::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::DetectionLbpDetect32fi)> simdDetectionLbpDetect32fi = {
+        SIMD_AVX512BW_IMPL(DetectionLbpDetect32fi, 0) SIMD_AVX2_IMPL(DetectionLbpDetect32fi, Avx2::A)
+        SIMD_SSE41_IMPL(DetectionLbpDetect32fi, Sse41::A) SIMD_NEON_IMPL(DetectionLbpDetect32fi, Neon::A)
+        SIMD_BASE_IMPL(DetectionLbpDetect32fi) };
+
+    simdDetectionLbpDetect32fi(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
 SIMD_API void SimdDetectionLbpDetect16ip(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
     size_t width = right - left;
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-        Base::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::DetectionLbpDetect16ip)> simdDetectionLbpDetect16ip = {
+        SIMD_AVX512BW_IMPL(DetectionLbpDetect16ip, 0) SIMD_AVX2_IMPL(DetectionLbpDetect16ip, Avx2::A)
+        SIMD_SSE41_IMPL(DetectionLbpDetect16ip, Sse41::A) SIMD_NEON_IMPL(DetectionLbpDetect16ip, Neon::A)
+        SIMD_BASE_IMPL(DetectionLbpDetect16ip) };
+
+    simdDetectionLbpDetect16ip(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
 SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
     size_t width = right - left;
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-        Base::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::DetectionLbpDetect16ii)> simdDetectionLbpDetect16ii = {
+        SIMD_AVX512BW_IMPL(DetectionLbpDetect16ii, 0) SIMD_AVX2_IMPL(DetectionLbpDetect16ii, Avx2::A)
+        SIMD_SSE41_IMPL(DetectionLbpDetect16ii, Sse41::A) SIMD_NEON_IMPL(DetectionLbpDetect16ii, Neon::A)
+        SIMD_BASE_IMPL(DetectionLbpDetect16ii) };
+
+    simdDetectionLbpDetect16ii(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
 SIMD_API void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                  uint8_t * background, size_t backgroundStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-        Base::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
+    const static Simd::Dispatch<decltype(&Base::EdgeBackgroundGrowRangeSlow)> simdEdgeBackgroundGrowRangeSlow = {
+        SIMD_AVX512BW_IMPL(EdgeBackgroundGrowRangeSlow, 0) SIMD_AVX2_IMPL(EdgeBackgroundGrowRangeSlow, Avx2::A)
+        SIMD_SSE2_IMPL(EdgeBackgroundGrowRangeSlow, Sse2::A) SIMD_VMX_IMPL(EdgeBackgroundGrowRangeSlow, Vmx::A)
+        SIMD_NEON_IMPL(EdgeBackgroundGrowRangeSlow, Neon::A) SIMD_BASE_IMPL(EdgeBackgroundGrowRangeSlow) };
+
+    simdEdgeBackgroundGrowRangeSlow(width)(value, valueStride, width, height, background, backgroundStride);
 }
 
 SIMD_API void SimdEdgeBackgroundGrowRangeFast(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                  uint8_t * background, size_t backgroundStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-        Base::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
+    const static Simd::Dispatch<decltype(&Base::EdgeBackgroundGrowRangeFast)> simdEdgeBackgroundGrowRangeFast = {
+        SIMD_AVX512BW_IMPL(EdgeBackgroundGrowRangeFast, 0) SIMD_AVX2_IMPL(EdgeBackgroundGrowRangeFast, Avx2::A)
+        SIMD_SSE2_IMPL(EdgeBackgroundGrowRangeFast, Sse2::A) SIMD_VMX_IMPL(EdgeBackgroundGrowRangeFast, Vmx::A)
+        SIMD_NEON_IMPL(EdgeBackgroundGrowRangeFast, Neon::A) SIMD_BASE_IMPL(EdgeBackgroundGrowRangeFast) };
+
+    simdEdgeBackgroundGrowRangeFast(width)(value, valueStride, width, height, background, backgroundStride);
 }
 
 SIMD_API void SimdEdgeBackgroundIncrementCount(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                   const uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t * backgroundCount, size_t backgroundCountStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-    else
-#endif
-        Base::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
+    const static Simd::Dispatch<decltype(&Base::EdgeBackgroundIncrementCount)> simdEdgeBackgroundIncrementCount = {
+        SIMD_AVX512BW_IMPL(EdgeBackgroundIncrementCount, 0) SIMD_AVX2_IMPL(EdgeBackgroundIncrementCount, Avx2::A)
+        SIMD_SSE2_IMPL(EdgeBackgroundIncrementCount, Sse2::A) SIMD_VMX_IMPL(EdgeBackgroundIncrementCount, Vmx::A)
+        SIMD_NEON_IMPL(EdgeBackgroundIncrementCount, Neon::A) SIMD_BASE_IMPL(EdgeBackgroundIncrementCount) };
+
+    simdEdgeBackgroundIncrementCount(width)(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
 }
 
 SIMD_API void SimdEdgeBackgroundAdjustRange(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
                                uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-    else
-#endif
-        Base::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
+    const static Simd::Dispatch<decltype(&Base::EdgeBackgroundAdjustRange)> simdEdgeBackgroundAdjustRange = {
+        SIMD_AVX512BW_IMPL(EdgeBackgroundAdjustRange, 0) SIMD_AVX2_IMPL(EdgeBackgroundAdjustRange, Avx2::A)
+        SIMD_SSE2_IMPL(EdgeBackgroundAdjustRange, Sse2::A) SIMD_VMX_IMPL(EdgeBackgroundAdjustRange, Vmx::A)
+        SIMD_NEON_IMPL(EdgeBackgroundAdjustRange, Neon::A) SIMD_BASE_IMPL(EdgeBackgroundAdjustRange) };
+
+    simdEdgeBackgroundAdjustRange(width)(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
 }
 
 SIMD_API void SimdEdgeBackgroundAdjustRangeMasked(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
                                uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-    else
-#endif
-        Base::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
+    const static Simd::Dispatch<decltype(&Base::EdgeBackgroundAdjustRangeMasked)> simdEdgeBackgroundAdjustRangeMasked = {
+        SIMD_AVX512BW_IMPL(EdgeBackgroundAdjustRangeMasked, 0) SIMD_AVX2_IMPL(EdgeBackgroundAdjustRangeMasked, Avx2::A)
+        SIMD_SSE2_IMPL(EdgeBackgroundAdjustRangeMasked, Sse2::A) SIMD_VMX_IMPL(EdgeBackgroundAdjustRangeMasked, Vmx::A)
+        SIMD_NEON_IMPL(EdgeBackgroundAdjustRangeMasked, Neon::A) SIMD_BASE_IMPL(EdgeBackgroundAdjustRangeMasked) };
+
+    simdEdgeBackgroundAdjustRangeMasked(width)(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
 }
 
 SIMD_API void SimdEdgeBackgroundShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height,
@@ -2183,32 +1164,12 @@ SIMD_API void SimdEdgeBackgroundShiftRange(const uint8_t * value, size_t valueSt
 SIMD_API void SimdEdgeBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                               uint8_t * background, size_t backgroundStride, const uint8_t * mask, size_t maskStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-    else
-#endif
-        Base::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
+    const static Simd::Dispatch<decltype(&Base::EdgeBackgroundShiftRangeMasked)> simdEdgeBackgroundShiftRangeMasked = {
+        SIMD_AVX512BW_IMPL(EdgeBackgroundShiftRangeMasked, 0) SIMD_AVX2_IMPL(EdgeBackgroundShiftRangeMasked, Avx2::A)
+        SIMD_SSE2_IMPL(EdgeBackgroundShiftRangeMasked, Sse2::A) SIMD_VMX_IMPL(EdgeBackgroundShiftRangeMasked, Vmx::A)
+        SIMD_NEON_IMPL(EdgeBackgroundShiftRangeMasked, Neon::A) SIMD_BASE_IMPL(EdgeBackgroundShiftRangeMasked) };
+
+    simdEdgeBackgroundShiftRangeMasked(width)(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
 }
 
 SIMD_API void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value)
@@ -2224,387 +1185,239 @@ SIMD_API void SimdFillFrame(uint8_t * dst, size_t stride, size_t width, size_t h
 
 SIMD_API void SimdFillBgr(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::FillBgr(dst, stride, width, height, blue, green, red);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::FillBgr(dst, stride, width, height, blue, green, red);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::FillBgr(dst, stride, width, height, blue, green, red);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::FillBgr(dst, stride, width, height, blue, green, red);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::FillBgr(dst, stride, width, height, blue, green, red);
-    else
-#endif
-        Base::FillBgr(dst, stride, width, height, blue, green, red);
+    const static Simd::Dispatch<decltype(&Base::FillBgr)> simdFillBgr = {
+        SIMD_AVX512BW_IMPL(FillBgr, 0) SIMD_AVX2_IMPL(FillBgr, Avx2::A) SIMD_SSE2_IMPL(FillBgr, Sse2::A)
+        SIMD_VMX_IMPL(FillBgr, Vmx::A) SIMD_NEON_IMPL(FillBgr, Neon::A) SIMD_BASE_IMPL(FillBgr) };
+
+    simdFillBgr(width)(dst, stride, width, height, blue, green, red);
 }
 
 SIMD_API void SimdFillBgra(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::F)
-        Avx2::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::F)
-        Sse2::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::F)
-        Vmx::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
-#endif
-        Base::FillBgra(dst, stride, width, height, blue, green, red, alpha);
+    const static Simd::Dispatch<decltype(&Base::FillBgra)> simdFillBgra = {
+        SIMD_AVX512BW_IMPL(FillBgra, 0) SIMD_AVX2_IMPL(FillBgra, Avx2::F) SIMD_SSE2_IMPL(FillBgra, Sse2::F)
+        SIMD_VMX_IMPL(FillBgra, Vmx::F) SIMD_NEON_IMPL(FillBgra, Neon::F) SIMD_BASE_IMPL(FillBgra) };
+
+    simdFillBgra(width)(dst, stride, width, height, blue, green, red, alpha);
 }
 
 SIMD_API void SimdFillPixel(uint8_t * dst, size_t stride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::FillPixel(dst, stride, width, height, pixel, pixelSize);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::FillPixel(dst, stride, width, height, pixel, pixelSize);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::FillPixel(dst, stride, width, height, pixel, pixelSize);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::FillPixel(dst, stride, width, height, pixel, pixelSize);
-    else
-#endif
-        Base::FillPixel(dst, stride, width, height, pixel, pixelSize);
+    const static Simd::Dispatch<decltype(&Base::FillPixel)> simdFillPixel = {
+        SIMD_AVX512BW_IMPL(FillPixel, 0) SIMD_AVX2_IMPL(FillPixel, Avx2::A) SIMD_SSE2_IMPL(FillPixel, Sse2::A)
+        SIMD_NEON_IMPL(FillPixel, Neon::A) SIMD_BASE_IMPL(FillPixel) };
+
+    simdFillPixel(width)(dst, stride, width, height, pixel, pixelSize);
 }
 
 SIMD_API void SimdFill32f(float * dst, size_t size, const float * value)
 {
     typedef void(*SimdFill32fPtr) (float * dst, size_t size, const float * value);
-    const static SimdFill32fPtr simdFill32f = SIMD_FUNC4(Fill32f, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdFill32fPtr> simdFill32f = {
+        SIMD_AVX512BW_IMPL(Fill32f, 0) SIMD_AVX_IMPL(Fill32f, 0) SIMD_SSE2_IMPL(Fill32f, 0) SIMD_NEON_IMPL(Fill32f, 0)
+        SIMD_BASE_IMPL(Fill32f) };
 
-    simdFill32f(dst, size, value);
+    simdFill32f()(dst, size, value);
 }
 
 SIMD_API void SimdFloat32ToBFloat16(const float* src, size_t size, uint16_t* dst)
 {
     typedef void(*SimdFloat32ToBFloat16Ptr) (const float* src, size_t size, uint16_t* dst);
-    const static SimdFloat32ToBFloat16Ptr simdFloat32ToBFloat16 = SIMD_FUNC4(Float32ToBFloat16, SIMD_AVX512BF16_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    const static Simd::Dispatch<SimdFloat32ToBFloat16Ptr> simdFloat32ToBFloat16 = {
+        SIMD_AVX512BF16_IMPL(Float32ToBFloat16, 0) SIMD_AVX512BW_IMPL(Float32ToBFloat16, 0)
+        SIMD_AVX2_IMPL(Float32ToBFloat16, 0) SIMD_SSE41_IMPL(Float32ToBFloat16, 0) SIMD_BASE_IMPL(Float32ToBFloat16) };
 
-    simdFloat32ToBFloat16(src, size, dst);
+    simdFloat32ToBFloat16()(src, size, dst);
 }
 
 SIMD_API void SimdBFloat16ToFloat32(const uint16_t* src, size_t size, float* dst)
 {
     typedef void(*SimdBFloat16ToFloat32Ptr) (const uint16_t* src, size_t size, float* dst);
-    const static SimdBFloat16ToFloat32Ptr simdBFloat16ToFloat32 = SIMD_FUNC3(BFloat16ToFloat32, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    const static Simd::Dispatch<SimdBFloat16ToFloat32Ptr> simdBFloat16ToFloat32 = {
+        SIMD_AVX512BW_IMPL(BFloat16ToFloat32, 0) SIMD_AVX2_IMPL(BFloat16ToFloat32, 0)
+        SIMD_SSE41_IMPL(BFloat16ToFloat32, 0) SIMD_BASE_IMPL(BFloat16ToFloat32) };
 
-    simdBFloat16ToFloat32(src, size, dst);
+    simdBFloat16ToFloat32()(src, size, dst);
 }
 
 SIMD_API void SimdFloat32ToFloat16(const float * src, size_t size, uint16_t * dst)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Float32ToFloat16(src, size, dst);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::Float32ToFloat16(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::Float32ToFloat16(src, size, dst);
-    else
-#endif
+    const static Simd::Dispatch<decltype(&Base::Float32ToFloat16)> simdFloat32ToFloat16 = {
+        SIMD_AVX512BW_IMPL(Float32ToFloat16, 0)
+        SIMD_AVX2_IMPL(Float32ToFloat16, Avx2::F)
+        SIMD_SSE41_IMPL(Float32ToFloat16, 0)
 #if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && size >= Neon::F)
-        Neon::Float32ToFloat16(src, size, dst);
-    else
+        SIMD_NEON_IMPL(Float32ToFloat16, Neon::F)
 #endif
-        Base::Float32ToFloat16(src, size, dst);
+        SIMD_BASE_IMPL(Float32ToFloat16)
+    };
+
+    simdFloat32ToFloat16(size)(src, size, dst);
 }
 
 SIMD_API void SimdFloat16ToFloat32(const uint16_t * src, size_t size, float * dst)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Float16ToFloat32(src, size, dst);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::Float16ToFloat32(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::Float16ToFloat32(src, size, dst);
-    else
-#endif
+    const static Simd::Dispatch<decltype(&Base::Float16ToFloat32)> simdFloat16ToFloat32 = {
+        SIMD_AVX512BW_IMPL(Float16ToFloat32, 0)
+        SIMD_AVX2_IMPL(Float16ToFloat32, Avx2::F)
+        SIMD_SSE41_IMPL(Float16ToFloat32, 0)
 #if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && size >= Neon::F)
-        Neon::Float16ToFloat32(src, size, dst);
-    else
+        SIMD_NEON_IMPL(Float16ToFloat32, Neon::F)
 #endif
-        Base::Float16ToFloat32(src, size, dst);
+        SIMD_BASE_IMPL(Float16ToFloat32)
+    };
+
+    simdFloat16ToFloat32(size)(src, size, dst);
 }
 
 SIMD_API void SimdSquaredDifferenceSum16f(const uint16_t * a, const uint16_t * b, size_t size, float * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SquaredDifferenceSum16f(a, b, size, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::SquaredDifferenceSum16f(a, b, size, sum);
-    else
-#endif
+    const static Simd::Dispatch<decltype(&Base::SquaredDifferenceSum16f)> simdSquaredDifferenceSum16f = {
+        SIMD_AVX512BW_IMPL(SquaredDifferenceSum16f, 0)
+        SIMD_AVX2_IMPL(SquaredDifferenceSum16f, Avx2::F)
 #if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && size >= Neon::F)
-        Neon::SquaredDifferenceSum16f(a, b, size, sum);
-    else
+        SIMD_NEON_IMPL(SquaredDifferenceSum16f, Neon::F)
 #endif
-        Base::SquaredDifferenceSum16f(a, b, size, sum);
+        SIMD_BASE_IMPL(SquaredDifferenceSum16f)
+    };
+
+    simdSquaredDifferenceSum16f(size)(a, b, size, sum);
 }
 
 SIMD_API void SimdCosineDistance16f(const uint16_t * a, const uint16_t * b, size_t size, float * distance)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::CosineDistance16f(a, b, size, distance);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::CosineDistance16f(a, b, size, distance);
-    else
-#endif
+    const static Simd::Dispatch<decltype(&Base::CosineDistance16f)> simdCosineDistance16f = {
+        SIMD_AVX512BW_IMPL(CosineDistance16f, 0)
+        SIMD_AVX2_IMPL(CosineDistance16f, Avx2::F)
 #if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && size >= Neon::F)
-        Neon::CosineDistance16f(a, b, size, distance);
-    else
+        SIMD_NEON_IMPL(CosineDistance16f, Neon::F)
 #endif
-        Base::CosineDistance16f(a, b, size, distance);
+        SIMD_BASE_IMPL(CosineDistance16f)
+    };
+
+    simdCosineDistance16f(size)(a, b, size, distance);
 }
 
 SIMD_API void SimdCosineDistancesMxNa16f(size_t M, size_t N, size_t K, const uint16_t * const * A, const uint16_t * const * B, float * distances)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && K >= Avx512bw::F)
-        Avx512bw::CosineDistancesMxNa16f(M, N, K, A, B, distances);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && K >= Avx2::F)
-        Avx2::CosineDistancesMxNa16f(M, N, K, A, B, distances);
-    else
-#endif
+    const static Simd::Dispatch<decltype(&Base::CosineDistancesMxNa16f)> simdCosineDistancesMxNa16f = {
+        SIMD_AVX512BW_IMPL(CosineDistancesMxNa16f, Avx512bw::F)
+        SIMD_AVX2_IMPL(CosineDistancesMxNa16f, Avx2::F)
 #if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && K >= Neon::F)
-        Neon::CosineDistancesMxNa16f(M, N, K, A, B, distances);
-    else
+        SIMD_NEON_IMPL(CosineDistancesMxNa16f, Neon::F)
 #endif
-        Base::CosineDistancesMxNa16f(M, N, K, A, B, distances);
+        SIMD_BASE_IMPL(CosineDistancesMxNa16f)
+    };
+
+    simdCosineDistancesMxNa16f(K)(M, N, K, A, B, distances);
 }
 
 SIMD_API void SimdCosineDistancesMxNp16f(size_t M, size_t N, size_t K, const uint16_t* A, const uint16_t* B, float* distances)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && K >= Avx512bw::F)
-        Avx512bw::CosineDistancesMxNp16f(M, N, K, A, B, distances);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && K >= Avx2::F)
-        Avx2::CosineDistancesMxNp16f(M, N, K, A, B, distances);
-    else
-#endif
+    const static Simd::Dispatch<decltype(&Base::CosineDistancesMxNp16f)> simdCosineDistancesMxNp16f = {
+        SIMD_AVX512BW_IMPL(CosineDistancesMxNp16f, Avx512bw::F)
+        SIMD_AVX2_IMPL(CosineDistancesMxNp16f, Avx2::F)
 #if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && K >= Neon::F)
-        Neon::CosineDistancesMxNp16f(M, N, K, A, B, distances);
-    else
+        SIMD_NEON_IMPL(CosineDistancesMxNp16f, Neon::F)
 #endif
-        Base::CosineDistancesMxNp16f(M, N, K, A, B, distances);
+        SIMD_BASE_IMPL(CosineDistancesMxNp16f)
+    };
+
+    simdCosineDistancesMxNp16f(K)(M, N, K, A, B, distances);
 }
 
 SIMD_API void SimdVectorNormNa16f(size_t N, size_t K, const uint16_t* const* A, float* norms)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && K >= Avx512bw::F)
-        Avx512bw::VectorNormNa16f(N, K, A, norms);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && K >= Avx2::F)
-        Avx2::VectorNormNa16f(N, K, A, norms);
-    else
-#endif
+    const static Simd::Dispatch<decltype(&Base::VectorNormNa16f)> simdVectorNormNa16f = {
+        SIMD_AVX512BW_IMPL(VectorNormNa16f, Avx512bw::F)
+        SIMD_AVX2_IMPL(VectorNormNa16f, Avx2::F)
 #if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && K >= Neon::F)
-        Neon::VectorNormNa16f(N, K, A, norms);
-    else
+        SIMD_NEON_IMPL(VectorNormNa16f, Neon::F)
 #endif
-        return Base::VectorNormNa16f(N, K, A, norms);
+        SIMD_BASE_IMPL(VectorNormNa16f)
+    };
+
+    return simdVectorNormNa16f(K)(N, K, A, norms);
 }
 
 SIMD_API void SimdVectorNormNp16f(size_t N, size_t K, const uint16_t* A, float* norms)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && K >= Avx512bw::F)
-        Avx512bw::VectorNormNp16f(N, K, A, norms);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && K >= Avx2::F)
-        Avx2::VectorNormNp16f(N, K, A, norms);
-    else
-#endif
+    const static Simd::Dispatch<decltype(&Base::VectorNormNp16f)> simdVectorNormNp16f = {
+        SIMD_AVX512BW_IMPL(VectorNormNp16f, Avx512bw::F)
+        SIMD_AVX2_IMPL(VectorNormNp16f, Avx2::F)
 #if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && K >= Neon::F)
-        Neon::VectorNormNp16f(N, K, A, norms);
-    else
+        SIMD_NEON_IMPL(VectorNormNp16f, Neon::F)
 #endif
-        return Base::VectorNormNp16f(N, K, A, norms);
+        SIMD_BASE_IMPL(VectorNormNp16f)
+    };
+
+    return simdVectorNormNp16f(K)(N, K, A, norms);
 }
 
 SIMD_API void SimdFloat32ToUint8(const float * src, size_t size, const float * lower, const float * upper, uint8_t * dst)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Float32ToUint8(src, size, lower, upper, dst);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::A)
-        Avx2::Float32ToUint8(src, size, lower, upper, dst);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && size >= Sse2::A)
-        Sse2::Float32ToUint8(src, size, lower, upper, dst);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::Float32ToUint8(src, size, lower, upper, dst);
-    else
-#endif
-        Base::Float32ToUint8(src, size, lower, upper, dst);
+    const static Simd::Dispatch<decltype(&Base::Float32ToUint8)> simdFloat32ToUint8 = {
+        SIMD_AVX512BW_IMPL(Float32ToUint8, 0) SIMD_AVX2_IMPL(Float32ToUint8, Avx2::A)
+        SIMD_SSE2_IMPL(Float32ToUint8, Sse2::A) SIMD_NEON_IMPL(Float32ToUint8, Neon::A) SIMD_BASE_IMPL(Float32ToUint8) };
+
+    simdFloat32ToUint8(size)(src, size, lower, upper, dst);
 }
 
 SIMD_API void SimdUint8ToFloat32(const uint8_t * src, size_t size, const float * lower, const float * upper, float * dst)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Uint8ToFloat32(src, size, lower, upper, dst);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::HA)
-        Avx2::Uint8ToFloat32(src, size, lower, upper, dst);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && size >= Sse2::A)
-        Sse2::Uint8ToFloat32(src, size, lower, upper, dst);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::Uint8ToFloat32(src, size, lower, upper, dst);
-    else
-#endif
-        Base::Uint8ToFloat32(src, size, lower, upper, dst);
+    const static Simd::Dispatch<decltype(&Base::Uint8ToFloat32)> simdUint8ToFloat32 = {
+        SIMD_AVX512BW_IMPL(Uint8ToFloat32, 0) SIMD_AVX2_IMPL(Uint8ToFloat32, Avx2::HA)
+        SIMD_SSE2_IMPL(Uint8ToFloat32, Sse2::A) SIMD_NEON_IMPL(Uint8ToFloat32, Neon::A) SIMD_BASE_IMPL(Uint8ToFloat32) };
+
+    simdUint8ToFloat32(size)(src, size, lower, upper, dst);
 }
 
 SIMD_API void SimdCosineDistance32f(const float * a, const float * b, size_t size, float * distance)
 {
     typedef void(*SimdCosineDistance32fPtr) (const float * a, const float * b, size_t size, float * distance);
-    const static SimdCosineDistance32fPtr simdCosineDistance32f = SIMD_FUNC5(CosineDistance32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdCosineDistance32fPtr> simdCosineDistance32f = {
+        SIMD_AVX512BW_IMPL(CosineDistance32f, 0) SIMD_AVX2_IMPL(CosineDistance32f, 0)
+        SIMD_AVX_IMPL(CosineDistance32f, 0) SIMD_SSE2_IMPL(CosineDistance32f, 0) SIMD_NEON_IMPL(CosineDistance32f, 0)
+        SIMD_BASE_IMPL(CosineDistance32f) };
+
+    simdCosineDistance32f()(a, b, size, distance);
+}
+
+static void GaussianBlur3x3Band(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                     size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+    typedef void(*SimdGaussianBlur3x3BandPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+    const static Simd::Dispatch<SimdGaussianBlur3x3BandPtr> simdGaussianBlur3x3Band = {
+        SIMD_AVX512BW_IMPL(GaussianBlur3x3, Avx512bw::A) SIMD_AVX2_IMPL(GaussianBlur3x3, Avx2::A)
+        SIMD_SSE41_IMPL(GaussianBlur3x3, Sse41::A) SIMD_SSE2_IMPL(GaussianBlur3x3, Sse2::A)
+        SIMD_VMX_IMPL(GaussianBlur3x3, Vmx::A) SIMD_NEON_IMPL(GaussianBlur3x3, Neon::A) SIMD_BASE_IMPL(GaussianBlur3x3) };
 
-    simdCosineDistance32f(a, b, size, distance);
+    simdGaussianBlur3x3Band((width - 1)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
 SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                      size_t channelCount, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-        Avx512bw::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && (width - 1)*channelCount >= Sse41::A)
-        Sse41::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-        Base::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    ParallelFilterRows(src, srcStride, height, width * height, 1, dst, dstStride, width * channelCount,
+        [=](const uint8_t * bandSrc, size_t bandHeight, uint8_t * bandDst, size_t bandDstStride)
+    {
+        GaussianBlur3x3Band(bandSrc, srcStride, width, bandHeight, channelCount, bandDst, bandDstStride);
+    });
 }
 
 SIMD_API void* SimdGaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
 {
     typedef void* (*SimdGaussianBlurInitPtr) (size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
-    const static SimdGaussianBlurInitPtr simdGaussianBlurInit = SIMD_FUNC4(GaussianBlurInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdGaussianBlurInitPtr> simdGaussianBlurInit = {
+        SIMD_AVX512BW_IMPL(GaussianBlurInit, 0) SIMD_AVX2_IMPL(GaussianBlurInit, 0) SIMD_SSE41_IMPL(GaussianBlurInit, 0)
+        SIMD_NEON_IMPL(GaussianBlurInit, 0) SIMD_BASE_IMPL(GaussianBlurInit) };
 
-    return simdGaussianBlurInit(width, height, channels, sigma, epsilon);
+    return simdGaussianBlurInit()(width, height, channels, sigma, epsilon);
 }
 
 SIMD_API void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
 {
+    Base::ThreadBudgetScope budget(filter);
     ((GaussianBlur*)filter)->Run(src, srcStride, dst, dstStride);
 }
 
@@ -2612,106 +1425,49 @@ typedef void(*SimdGemm32fPtr) (size_t M, size_t N, size_t K, const float * alpha
 
 SIMD_API void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
 {
-    const static SimdGemm32fPtr simdGemm32fNN = SIMD_FUNC5(Gemm32fNN, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdGemm32fPtr> simdGemm32fNN = {
+        SIMD_AVX512BW_IMPL(Gemm32fNN, 0) SIMD_AVX2_IMPL(Gemm32fNN, 0) SIMD_AVX_IMPL(Gemm32fNN, 0)
+        SIMD_SSE2_IMPL(Gemm32fNN, 0) SIMD_NEON_IMPL(Gemm32fNN, 0) SIMD_BASE_IMPL(Gemm32fNN) };
 
-    simdGemm32fNN(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+    simdGemm32fNN()(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
 {
-    const static SimdGemm32fPtr simdGemm32fNT = SIMD_FUNC5(Gemm32fNT, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdGemm32fPtr> simdGemm32fNT = {
+        SIMD_AVX512BW_IMPL(Gemm32fNT, 0) SIMD_AVX2_IMPL(Gemm32fNT, 0) SIMD_AVX_IMPL(Gemm32fNT, 0)
+        SIMD_SSE41_IMPL(Gemm32fNT, 0) SIMD_NEON_IMPL(Gemm32fNT, 0) SIMD_BASE_IMPL(Gemm32fNT) };
 
-    simdGemm32fNT(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+    simdGemm32fNT()(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A)
-        Sse41::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-    else
-#endif
-        Base::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
+    const static Simd::Dispatch<decltype(&Base::GrayToBgr)> simdGrayToBgr = {
+        SIMD_AVX512BW_IMPL(GrayToBgr, 0) SIMD_AVX2_IMPL(GrayToBgr, Avx2::A) SIMD_SSE41_IMPL(GrayToBgr, Sse41::A)
+        SIMD_VMX_IMPL(GrayToBgr, Vmx::A) SIMD_NEON_IMPL(GrayToBgr, Neon::A) SIMD_BASE_IMPL(GrayToBgr) };
+
+    simdGrayToBgr(width)(gray, width, height, grayStride, bgr, bgrStride);
 }
 
 SIMD_API void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-    else
-#endif
-        Base::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+    const static Simd::Dispatch<decltype(&Base::GrayToBgra)> simdGrayToBgra = {
+        SIMD_AVX512BW_IMPL(GrayToBgra, 0) SIMD_AVX2_IMPL(GrayToBgra, Avx2::A) SIMD_SSE2_IMPL(GrayToBgra, Sse2::A)
+        SIMD_VMX_IMPL(GrayToBgra, Vmx::A) SIMD_NEON_IMPL(GrayToBgra, Neon::A) SIMD_BASE_IMPL(GrayToBgra) };
+
+    simdGrayToBgra(width)(gray, width, height, grayStride, bgra, bgraStride, alpha);
 }
 
 SIMD_API void SimdAbsSecondDerivativeHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, size_t step, size_t indent, uint32_t * histogram)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A + 2 * indent)
-        Avx512bw::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2*indent)
-        Avx2::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2*indent)
-        Sse2::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2*indent)
-        Vmx::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2 * indent)
-        Neon::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
-    else
-#endif
-        Base::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
+    const static Simd::Dispatch<decltype(&Base::AbsSecondDerivativeHistogram)> simdAbsSecondDerivativeHistogram = {
+        SIMD_AVX512BW_IMPL(AbsSecondDerivativeHistogram, Avx512bw::A)
+        SIMD_AVX2_IMPL(AbsSecondDerivativeHistogram, Avx2::A) SIMD_SSE2_IMPL(AbsSecondDerivativeHistogram, Sse2::A)
+        SIMD_VMX_IMPL(AbsSecondDerivativeHistogram, Vmx::A) SIMD_NEON_IMPL(AbsSecondDerivativeHistogram, Neon::A)
+        SIMD_BASE_IMPL(AbsSecondDerivativeHistogram) };
+
+    simdAbsSecondDerivativeHistogram(width > 2 * indent ? width - 2 * indent : 0)(src, width, height, stride, step, indent, histogram);
 }
 
 SIMD_API void SimdHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, uint32_t * histogram)
@@ -2722,58 +1478,23 @@ SIMD_API void SimdHistogram(const uint8_t *src, size_t width, size_t height, siz
 SIMD_API void SimdHistogramMasked(const uint8_t *src, size_t srcStride, size_t width, size_t height, 
                                   const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-    else
-#endif
-        Base::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
+    const static Simd::Dispatch<decltype(&Base::HistogramMasked)> simdHistogramMasked = {
+        SIMD_AVX512BW_IMPL(HistogramMasked, 0) SIMD_AVX2_IMPL(HistogramMasked, Avx2::A)
+        SIMD_SSE2_IMPL(HistogramMasked, Sse2::A) SIMD_VMX_IMPL(HistogramMasked, Vmx::A)
+        SIMD_NEON_IMPL(HistogramMasked, Neon::A) SIMD_BASE_IMPL(HistogramMasked) };
+
+    simdHistogramMasked(width)(src, srcStride, width, height, mask, maskStride, index, histogram);
 }
 
 SIMD_API void SimdHistogramConditional(const uint8_t * src, size_t srcStride, size_t width, size_t height,
     const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint32_t * histogram)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
-    else
-#endif
-        Base::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
+    const static Simd::Dispatch<decltype(&Base::HistogramConditional)> simdHistogramConditional = {
+        SIMD_AVX512BW_IMPL(HistogramConditional, 0) SIMD_AVX2_IMPL(HistogramConditional, Avx2::A)
+        SIMD_SSE2_IMPL(HistogramConditional, Sse2::A) SIMD_NEON_IMPL(HistogramConditional, Neon::A)
+        SIMD_BASE_IMPL(HistogramConditional) };
+
+    simdHistogramConditional(width)(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
 }
 
 SIMD_API void SimdNormalizedColors(const uint32_t * histogram, uint8_t * colors)
@@ -2783,320 +1504,164 @@ SIMD_API void SimdNormalizedColors(const uint32_t * histogram, uint8_t * colors)
 
 SIMD_API void SimdChangeColors(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * colors, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::HA)
-        Avx512bw::ChangeColors(src, srcStride, width, height, colors, dst, dstStride);
-    else
-#endif
-        Base::ChangeColors(src, srcStride, width, height, colors, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::ChangeColors)> simdChangeColors = {
+        SIMD_AVX512BW_IMPL(ChangeColors, Avx512bw::HA) SIMD_BASE_IMPL(ChangeColors) };
+
+    simdChangeColors(width)(src, srcStride, width, height, colors, dst, dstStride);
 }
 
 SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::HA)
-        Avx512bw::NormalizeHistogram(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::NormalizeHistogram(src, srcStride, width, height, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::NormalizeHistogram)> simdNormalizeHistogram = {
+        SIMD_AVX512BW_IMPL(NormalizeHistogram, Avx512bw::HA) SIMD_BASE_IMPL(NormalizeHistogram) };
+
+    simdNormalizeHistogram(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height, 
                                          size_t cellX, size_t cellY, size_t quantization, float * histograms)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::HA + 2)
-        Avx512bw::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A + 2)
-        Sse41::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
-#endif
-#ifdef SIMD_VSX_ENABLE
-    if(Vsx::Enable && width >= Vsx::A + 2)
-        Vsx::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
-#endif
-        Base::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+    const static Simd::Dispatch<decltype(&Base::HogDirectionHistograms)> simdHogDirectionHistograms = {
+        SIMD_AVX512BW_IMPL(HogDirectionHistograms, Avx512bw::HA + 2) SIMD_AVX2_IMPL(HogDirectionHistograms, Avx2::A + 2)
+        SIMD_SSE41_IMPL(HogDirectionHistograms, Sse41::A + 2) SIMD_SSE2_IMPL(HogDirectionHistograms, Sse2::A + 2)
+        SIMD_VSX_IMPL(HogDirectionHistograms, Vsx::A + 2) SIMD_NEON_IMPL(HogDirectionHistograms, Neon::A + 2)
+        SIMD_BASE_IMPL(HogDirectionHistograms) };
+
+    simdHogDirectionHistograms(width)(src, stride, width, height, cellX, cellY, quantization, histograms);
 }
 
 SIMD_API void SimdHogExtractFeatures(const uint8_t * src, size_t stride, size_t width, size_t height, float * features)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::HA + 2)
-        Avx512bw::HogExtractFeatures(src, stride, width, height, features);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::HA + 2)
-        Avx2::HogExtractFeatures(src, stride, width, height, features);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A + 2)
-        Sse41::HogExtractFeatures(src, stride, width, height, features);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::HogExtractFeatures(src, stride, width, height, features);
-    else
-#endif
-        Base::HogExtractFeatures(src, stride, width, height, features);
+    const static Simd::Dispatch<decltype(&Base::HogExtractFeatures)> simdHogExtractFeatures = {
+        SIMD_AVX512BW_IMPL(HogExtractFeatures, Avx512bw::HA + 2) SIMD_AVX2_IMPL(HogExtractFeatures, Avx2::HA + 2)
+        SIMD_SSE41_IMPL(HogExtractFeatures, Sse41::A + 2) SIMD_NEON_IMPL(HogExtractFeatures, Neon::A + 2)
+        SIMD_BASE_IMPL(HogExtractFeatures) };
+
+    simdHogExtractFeatures(width)(src, stride, width, height, features);
 }
 
 SIMD_API void SimdHogDeinterleave(const float * src, size_t srcStride, size_t width, size_t height, size_t count, float ** dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::F && count >= Sse2::F)
-        Avx512bw::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F && count >= Sse2::F)
-        Avx2::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::F && count >= Sse2::F)
-        Sse2::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F && count >= Neon::F)
-        Neon::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::HogDeinterleave)> simdHogDeinterleave = {
+        SIMD_AVX512BW_IMPL(HogDeinterleave, Avx512bw::F) SIMD_AVX2_IMPL(HogDeinterleave, Avx2::F)
+        SIMD_SSE2_IMPL(HogDeinterleave, Sse2::F) SIMD_NEON_IMPL(HogDeinterleave, Neon::F)
+        SIMD_BASE_IMPL(HogDeinterleave) };
+
+    if (count >= 4)
+        simdHogDeinterleave(width)(src, srcStride, width, height, count, dst, dstStride);
     else
-#endif
         Base::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
 }
 
 SIMD_API void SimdHogFilterSeparable(const float * src, size_t srcStride, size_t width, size_t height,
     const float * rowFilter, size_t rowSize, const float * colFilter, size_t colSize, float * dst, size_t dstStride, int add)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::F + colSize - 1)
-        Avx512bw::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F + colSize - 1)
-        Avx2::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::F + colSize - 1)
-        Sse2::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F + colSize - 1)
-        Neon::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
-    else
-#endif
-        Base::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
+    const static Simd::Dispatch<decltype(&Base::HogFilterSeparable)> simdHogFilterSeparable = {
+        SIMD_AVX512BW_IMPL(HogFilterSeparable, Avx512bw::F) SIMD_AVX2_IMPL(HogFilterSeparable, Avx2::F)
+        SIMD_SSE2_IMPL(HogFilterSeparable, Sse2::F) SIMD_NEON_IMPL(HogFilterSeparable, Neon::F)
+        SIMD_BASE_IMPL(HogFilterSeparable) };
+
+    simdHogFilterSeparable(width + 1 > colSize ? width + 1 - colSize : 0)(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
 }
 
 SIMD_API void SimdHogLiteExtractFeatures(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t cell, float * features, size_t featuresStride)
 {
-#if defined(SIMD_AVX2_ENABLE) || defined(SIMD_SSE41_ENABLE) || defined(SIMD_NEON_ENABLE)
+    const static Simd::Dispatch<decltype(&Base::HogLiteExtractFeatures)> simdHogLiteExtractFeatures = {
+        SIMD_AVX512BW_IMPL(HogLiteExtractFeatures, 0) SIMD_AVX2_IMPL(HogLiteExtractFeatures, Avx2::A)
+        SIMD_SSE41_IMPL(HogLiteExtractFeatures, Sse41::A) SIMD_NEON_IMPL(HogLiteExtractFeatures, Neon::A)
+        SIMD_BASE_IMPL(HogLiteExtractFeatures) };
+
     size_t size = (width / cell - 1)*cell;
-#endif
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::A)
-        Avx2::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && size >= Sse41::A)
-        Sse41::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
-    else
-#endif
-        Base::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
+    simdHogLiteExtractFeatures(size)(src, srcStride, width, height, cell, features, featuresStride);
 }
 
 SIMD_API void SimdHogLiteFilterFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * filter, size_t filterWidth, size_t filterHeight, const uint32_t * mask, size_t maskStride, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable)
-        Avx::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
-    else
-#endif
-        Base::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::HogLiteFilterFeatures)> simdHogLiteFilterFeatures = {
+        SIMD_AVX512BW_IMPL(HogLiteFilterFeatures, 0) SIMD_AVX2_IMPL(HogLiteFilterFeatures, 0)
+        SIMD_AVX_IMPL(HogLiteFilterFeatures, 0) SIMD_SSE41_IMPL(HogLiteFilterFeatures, 0)
+        SIMD_NEON_IMPL(HogLiteFilterFeatures, 0) SIMD_BASE_IMPL(HogLiteFilterFeatures) };
+
+    simdHogLiteFilterFeatures()(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
 }
 
 SIMD_API void SimdHogLiteResizeFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, float * dst, size_t dstStride, size_t dstWidth, size_t dstHeight)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable)
-        Avx::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
-    else
-#endif
-        Base::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
+    const static Simd::Dispatch<decltype(&Base::HogLiteResizeFeatures)> simdHogLiteResizeFeatures = {
+        SIMD_AVX512BW_IMPL(HogLiteResizeFeatures, 0) SIMD_AVX2_IMPL(HogLiteResizeFeatures, 0)
+        SIMD_AVX_IMPL(HogLiteResizeFeatures, 0) SIMD_SSE41_IMPL(HogLiteResizeFeatures, 0)
+        SIMD_NEON_IMPL(HogLiteResizeFeatures, 0) SIMD_BASE_IMPL(HogLiteResizeFeatures) };
+
+    simdHogLiteResizeFeatures()(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
 }
 
 SIMD_API void SimdHogLiteCompressFeatures(const float * src, size_t srcStride, size_t width, size_t height, const float * pca, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable)
-        Avx::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
-    else
-#endif
-        Base::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::HogLiteCompressFeatures)> simdHogLiteCompressFeatures = {
+        SIMD_AVX512BW_IMPL(HogLiteCompressFeatures, 0) SIMD_AVX2_IMPL(HogLiteCompressFeatures, 0)
+        SIMD_AVX_IMPL(HogLiteCompressFeatures, 0) SIMD_SSE41_IMPL(HogLiteCompressFeatures, 0)
+        SIMD_NEON_IMPL(HogLiteCompressFeatures, 0) SIMD_BASE_IMPL(HogLiteCompressFeatures) };
+
+    simdHogLiteCompressFeatures()(src, srcStride, width, height, pca, dst, dstStride);
 }
 
 SIMD_API void SimdHogLiteFilterSeparable(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * hFilter, size_t hSize, const float * vFilter, size_t vSize, float * dst, size_t dstStride, int add)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && srcWidth >= hSize - 1 + Avx2::F)
-        Avx2::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && srcWidth >= hSize - 1 + Avx::F)
-        Avx::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && srcWidth >= hSize - 1 + Sse41::F)
-        Sse41::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth >= hSize - 1 + Neon::F)
-        Neon::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
-    else
-#endif
-        Base::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
+    const static Simd::Dispatch<decltype(&Base::HogLiteFilterSeparable)> simdHogLiteFilterSeparable = {
+        SIMD_AVX512BW_IMPL(HogLiteFilterSeparable, 0) SIMD_AVX2_IMPL(HogLiteFilterSeparable, Avx2::F)
+        SIMD_AVX_IMPL(HogLiteFilterSeparable, Avx::F) SIMD_SSE41_IMPL(HogLiteFilterSeparable, Sse41::F)
+        SIMD_NEON_IMPL(HogLiteFilterSeparable, Neon::F) SIMD_BASE_IMPL(HogLiteFilterSeparable) };
+
+    simdHogLiteFilterSeparable(srcWidth + 1 > hSize ? srcWidth + 1 - hSize : 0)(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
 }
 
 SIMD_API void SimdHogLiteFindMax7x7(const float * a, size_t aStride, const float * b, size_t bStride, size_t height, float * value, size_t * col, size_t * row)
 {
     typedef void(*SimdHogLiteFindMax7x7Ptr) (const float * a, size_t aStride, const float * b, size_t bStride, size_t height, float * value, size_t * col, size_t * row);
-    const static SimdHogLiteFindMax7x7Ptr simdHogLiteFindMax7x7 = SIMD_FUNC3(HogLiteFindMax7x7, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdHogLiteFindMax7x7Ptr> simdHogLiteFindMax7x7 = {
+        SIMD_AVX2_IMPL(HogLiteFindMax7x7, 0) SIMD_SSE41_IMPL(HogLiteFindMax7x7, 0) SIMD_NEON_IMPL(HogLiteFindMax7x7, 0)
+        SIMD_BASE_IMPL(HogLiteFindMax7x7) };
 
-    simdHogLiteFindMax7x7(a, aStride, b, bStride, height, value, col, row);
+    simdHogLiteFindMax7x7()(a, aStride, b, bStride, height, value, col, row);
 }
 
 SIMD_API void SimdHogLiteCreateMask(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride)
 {
     typedef void(*SimdHogLiteCreateMaskPtr) (const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride);
-    const static SimdHogLiteCreateMaskPtr simdHogLiteCreateMask = SIMD_FUNC4(HogLiteCreateMask, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdHogLiteCreateMaskPtr> simdHogLiteCreateMask = {
+        SIMD_AVX512BW_IMPL(HogLiteCreateMask, 0) SIMD_AVX2_IMPL(HogLiteCreateMask, 0)
+        SIMD_SSE41_IMPL(HogLiteCreateMask, 0) SIMD_NEON_IMPL(HogLiteCreateMask, 0) SIMD_BASE_IMPL(HogLiteCreateMask) };
 
-    simdHogLiteCreateMask(src, srcStride, srcWidth, srcHeight, threshold, scale, size, dst, dstStride);
+    simdHogLiteCreateMask()(src, srcStride, srcWidth, srcHeight, threshold, scale, size, dst, dstStride);
 }
 
 SIMD_API uint8_t* SimdImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size)
 {
-    const static Simd::ImageSaveToMemoryPtr imageSaveToMemory = SIMD_FUNC4(ImageSaveToMemory, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<Simd::ImageSaveToMemoryPtr> imageSaveToMemory = {
+        SIMD_AVX512BW_IMPL(ImageSaveToMemory, 0) SIMD_AVX2_IMPL(ImageSaveToMemory, 0)
+        SIMD_SSE41_IMPL(ImageSaveToMemory, 0) SIMD_NEON_IMPL(ImageSaveToMemory, 0) SIMD_BASE_IMPL(ImageSaveToMemory) };
 
-    return imageSaveToMemory(src, stride, width, height, format, file, quality, size);
+    return imageSaveToMemory()(src, stride, width, height, format, file, quality, size);
 }
 
 SIMD_API SimdBool SimdImageSaveToFile(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path)
 {
-    const static Simd::ImageSaveToMemoryPtr imageSaveToMemory = SIMD_FUNC4(ImageSaveToMemory, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<Simd::ImageSaveToMemoryPtr> imageSaveToMemory = {
+        SIMD_AVX512BW_IMPL(ImageSaveToMemory, 0) SIMD_AVX2_IMPL(ImageSaveToMemory, 0)
+        SIMD_SSE41_IMPL(ImageSaveToMemory, 0) SIMD_NEON_IMPL(ImageSaveToMemory, 0) SIMD_BASE_IMPL(ImageSaveToMemory) };
 
-    return ImageSaveToFile(imageSaveToMemory, src, stride, width, height, format, file, quality, path);
+    return ImageSaveToFile(imageSaveToMemory(), src, stride, width, height, format, file, quality, path);
 }
 
 SIMD_API uint8_t* SimdNv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size)
 {
     typedef uint8_t*(*SimdNv12SaveAsJpegToMemoryPtr) (const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
-    const static SimdNv12SaveAsJpegToMemoryPtr simdNv12SaveAsJpegToMemory = SIMD_FUNC4(Nv12SaveAsJpegToMemory, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNv12SaveAsJpegToMemoryPtr> simdNv12SaveAsJpegToMemory = {
+        SIMD_AVX512BW_IMPL(Nv12SaveAsJpegToMemory, 0) SIMD_AVX2_IMPL(Nv12SaveAsJpegToMemory, 0)
+        SIMD_SSE41_IMPL(Nv12SaveAsJpegToMemory, 0) SIMD_NEON_IMPL(Nv12SaveAsJpegToMemory, 0)
+        SIMD_BASE_IMPL(Nv12SaveAsJpegToMemory) };
 
-    return simdNv12SaveAsJpegToMemory(y, yStride, uv, uvStride, width, height, yuvType, quality, size);
+    return simdNv12SaveAsJpegToMemory()(y, yStride, uv, uvStride, width, height, yuvType, quality, size);
 }
 
 SIMD_API uint8_t* SimdYuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, 
@@ -3104,1050 +1669,574 @@ SIMD_API uint8_t* SimdYuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride
 {
     typedef uint8_t* (*SimdYuv420pSaveAsJpegToMemoryPtr) (const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, 
         const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
-    const static SimdYuv420pSaveAsJpegToMemoryPtr simdYuv420pSaveAsJpegToMemory = SIMD_FUNC4(Yuv420pSaveAsJpegToMemory, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdYuv420pSaveAsJpegToMemoryPtr> simdYuv420pSaveAsJpegToMemory = {
+        SIMD_AVX512BW_IMPL(Yuv420pSaveAsJpegToMemory, 0) SIMD_AVX2_IMPL(Yuv420pSaveAsJpegToMemory, 0)
+        SIMD_SSE41_IMPL(Yuv420pSaveAsJpegToMemory, 0) SIMD_NEON_IMPL(Yuv420pSaveAsJpegToMemory, 0)
+        SIMD_BASE_IMPL(Yuv420pSaveAsJpegToMemory) };
 
-    return simdYuv420pSaveAsJpegToMemory(y, yStride, u, uStride, v, vStride, width, height, yuvType, quality, size);
+    return simdYuv420pSaveAsJpegToMemory()(y, yStride, u, uStride, v, vStride, width, height, yuvType, quality, size);
 }
 
 SIMD_API uint8_t* SimdImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
 {
-    const static Simd::ImageLoadFromMemoryPtr imageLoadFromMemory = SIMD_FUNC4(ImageLoadFromMemory, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<Simd::ImageLoadFromMemoryPtr> imageLoadFromMemory = {
+        SIMD_AVX512BW_IMPL(ImageLoadFromMemory, 0) SIMD_AVX2_IMPL(ImageLoadFromMemory, 0)
+        SIMD_SSE41_IMPL(ImageLoadFromMemory, 0) SIMD_NEON_IMPL(ImageLoadFromMemory, 0)
+        SIMD_BASE_IMPL(ImageLoadFromMemory) };
 
-    return imageLoadFromMemory(data, size, stride, width, height, format);
+    return imageLoadFromMemory()(data, size, stride, width, height, format);
 }
 
 SIMD_API uint8_t* SimdImageLoadFromFile(const char* path, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
 {
-    const static Simd::ImageLoadFromMemoryPtr imageLoadFromMemory = SIMD_FUNC4(ImageLoadFromMemory, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<Simd::ImageLoadFromMemoryPtr> imageLoadFromMemory = {
+        SIMD_AVX512BW_IMPL(ImageLoadFromMemory, 0) SIMD_AVX2_IMPL(ImageLoadFromMemory, 0)
+        SIMD_SSE41_IMPL(ImageLoadFromMemory, 0) SIMD_NEON_IMPL(ImageLoadFromMemory, 0)
+        SIMD_BASE_IMPL(ImageLoadFromMemory) };
 
-    return ImageLoadFromFile(imageLoadFromMemory, path, stride, width, height, format);
+    return ImageLoadFromFile(imageLoadFromMemory(), path, stride, width, height, format);
 }
 
 SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Int16ToGray(src, width, height, srcStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::Int16ToGray(src, width, height, srcStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::Int16ToGray(src, width, height, srcStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::Int16ToGray(src, width, height, srcStride, dst, dstStride);
-    else
-#endif
-        Base::Int16ToGray(src, width, height, srcStride, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::Int16ToGray)> simdInt16ToGray = {
+        SIMD_AVX512BW_IMPL(Int16ToGray, 0) SIMD_AVX2_IMPL(Int16ToGray, Avx2::A) SIMD_SSE2_IMPL(Int16ToGray, Sse2::A)
+        SIMD_NEON_IMPL(Int16ToGray, Neon::HA) SIMD_BASE_IMPL(Int16ToGray) };
+
+    simdInt16ToGray(width)(src, width, height, srcStride, dst, dstStride);
+}
+
+static void IntegralBand(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                      uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
+                      SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+{
+    const static Simd::Dispatch<decltype(&Base::Integral)> simdIntegralBand = {
+        SIMD_AVX512BW_IMPL(Integral, 0) SIMD_AVX2_IMPL(Integral, 0) SIMD_BASE_IMPL(Integral) };
+
+    simdIntegralBand()(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
 }
 
 SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                       uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
                       SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+    size_t number = tilted ? 1 : RowBandNumber(height, width * height, 2);
+    if (number > 1)
+    {
+        Parallel(0, number, [&](size_t, size_t begin, size_t end)
+        {
+            for (size_t band = begin; band < end; ++band)
+            {
+                size_t yBeg = RowBand(band, number, height, 2);
+                size_t yEnd = band + 1 < number ? RowBand(band + 1, number, height, 2) - 1 : height;
+                IntegralBand(src + yBeg * srcStride, srcStride, width, yEnd - yBeg, sum + yBeg * sumStride, sumStride,
+                    sqsum ? sqsum + yBeg * sqsumStride : NULL, sqsumStride, NULL, 0, sumFormat, sqsumFormat);
+            }
+        }, number);
+        for (size_t band = 1; band < number; ++band)
+        {
+            size_t prev = RowBand(band - 1, number, height, 2), curr = RowBand(band, number, height, 2);
+            Base::IntegralBandOrigin(src + (curr - 1) * srcStride, width, sum + prev * sumStride,
+                sum + (curr - 1) * sumStride, sum + curr * sumStride, sumFormat, false);
+            if (sqsum)
+                Base::IntegralBandOrigin(src + (curr - 1) * srcStride, width, sqsum + prev * sqsumStride,
+                    sqsum + (curr - 1) * sqsumStride, sqsum + curr * sqsumStride, sqsumFormat, true);
+        }
+        Parallel(1, number, [&](size_t, size_t begin, size_t end)
+        {
+            for (size_t band = begin; band < end; ++band)
+            {
+                size_t yBeg = RowBand(band, number, height, 2);
+                size_t yEnd = band + 1 < number ? RowBand(band + 1, number, height, 2) - 1 : height;
+                Base::IntegralBandShift(sum + yBeg * sumStride, sumStride, width, yEnd - yBeg, sumFormat);
+                if (sqsum)
+                    Base::IntegralBandShift(sqsum + yBeg * sqsumStride, sqsumStride, width, yEnd - yBeg, sqsumFormat);
+            }
+        }, number - 1);
+    }
     else
-#endif
-        Base::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+        IntegralBand(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
 }
 
 SIMD_API void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
-#endif
-        Base::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
+    const static Simd::Dispatch<decltype(&Base::InterferenceIncrement)> simdInterferenceIncrement = {
+        SIMD_AVX512BW_IMPL(InterferenceIncrement, 0) SIMD_AVX2_IMPL(InterferenceIncrement, Avx2::HA)
+        SIMD_SSE2_IMPL(InterferenceIncrement, Sse2::HA) SIMD_VMX_IMPL(InterferenceIncrement, Vmx::HA)
+        SIMD_NEON_IMPL(InterferenceIncrement, Neon::HA) SIMD_BASE_IMPL(InterferenceIncrement) };
+
+    simdInterferenceIncrement(width)(statistic, stride, width, height, increment, saturation);
 }
 
 SIMD_API void SimdInterferenceIncrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, 
                                               uint8_t increment, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-    else
-#endif
-        Base::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+    const static Simd::Dispatch<decltype(&Base::InterferenceIncrementMasked)> simdInterferenceIncrementMasked = {
+        SIMD_AVX512BW_IMPL(InterferenceIncrementMasked, 0) SIMD_AVX2_IMPL(InterferenceIncrementMasked, Avx2::A)
+        SIMD_SSE2_IMPL(InterferenceIncrementMasked, Sse2::A) SIMD_VMX_IMPL(InterferenceIncrementMasked, Vmx::A)
+        SIMD_NEON_IMPL(InterferenceIncrementMasked, Neon::A) SIMD_BASE_IMPL(InterferenceIncrementMasked) };
+
+    simdInterferenceIncrementMasked(width)(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
 }
 
 SIMD_API void SimdInterferenceDecrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t decrement, int16_t saturation)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-    else
-#endif
-        Base::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+    const static Simd::Dispatch<decltype(&Base::InterferenceDecrement)> simdInterferenceDecrement = {
+        SIMD_AVX512BW_IMPL(InterferenceDecrement, 0) SIMD_AVX2_IMPL(InterferenceDecrement, Avx2::HA)
+        SIMD_SSE2_IMPL(InterferenceDecrement, Sse2::HA) SIMD_VMX_IMPL(InterferenceDecrement, Vmx::HA)
+        SIMD_NEON_IMPL(InterferenceDecrement, Neon::HA) SIMD_BASE_IMPL(InterferenceDecrement) };
+
+    simdInterferenceDecrement(width)(statistic, stride, width, height, decrement, saturation);
 }
 
 SIMD_API void SimdInterferenceDecrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, 
                                               uint8_t decrement, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-    else
-#endif
-        Base::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+    const static Simd::Dispatch<decltype(&Base::InterferenceDecrementMasked)> simdInterferenceDecrementMasked = {
+        SIMD_AVX512BW_IMPL(InterferenceDecrementMasked, 0) SIMD_AVX2_IMPL(InterferenceDecrementMasked, Avx2::A)
+        SIMD_SSE2_IMPL(InterferenceDecrementMasked, Sse2::A) SIMD_VMX_IMPL(InterferenceDecrementMasked, Vmx::A)
+        SIMD_NEON_IMPL(InterferenceDecrementMasked, Neon::A) SIMD_BASE_IMPL(InterferenceDecrementMasked) };
+
+    simdInterferenceDecrementMasked(width)(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
 }
 
 SIMD_API void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if (Vmx::Enable && width >= Vmx::A)
-        Vmx::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-    else
-#endif
-        Base::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+    const static Simd::Dispatch<decltype(&Base::InterleaveUv)> simdInterleaveUv = {
+        SIMD_AVX512BW_IMPL(InterleaveUv, 0) SIMD_AVX2_IMPL(InterleaveUv, Avx2::A) SIMD_SSE2_IMPL(InterleaveUv, Sse2::A)
+        SIMD_VMX_IMPL(InterleaveUv, Vmx::A) SIMD_NEON_IMPL(InterleaveUv, Neon::A) SIMD_BASE_IMPL(InterleaveUv) };
+
+    simdInterleaveUv(width)(u, uStride, v, vStride, width, height, uv, uvStride);
 }
 
 SIMD_API void SimdInterleaveBgr(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride,
     size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
-    else
-#endif
-        Base::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
+    const static Simd::Dispatch<decltype(&Base::InterleaveBgr)> simdInterleaveBgr = {
+        SIMD_AVX512BW_IMPL(InterleaveBgr, 0) SIMD_AVX2_IMPL(InterleaveBgr, Avx2::A)
+        SIMD_SSE41_IMPL(InterleaveBgr, Sse41::A) SIMD_NEON_IMPL(InterleaveBgr, Neon::A) SIMD_BASE_IMPL(InterleaveBgr) };
+
+    simdInterleaveBgr(width)(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
 }
 
 SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride,
     size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
-    else
-#endif
-        Base::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
+    const static Simd::Dispatch<decltype(&Base::InterleaveBgra)> simdInterleaveBgra = {
+        SIMD_AVX512BW_IMPL(InterleaveBgra, 0) SIMD_AVX2_IMPL(InterleaveBgra, Avx2::A)
+        SIMD_SSE41_IMPL(InterleaveBgra, Sse41::A) SIMD_NEON_IMPL(InterleaveBgra, Neon::A) SIMD_BASE_IMPL(InterleaveBgra) };
+
+    simdInterleaveBgra(width)(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
 }
 
 SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width > Sse41::A)
-        Sse41::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::Laplace(src, srcStride, width, height, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::Laplace)> simdLaplace = {
+        SIMD_AVX512BW_IMPL(Laplace, Avx512bw::A + 1) SIMD_AVX2_IMPL(Laplace, Avx2::A + 1)
+        SIMD_SSE41_IMPL(Laplace, Sse41::A + 1) SIMD_SSE2_IMPL(Laplace, Sse2::A + 1) SIMD_VMX_IMPL(Laplace, Vmx::A + 1)
+        SIMD_NEON_IMPL(Laplace, Neon::A + 1) SIMD_BASE_IMPL(Laplace) };
+
+    simdLaplace(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width > Sse41::A)
-        Sse41::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::LaplaceAbs)> simdLaplaceAbs = {
+        SIMD_AVX512BW_IMPL(LaplaceAbs, Avx512bw::A + 1) SIMD_AVX2_IMPL(LaplaceAbs, Avx2::A + 1)
+        SIMD_SSE41_IMPL(LaplaceAbs, Sse41::A + 1) SIMD_VMX_IMPL(LaplaceAbs, Vmx::A + 1)
+        SIMD_NEON_IMPL(LaplaceAbs, Neon::A + 1) SIMD_BASE_IMPL(LaplaceAbs) };
+
+    simdLaplaceAbs(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdLaplaceAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::LaplaceAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::LaplaceAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width > Sse41::A)
-        Sse41::LaplaceAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::LaplaceAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::LaplaceAbsSum(src, stride, width, height, sum);
-    else
-#endif
-        Base::LaplaceAbsSum(src, stride, width, height, sum);
+    const static Simd::Dispatch<decltype(&Base::LaplaceAbsSum)> simdLaplaceAbsSum = {
+        SIMD_AVX512BW_IMPL(LaplaceAbsSum, Avx512bw::A + 1) SIMD_AVX2_IMPL(LaplaceAbsSum, Avx2::A + 1)
+        SIMD_SSE41_IMPL(LaplaceAbsSum, Sse41::A + 1) SIMD_VMX_IMPL(LaplaceAbsSum, Vmx::A + 1)
+        SIMD_NEON_IMPL(LaplaceAbsSum, Neon::A + 1) SIMD_BASE_IMPL(LaplaceAbsSum) };
+
+    simdLaplaceAbsSum(width)(src, stride, width, height, sum);
 }
 
 SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
-        Avx512bw::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2)
-        Vmx::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::LbpEstimate(src, srcStride, width, height, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::LbpEstimate)> simdLbpEstimate = {
+        SIMD_AVX512BW_IMPL(LbpEstimate, Avx512bw::A + 2) SIMD_AVX2_IMPL(LbpEstimate, Avx2::A + 2)
+        SIMD_SSE2_IMPL(LbpEstimate, Sse2::A + 2) SIMD_VMX_IMPL(LbpEstimate, Vmx::A + 2)
+        SIMD_NEON_IMPL(LbpEstimate, Neon::A + 2) SIMD_BASE_IMPL(LbpEstimate) };
+
+    simdLbpEstimate(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-        Avx512bw::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && (width - 1)*channelCount >= Sse41::A)
-        Sse41::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if (Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-        Base::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::MeanFilter3x3)> simdMeanFilter3x3 = {
+        SIMD_AVX512BW_IMPL(MeanFilter3x3, Avx512bw::A) SIMD_AVX2_IMPL(MeanFilter3x3, Avx2::A)
+        SIMD_SSE41_IMPL(MeanFilter3x3, Sse41::A) SIMD_SSE2_IMPL(MeanFilter3x3, Sse2::A)
+        SIMD_VMX_IMPL(MeanFilter3x3, Vmx::A) SIMD_NEON_IMPL(MeanFilter3x3, Neon::A) SIMD_BASE_IMPL(MeanFilter3x3) };
+
+    simdMeanFilter3x3((width - 1)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
 SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-        Avx512bw::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-        Base::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::MedianFilterRhomb3x3)> simdMedianFilterRhomb3x3 = {
+        SIMD_AVX512BW_IMPL(MedianFilterRhomb3x3, Avx512bw::A) SIMD_AVX2_IMPL(MedianFilterRhomb3x3, Avx2::A)
+        SIMD_SSE2_IMPL(MedianFilterRhomb3x3, Sse2::A) SIMD_VMX_IMPL(MedianFilterRhomb3x3, Vmx::A)
+        SIMD_NEON_IMPL(MedianFilterRhomb3x3, Neon::A) SIMD_BASE_IMPL(MedianFilterRhomb3x3) };
+
+    simdMedianFilterRhomb3x3((width - 1)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
 SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
-        Avx512bw::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 2)*channelCount >= Avx2::A)
-        Avx2::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 2)*channelCount >= Sse2::A)
-        Sse2::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 2)*channelCount >= Vmx::A)
-        Vmx::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 2)*channelCount >= Neon::A)
-        Neon::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-        Base::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::MedianFilterRhomb5x5)> simdMedianFilterRhomb5x5 = {
+        SIMD_AVX512BW_IMPL(MedianFilterRhomb5x5, Avx512bw::A) SIMD_AVX2_IMPL(MedianFilterRhomb5x5, Avx2::A)
+        SIMD_SSE2_IMPL(MedianFilterRhomb5x5, Sse2::A) SIMD_VMX_IMPL(MedianFilterRhomb5x5, Vmx::A)
+        SIMD_NEON_IMPL(MedianFilterRhomb5x5, Neon::A) SIMD_BASE_IMPL(MedianFilterRhomb5x5) };
+
+    simdMedianFilterRhomb5x5((width - 2)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
 SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-        Avx512bw::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-        Base::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::MedianFilterSquare3x3)> simdMedianFilterSquare3x3 = {
+        SIMD_AVX512BW_IMPL(MedianFilterSquare3x3, Avx512bw::A) SIMD_AVX2_IMPL(MedianFilterSquare3x3, Avx2::A)
+        SIMD_SSE2_IMPL(MedianFilterSquare3x3, Sse2::A) SIMD_VMX_IMPL(MedianFilterSquare3x3, Vmx::A)
+        SIMD_NEON_IMPL(MedianFilterSquare3x3, Neon::A) SIMD_BASE_IMPL(MedianFilterSquare3x3) };
+
+    simdMedianFilterSquare3x3((width - 1)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
+}
+
+static void MedianFilterSquare5x5Band(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+    const static Simd::Dispatch<decltype(&Base::MedianFilterSquare5x5)> simdMedianFilterSquare5x5Band = {
+        SIMD_AVX512BW_IMPL(MedianFilterSquare5x5, Avx512bw::A) SIMD_AVX2_IMPL(MedianFilterSquare5x5, Avx2::A)
+        SIMD_SSE2_IMPL(MedianFilterSquare5x5, Sse2::A) SIMD_VMX_IMPL(MedianFilterSquare5x5, Vmx::A)
+        SIMD_NEON_IMPL(MedianFilterSquare5x5, Neon::A) SIMD_BASE_IMPL(MedianFilterSquare5x5) };
+
+    simdMedianFilterSquare5x5Band((width - 2)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
 SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
-        Avx512bw::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 2)*channelCount >= Avx2::A)
-        Avx2::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 2)*channelCount >= Sse2::A)
-        Sse2::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 2)*channelCount >= Vmx::A)
-        Vmx::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 2)*channelCount >= Neon::A)
-        Neon::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-        Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    ParallelFilterRows(src, srcStride, height, width * height, 2, dst, dstStride, width * channelCount,
+        [=](const uint8_t * bandSrc, size_t bandHeight, uint8_t * bandDst, size_t bandDstStride)
+    {
+        MedianFilterSquare5x5Band(bandSrc, srcStride, width, bandHeight, channelCount, bandDst, bandDstStride);
+    });
 }
 
 SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::F)
-        Avx512bw::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx::F)
-        Avx2::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-    else
-#endif
-#ifdef SIMD_VSX_ENABLE
-    if (Vsx::Enable && width >= Vsx::A)
-        Vsx::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-    else
-#endif
-        Base::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
+    const static Simd::Dispatch<decltype(&Base::NeuralConvert)> simdNeuralConvert = {
+        SIMD_AVX512BW_IMPL(NeuralConvert, Avx512bw::F) SIMD_AVX2_IMPL(NeuralConvert, Avx::F)
+        SIMD_SSE2_IMPL(NeuralConvert, Sse2::A) SIMD_VSX_IMPL(NeuralConvert, Vsx::A)
+        SIMD_NEON_IMPL(NeuralConvert, Neon::A) SIMD_BASE_IMPL(NeuralConvert) };
+
+    simdNeuralConvert(width)(src, srcStride, width, height, dst, dstStride, inversion);
 }
 
 SIMD_API void SimdNeuralProductSum(const float * a, const float * b, size_t size, float * sum)
 {
     typedef void(*SimdNeuralProductSumPtr) (const float * a, const float * b, size_t size, float * sum);
-    const static SimdNeuralProductSumPtr simdNeuralProductSum = SIMD_FUNC6(NeuralProductSum, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralProductSumPtr> simdNeuralProductSum = {
+        SIMD_AVX512BW_IMPL(NeuralProductSum, 0) SIMD_AVX2_IMPL(NeuralProductSum, 0) SIMD_AVX_IMPL(NeuralProductSum, 0)
+        SIMD_SSE2_IMPL(NeuralProductSum, 0) SIMD_VSX_IMPL(NeuralProductSum, 0) SIMD_NEON_IMPL(NeuralProductSum, 0)
+        SIMD_BASE_IMPL(NeuralProductSum) };
 
-    simdNeuralProductSum(a, b, size, sum);
+    simdNeuralProductSum()(a, b, size, sum);
 }
 
 SIMD_API void SimdNeuralAddValue(const float * value, float * dst, size_t size)
 {
     typedef void(*SimdNeuralAddValuePtr) (const float * value, float * dst, size_t size);
-    const static SimdNeuralAddValuePtr simdNeuralAddValue = SIMD_FUNC4(NeuralAddValue, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralAddValuePtr> simdNeuralAddValue = {
+        SIMD_AVX512BW_IMPL(NeuralAddValue, 0) SIMD_AVX_IMPL(NeuralAddValue, 0) SIMD_SSE2_IMPL(NeuralAddValue, 0)
+        SIMD_NEON_IMPL(NeuralAddValue, 0) SIMD_BASE_IMPL(NeuralAddValue) };
 
-    simdNeuralAddValue(value, dst, size);
+    simdNeuralAddValue()(value, dst, size);
 }
 
 SIMD_API void SimdNeuralAddVector(const float * src, size_t size, float * dst)
 {
     typedef void(*SimdNeuralAddVectorPtr) (const float * src, size_t size, float * dst);
-    const static SimdNeuralAddVectorPtr simdNeuralAddVector = SIMD_FUNC4(NeuralAddVector, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralAddVectorPtr> simdNeuralAddVector = {
+        SIMD_AVX512BW_IMPL(NeuralAddVector, 0) SIMD_AVX_IMPL(NeuralAddVector, 0) SIMD_SSE2_IMPL(NeuralAddVector, 0)
+        SIMD_NEON_IMPL(NeuralAddVector, 0) SIMD_BASE_IMPL(NeuralAddVector) };
 
-    simdNeuralAddVector(src, size, dst);
+    simdNeuralAddVector()(src, size, dst);
 }
 
 SIMD_API void SimdNeuralAddVectorMultipliedByValue(const float * src, size_t size, const float * value, float * dst)
 {
     typedef void(*SimdNeuralAddVectorMultipliedByValuePtr) (const float * src, size_t size, const float * value, float * dst);
-    const static SimdNeuralAddVectorMultipliedByValuePtr simdNeuralAddVectorMultipliedByValue = SIMD_FUNC5(NeuralAddVectorMultipliedByValue, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralAddVectorMultipliedByValuePtr> simdNeuralAddVectorMultipliedByValue = {
+        SIMD_AVX512BW_IMPL(NeuralAddVectorMultipliedByValue, 0) SIMD_AVX2_IMPL(NeuralAddVectorMultipliedByValue, 0)
+        SIMD_AVX_IMPL(NeuralAddVectorMultipliedByValue, 0) SIMD_SSE2_IMPL(NeuralAddVectorMultipliedByValue, 0)
+        SIMD_NEON_IMPL(NeuralAddVectorMultipliedByValue, 0) SIMD_BASE_IMPL(NeuralAddVectorMultipliedByValue) };
 
-    simdNeuralAddVectorMultipliedByValue(src, size, value, dst);
+    simdNeuralAddVectorMultipliedByValue()(src, size, value, dst);
 }
 
 SIMD_API void SimdNeuralRoughSigmoid(const float * src, size_t size, const float * slope, float * dst)
 {
     typedef void(*SimdNeuralRoughSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
-    const static SimdNeuralRoughSigmoidPtr simdNeuralRoughSigmoid = SIMD_FUNC5(NeuralRoughSigmoid, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralRoughSigmoidPtr> simdNeuralRoughSigmoid = {
+        SIMD_AVX512BW_IMPL(NeuralRoughSigmoid, 0) SIMD_AVX_IMPL(NeuralRoughSigmoid, 0)
+        SIMD_SSE2_IMPL(NeuralRoughSigmoid, 0) SIMD_VSX_IMPL(NeuralRoughSigmoid, 0) SIMD_NEON_IMPL(NeuralRoughSigmoid, 0)
+        SIMD_BASE_IMPL(NeuralRoughSigmoid) };
 
-    simdNeuralRoughSigmoid(src, size, slope, dst);
+    simdNeuralRoughSigmoid()(src, size, slope, dst);
 }
 
 SIMD_API void SimdNeuralRoughSigmoid2(const float * src, size_t size, const float * slope, float * dst)
 {
     typedef void(*SimdNeuralRoughSigmoid2Ptr) (const float * src, size_t size, const float * slope, float * dst);
-    const static SimdNeuralRoughSigmoid2Ptr simdNeuralRoughSigmoid2 = SIMD_FUNC5(NeuralRoughSigmoid2, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralRoughSigmoid2Ptr> simdNeuralRoughSigmoid2 = {
+        SIMD_AVX512BW_IMPL(NeuralRoughSigmoid2, 0) SIMD_AVX2_IMPL(NeuralRoughSigmoid2, 0)
+        SIMD_AVX_IMPL(NeuralRoughSigmoid2, 0) SIMD_SSE2_IMPL(NeuralRoughSigmoid2, 0)
+        SIMD_NEON_IMPL(NeuralRoughSigmoid2, 0) SIMD_BASE_IMPL(NeuralRoughSigmoid2) };
 
-    simdNeuralRoughSigmoid2(src, size, slope, dst);
+    simdNeuralRoughSigmoid2()(src, size, slope, dst);
 }
 
 SIMD_API void SimdNeuralDerivativeSigmoid(const float * src, size_t size, const float * slope, float * dst)
 {
     typedef void(*SimdNeuralDerivativeSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
-    const static SimdNeuralDerivativeSigmoidPtr simdNeuralDerivativeSigmoid = SIMD_FUNC4(NeuralDerivativeSigmoid, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralDerivativeSigmoidPtr> simdNeuralDerivativeSigmoid = {
+        SIMD_AVX512BW_IMPL(NeuralDerivativeSigmoid, 0) SIMD_AVX_IMPL(NeuralDerivativeSigmoid, 0)
+        SIMD_SSE2_IMPL(NeuralDerivativeSigmoid, 0) SIMD_NEON_IMPL(NeuralDerivativeSigmoid, 0)
+        SIMD_BASE_IMPL(NeuralDerivativeSigmoid) };
 
-    simdNeuralDerivativeSigmoid(src, size, slope, dst);
+    simdNeuralDerivativeSigmoid()(src, size, slope, dst);
 }
 
 SIMD_API void SimdNeuralRoughTanh(const float * src, size_t size, const float * slope, float * dst)
 {
     typedef void(*SimdNeuralRoughTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
-    const static SimdNeuralRoughTanhPtr simdNeuralRoughTanh = SIMD_FUNC4(NeuralRoughTanh, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralRoughTanhPtr> simdNeuralRoughTanh = {
+        SIMD_AVX512BW_IMPL(NeuralRoughTanh, 0) SIMD_AVX_IMPL(NeuralRoughTanh, 0) SIMD_SSE2_IMPL(NeuralRoughTanh, 0)
+        SIMD_NEON_IMPL(NeuralRoughTanh, 0) SIMD_BASE_IMPL(NeuralRoughTanh) };
 
-    simdNeuralRoughTanh(src, size, slope, dst);
+    simdNeuralRoughTanh()(src, size, slope, dst);
 }
 
 SIMD_API void SimdNeuralDerivativeTanh(const float * src, size_t size, const float * slope, float * dst)
 {
     typedef void(*SimdNeuralDerivativeTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
-    const static SimdNeuralDerivativeTanhPtr simdNeuralDerivativeTanh = SIMD_FUNC4(NeuralDerivativeTanh, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralDerivativeTanhPtr> simdNeuralDerivativeTanh = {
+        SIMD_AVX512BW_IMPL(NeuralDerivativeTanh, 0) SIMD_AVX_IMPL(NeuralDerivativeTanh, 0)
+        SIMD_SSE2_IMPL(NeuralDerivativeTanh, 0) SIMD_NEON_IMPL(NeuralDerivativeTanh, 0)
+        SIMD_BASE_IMPL(NeuralDerivativeTanh) };
 
-    simdNeuralDerivativeTanh(src, size, slope, dst);
+    simdNeuralDerivativeTanh()(src, size, slope, dst);
 }
 
 SIMD_API void SimdNeuralDerivativeRelu(const float * src, size_t size, const float * slope, float * dst)
 {
     typedef void(*SimdNeuralDerivativeReluPtr) (const float * src, size_t size, const float * slope, float * dst);
-    const static SimdNeuralDerivativeReluPtr simdNeuralDerivativeRelu = SIMD_FUNC4(NeuralDerivativeRelu, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralDerivativeReluPtr> simdNeuralDerivativeRelu = {
+        SIMD_AVX512BW_IMPL(NeuralDerivativeRelu, 0) SIMD_AVX_IMPL(NeuralDerivativeRelu, 0)
+        SIMD_SSE2_IMPL(NeuralDerivativeRelu, 0) SIMD_NEON_IMPL(NeuralDerivativeRelu, 0)
+        SIMD_BASE_IMPL(NeuralDerivativeRelu) };
 
-    simdNeuralDerivativeRelu(src, size, slope, dst);
+    simdNeuralDerivativeRelu()(src, size, slope, dst);
 }
 
 SIMD_API void SimdNeuralPow(const float * src, size_t size, const float * exponent, float * dst)
 {
     typedef void(*SimdNeuralPowPtr) (const float * src, size_t size, const float * exponent, float * dst);
-    const static SimdNeuralPowPtr simdNeuralPow = SIMD_FUNC4(NeuralPow, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralPowPtr> simdNeuralPow = {
+        SIMD_AVX512BW_IMPL(NeuralPow, 0) SIMD_AVX2_IMPL(NeuralPow, 0) SIMD_SSE2_IMPL(NeuralPow, 0)
+        SIMD_NEON_IMPL(NeuralPow, 0) SIMD_BASE_IMPL(NeuralPow) };
 
-    simdNeuralPow(src, size, exponent, dst);
+    simdNeuralPow()(src, size, exponent, dst);
 }
 
 SIMD_API void SimdNeuralUpdateWeights(const float * x, size_t size, const float * a, const float * b, float * d, float * w)
 {
     typedef void(*SimdNeuralUpdateWeightsPtr) (const float * x, size_t size, const float * a, const float * b, float * d, float * w);
-    const static SimdNeuralUpdateWeightsPtr simdNeuralUpdateWeights = SIMD_FUNC4(NeuralUpdateWeights, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralUpdateWeightsPtr> simdNeuralUpdateWeights = {
+        SIMD_AVX512BW_IMPL(NeuralUpdateWeights, 0) SIMD_AVX_IMPL(NeuralUpdateWeights, 0)
+        SIMD_SSE2_IMPL(NeuralUpdateWeights, 0) SIMD_NEON_IMPL(NeuralUpdateWeights, 0)
+        SIMD_BASE_IMPL(NeuralUpdateWeights) };
 
-    simdNeuralUpdateWeights(x, size, a, b, d, w);
+    simdNeuralUpdateWeights()(x, size, a, b, d, w);
 }
 
 SIMD_API void SimdNeuralAdaptiveGradientUpdate(const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight)
 {
     typedef void(*SimdNeuralAdaptiveGradientUpdatePtr) (const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight);
-    const static SimdNeuralAdaptiveGradientUpdatePtr simdNeuralAdaptiveGradientUpdate = SIMD_FUNC4(NeuralAdaptiveGradientUpdate, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralAdaptiveGradientUpdatePtr> simdNeuralAdaptiveGradientUpdate = {
+        SIMD_AVX512BW_IMPL(NeuralAdaptiveGradientUpdate, 0) SIMD_AVX_IMPL(NeuralAdaptiveGradientUpdate, 0)
+        SIMD_SSE2_IMPL(NeuralAdaptiveGradientUpdate, 0) SIMD_NEON_IMPL(NeuralAdaptiveGradientUpdate, 0)
+        SIMD_BASE_IMPL(NeuralAdaptiveGradientUpdate) };
 
-    simdNeuralAdaptiveGradientUpdate(delta, size, batch, alpha, epsilon, gradient, weight);
+    simdNeuralAdaptiveGradientUpdate()(delta, size, batch, alpha, epsilon, gradient, weight);
 }
 
 SIMD_API void SimdNeuralAddConvolution2x2Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::F)
-        Avx512bw::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::F)
-        Sse2::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-        Base::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::NeuralAddConvolution2x2Forward)> simdNeuralAddConvolution2x2Forward = {
+        SIMD_AVX512BW_IMPL(NeuralAddConvolution2x2Forward, Avx512bw::F)
+        SIMD_AVX2_IMPL(NeuralAddConvolution2x2Forward, Avx2::F) SIMD_AVX_IMPL(NeuralAddConvolution2x2Forward, Avx::F)
+        SIMD_SSE2_IMPL(NeuralAddConvolution2x2Forward, Sse2::F) SIMD_NEON_IMPL(NeuralAddConvolution2x2Forward, Neon::F)
+        SIMD_BASE_IMPL(NeuralAddConvolution2x2Forward) };
+
+    simdNeuralAddConvolution2x2Forward(width)(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution3x3Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::F)
-        Avx512bw::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::F)
-        Sse2::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-        Base::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::NeuralAddConvolution3x3Forward)> simdNeuralAddConvolution3x3Forward = {
+        SIMD_AVX512BW_IMPL(NeuralAddConvolution3x3Forward, Avx512bw::F)
+        SIMD_AVX2_IMPL(NeuralAddConvolution3x3Forward, Avx2::F) SIMD_AVX_IMPL(NeuralAddConvolution3x3Forward, Avx::F)
+        SIMD_SSE2_IMPL(NeuralAddConvolution3x3Forward, Sse2::F) SIMD_NEON_IMPL(NeuralAddConvolution3x3Forward, Neon::F)
+        SIMD_BASE_IMPL(NeuralAddConvolution3x3Forward) };
+
+    simdNeuralAddConvolution3x3Forward(width)(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution4x4Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::F)
-        Avx512bw::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::F)
-        Sse2::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-        Base::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::NeuralAddConvolution4x4Forward)> simdNeuralAddConvolution4x4Forward = {
+        SIMD_AVX512BW_IMPL(NeuralAddConvolution4x4Forward, Avx512bw::F)
+        SIMD_AVX2_IMPL(NeuralAddConvolution4x4Forward, Avx2::F) SIMD_AVX_IMPL(NeuralAddConvolution4x4Forward, Avx::F)
+        SIMD_SSE2_IMPL(NeuralAddConvolution4x4Forward, Sse2::F) SIMD_NEON_IMPL(NeuralAddConvolution4x4Forward, Neon::F)
+        SIMD_BASE_IMPL(NeuralAddConvolution4x4Forward) };
+
+    simdNeuralAddConvolution4x4Forward(width)(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution5x5Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::F)
-        Avx512bw::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::F)
-        Sse2::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-        Base::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::NeuralAddConvolution5x5Forward)> simdNeuralAddConvolution5x5Forward = {
+        SIMD_AVX512BW_IMPL(NeuralAddConvolution5x5Forward, Avx512bw::F)
+        SIMD_AVX2_IMPL(NeuralAddConvolution5x5Forward, Avx2::F) SIMD_AVX_IMPL(NeuralAddConvolution5x5Forward, Avx::F)
+        SIMD_SSE2_IMPL(NeuralAddConvolution5x5Forward, Sse2::F) SIMD_NEON_IMPL(NeuralAddConvolution5x5Forward, Neon::F)
+        SIMD_BASE_IMPL(NeuralAddConvolution5x5Forward) };
+
+    simdNeuralAddConvolution5x5Forward(width)(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution2x2Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
     typedef void(*SimdNeuralAddConvolution2x2BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-    const static SimdNeuralAddConvolution2x2BackwardPtr simdNeuralAddConvolution2x2Backward = SIMD_FUNC5(NeuralAddConvolution2x2Backward, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralAddConvolution2x2BackwardPtr> simdNeuralAddConvolution2x2Backward = {
+        SIMD_AVX512BW_IMPL(NeuralAddConvolution2x2Backward, 0) SIMD_AVX2_IMPL(NeuralAddConvolution2x2Backward, 0)
+        SIMD_AVX_IMPL(NeuralAddConvolution2x2Backward, 0) SIMD_SSE2_IMPL(NeuralAddConvolution2x2Backward, 0)
+        SIMD_NEON_IMPL(NeuralAddConvolution2x2Backward, 0) SIMD_BASE_IMPL(NeuralAddConvolution2x2Backward) };
 
-    simdNeuralAddConvolution2x2Backward(src, srcStride, width, height, weights, dst, dstStride);
+    simdNeuralAddConvolution2x2Backward()(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution3x3Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
     typedef void(*SimdNeuralAddConvolution3x3BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-    const static SimdNeuralAddConvolution3x3BackwardPtr simdNeuralAddConvolution3x3Backward = SIMD_FUNC5(NeuralAddConvolution3x3Backward, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralAddConvolution3x3BackwardPtr> simdNeuralAddConvolution3x3Backward = {
+        SIMD_AVX512BW_IMPL(NeuralAddConvolution3x3Backward, 0) SIMD_AVX2_IMPL(NeuralAddConvolution3x3Backward, 0)
+        SIMD_AVX_IMPL(NeuralAddConvolution3x3Backward, 0) SIMD_SSE2_IMPL(NeuralAddConvolution3x3Backward, 0)
+        SIMD_NEON_IMPL(NeuralAddConvolution3x3Backward, 0) SIMD_BASE_IMPL(NeuralAddConvolution3x3Backward) };
 
-    simdNeuralAddConvolution3x3Backward(src, srcStride, width, height, weights, dst, dstStride);
+    simdNeuralAddConvolution3x3Backward()(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution4x4Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
     typedef void(*SimdNeuralAddConvolution4x4BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-    const static SimdNeuralAddConvolution4x4BackwardPtr simdNeuralAddConvolution4x4Backward = SIMD_FUNC5(NeuralAddConvolution4x4Backward, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralAddConvolution4x4BackwardPtr> simdNeuralAddConvolution4x4Backward = {
+        SIMD_AVX512BW_IMPL(NeuralAddConvolution4x4Backward, 0) SIMD_AVX2_IMPL(NeuralAddConvolution4x4Backward, 0)
+        SIMD_AVX_IMPL(NeuralAddConvolution4x4Backward, 0) SIMD_SSE2_IMPL(NeuralAddConvolution4x4Backward, 0)
+        SIMD_NEON_IMPL(NeuralAddConvolution4x4Backward, 0) SIMD_BASE_IMPL(NeuralAddConvolution4x4Backward) };
 
-    simdNeuralAddConvolution4x4Backward(src, srcStride, width, height, weights, dst, dstStride);
+    simdNeuralAddConvolution4x4Backward()(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution5x5Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
     typedef void(*SimdNeuralAddConvolution5x5BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-    const static SimdNeuralAddConvolution5x5BackwardPtr simdNeuralAddConvolution5x5Backward = SIMD_FUNC5(NeuralAddConvolution5x5Backward, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralAddConvolution5x5BackwardPtr> simdNeuralAddConvolution5x5Backward = {
+        SIMD_AVX512BW_IMPL(NeuralAddConvolution5x5Backward, 0) SIMD_AVX2_IMPL(NeuralAddConvolution5x5Backward, 0)
+        SIMD_AVX_IMPL(NeuralAddConvolution5x5Backward, 0) SIMD_SSE2_IMPL(NeuralAddConvolution5x5Backward, 0)
+        SIMD_NEON_IMPL(NeuralAddConvolution5x5Backward, 0) SIMD_BASE_IMPL(NeuralAddConvolution5x5Backward) };
 
-    simdNeuralAddConvolution5x5Backward(src, srcStride, width, height, weights, dst, dstStride);
+    simdNeuralAddConvolution5x5Backward()(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralAddConvolution2x2Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::F)
-        Avx512bw::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::F)
-        Sse41::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::F)
-        Sse2::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-        Base::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+    const static Simd::Dispatch<decltype(&Base::NeuralAddConvolution2x2Sum)> simdNeuralAddConvolution2x2Sum = {
+        SIMD_AVX512BW_IMPL(NeuralAddConvolution2x2Sum, Avx512bw::F) SIMD_AVX2_IMPL(NeuralAddConvolution2x2Sum, Avx2::F)
+        SIMD_AVX_IMPL(NeuralAddConvolution2x2Sum, Avx::F) SIMD_SSE41_IMPL(NeuralAddConvolution2x2Sum, Sse41::F)
+        SIMD_SSE2_IMPL(NeuralAddConvolution2x2Sum, Sse2::F) SIMD_NEON_IMPL(NeuralAddConvolution2x2Sum, Neon::F)
+        SIMD_BASE_IMPL(NeuralAddConvolution2x2Sum) };
+
+    simdNeuralAddConvolution2x2Sum(width)(src, srcStride, dst, dstStride, width, height, sums);
 }
 
 SIMD_API void SimdNeuralAddConvolution3x3Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::F)
-        Avx512bw::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::F)
-        Sse41::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::F)
-        Sse2::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-        Base::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+    const static Simd::Dispatch<decltype(&Base::NeuralAddConvolution3x3Sum)> simdNeuralAddConvolution3x3Sum = {
+        SIMD_AVX512BW_IMPL(NeuralAddConvolution3x3Sum, Avx512bw::F) SIMD_AVX2_IMPL(NeuralAddConvolution3x3Sum, Avx2::F)
+        SIMD_AVX_IMPL(NeuralAddConvolution3x3Sum, Avx::F) SIMD_SSE41_IMPL(NeuralAddConvolution3x3Sum, Sse41::F)
+        SIMD_SSE2_IMPL(NeuralAddConvolution3x3Sum, Sse2::F) SIMD_NEON_IMPL(NeuralAddConvolution3x3Sum, Neon::F)
+        SIMD_BASE_IMPL(NeuralAddConvolution3x3Sum) };
+
+    simdNeuralAddConvolution3x3Sum(width)(src, srcStride, dst, dstStride, width, height, sums);
 }
 
 SIMD_API void SimdNeuralAddConvolution4x4Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::F)
-        Avx512bw::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::F)
-        Sse41::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::F)
-        Sse2::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-        Base::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+    const static Simd::Dispatch<decltype(&Base::NeuralAddConvolution4x4Sum)> simdNeuralAddConvolution4x4Sum = {
+        SIMD_AVX512BW_IMPL(NeuralAddConvolution4x4Sum, Avx512bw::F) SIMD_AVX2_IMPL(NeuralAddConvolution4x4Sum, Avx2::F)
+        SIMD_AVX_IMPL(NeuralAddConvolution4x4Sum, Avx::F) SIMD_SSE41_IMPL(NeuralAddConvolution4x4Sum, Sse41::F)
+        SIMD_SSE2_IMPL(NeuralAddConvolution4x4Sum, Sse2::F) SIMD_NEON_IMPL(NeuralAddConvolution4x4Sum, Neon::F)
+        SIMD_BASE_IMPL(NeuralAddConvolution4x4Sum) };
+
+    simdNeuralAddConvolution4x4Sum(width)(src, srcStride, dst, dstStride, width, height, sums);
 }
 
 SIMD_API void SimdNeuralAddConvolution5x5Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::F)
-        Avx512bw::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::F)
-        Sse41::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::F)
-        Sse2::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-        Base::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+    const static Simd::Dispatch<decltype(&Base::NeuralAddConvolution5x5Sum)> simdNeuralAddConvolution5x5Sum = {
+        SIMD_AVX512BW_IMPL(NeuralAddConvolution5x5Sum, Avx512bw::F) SIMD_AVX2_IMPL(NeuralAddConvolution5x5Sum, Avx2::F)
+        SIMD_AVX_IMPL(NeuralAddConvolution5x5Sum, Avx::F) SIMD_SSE41_IMPL(NeuralAddConvolution5x5Sum, Sse41::F)
+        SIMD_SSE2_IMPL(NeuralAddConvolution5x5Sum, Sse2::F) SIMD_NEON_IMPL(NeuralAddConvolution5x5Sum, Neon::F)
+        SIMD_BASE_IMPL(NeuralAddConvolution5x5Sum) };
+
+    simdNeuralAddConvolution5x5Sum(width)(src, srcStride, dst, dstStride, width, height, sums);
 }
 
 SIMD_API void SimdNeuralPooling1x1Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::F)
-        Avx512bw::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width > Avx2::F)
-        Avx2::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width > Sse2::F)
-        Sse2::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::F)
-        Neon::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::NeuralPooling1x1Max3x3)> simdNeuralPooling1x1Max3x3 = {
+        SIMD_AVX512BW_IMPL(NeuralPooling1x1Max3x3, Avx512bw::F + 1) SIMD_AVX2_IMPL(NeuralPooling1x1Max3x3, Avx2::F + 1)
+        SIMD_SSE2_IMPL(NeuralPooling1x1Max3x3, Sse2::F + 1) SIMD_NEON_IMPL(NeuralPooling1x1Max3x3, Neon::F + 1)
+        SIMD_BASE_IMPL(NeuralPooling1x1Max3x3) };
+
+    simdNeuralPooling1x1Max3x3(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralPooling2x2Max2x2(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::DF)
-        Avx512bw::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::DF)
-        Avx::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::DF)
-        Sse2::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DF)
-        Neon::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::NeuralPooling2x2Max2x2)> simdNeuralPooling2x2Max2x2 = {
+        SIMD_AVX512BW_IMPL(NeuralPooling2x2Max2x2, Avx512bw::DF) SIMD_AVX_IMPL(NeuralPooling2x2Max2x2, Avx::DF)
+        SIMD_SSE2_IMPL(NeuralPooling2x2Max2x2, Sse2::DF) SIMD_NEON_IMPL(NeuralPooling2x2Max2x2, Neon::DF)
+        SIMD_BASE_IMPL(NeuralPooling2x2Max2x2) };
+
+    simdNeuralPooling2x2Max2x2(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::DF)
-        Avx512bw::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width > Avx2::DF)
-        Avx2::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width > Sse2::DF)
-        Sse2::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::DF)
-        Neon::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::NeuralPooling2x2Max3x3)> simdNeuralPooling2x2Max3x3 = {
+        SIMD_AVX512BW_IMPL(NeuralPooling2x2Max3x3, Avx512bw::DF + 1)
+        SIMD_AVX2_IMPL(NeuralPooling2x2Max3x3, Avx2::DF + 1) SIMD_SSE2_IMPL(NeuralPooling2x2Max3x3, Sse2::DF + 1)
+        SIMD_NEON_IMPL(NeuralPooling2x2Max3x3, Neon::DF + 1) SIMD_BASE_IMPL(NeuralPooling2x2Max3x3) };
+
+    simdNeuralPooling2x2Max3x3(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, 
@@ -4157,1428 +2246,597 @@ SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, s
     typedef void(*SimdNeuralConvolutionForwardPtr) (const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, 
         const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, 
         void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
-    const static SimdNeuralConvolutionForwardPtr simdNeuralConvolutionForward = SIMD_FUNC5(NeuralConvolutionForward, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdNeuralConvolutionForwardPtr> simdNeuralConvolutionForward = {
+        SIMD_AVX512BW_IMPL(NeuralConvolutionForward, 0) SIMD_AVX2_IMPL(NeuralConvolutionForward, 0)
+        SIMD_AVX_IMPL(NeuralConvolutionForward, 0) SIMD_SSE41_IMPL(NeuralConvolutionForward, 0)
+        SIMD_NEON_IMPL(NeuralConvolutionForward, 0) SIMD_BASE_IMPL(NeuralConvolutionForward) };
 
-    simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
+    simdNeuralConvolutionForward()(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
 }
 
 SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width*channelCount >= Avx2::A)
-        Avx2::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width*channelCount >= Sse2::A)
-        Sse2::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width*channelCount >= Vmx::A)
-        Vmx::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width*channelCount >= Neon::A)
-        Neon::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
-#endif
-        Base::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    const static Simd::Dispatch<decltype(&Base::OperationBinary8u)> simdOperationBinary8u = {
+        SIMD_AVX512BW_IMPL(OperationBinary8u, 0) SIMD_AVX2_IMPL(OperationBinary8u, Avx2::A)
+        SIMD_SSE2_IMPL(OperationBinary8u, Sse2::A) SIMD_VMX_IMPL(OperationBinary8u, Vmx::A)
+        SIMD_NEON_IMPL(OperationBinary8u, Neon::A) SIMD_BASE_IMPL(OperationBinary8u) };
+
+    simdOperationBinary8u(width*channelCount)(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
 }
 
 SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                                     size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
-#endif
-        Base::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    const static Simd::Dispatch<decltype(&Base::OperationBinary16i)> simdOperationBinary16i = {
+        SIMD_AVX512BW_IMPL(OperationBinary16i, 0) SIMD_AVX2_IMPL(OperationBinary16i, Avx2::HA)
+        SIMD_SSE2_IMPL(OperationBinary16i, Sse2::HA) SIMD_VMX_IMPL(OperationBinary16i, Vmx::HA)
+        SIMD_NEON_IMPL(OperationBinary16i, Neon::HA) SIMD_BASE_IMPL(OperationBinary16i) };
+
+    simdOperationBinary16i(width)(a, aStride, b, bStride, width, height, dst, dstStride, type);
 }
 
 SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::VectorProduct(vertical, horizontal, dst, stride, width, height);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::VectorProduct(vertical, horizontal, dst, stride, width, height);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::VectorProduct(vertical, horizontal, dst, stride, width, height);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::VectorProduct(vertical, horizontal, dst, stride, width, height);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::VectorProduct(vertical, horizontal, dst, stride, width, height);
-    else
-#endif
-        Base::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    const static Simd::Dispatch<decltype(&Base::VectorProduct)> simdVectorProduct = {
+        SIMD_AVX512BW_IMPL(VectorProduct, 0) SIMD_AVX2_IMPL(VectorProduct, Avx2::A)
+        SIMD_SSE2_IMPL(VectorProduct, Sse2::A) SIMD_VMX_IMPL(VectorProduct, Vmx::A)
+        SIMD_NEON_IMPL(VectorProduct, Neon::A) SIMD_BASE_IMPL(VectorProduct) };
+
+    simdVectorProduct(width)(vertical, horizontal, dst, stride, width, height);
+}
+
+SIMD_API void * SimdPipelineInit(size_t width, size_t height, SimdPixelFormatType format)
+{
+    return Base::PipelineInit(width, height, format);
+}
+
+SIMD_API SimdBool SimdPipelineAddConvert(void * pipeline, SimdPixelFormatType format)
+{
+    return ((Base::Pipeline*)pipeline)->AddConvert(format) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdPipelineAddResize(void * pipeline, size_t width, size_t height)
+{
+    return ((Base::Pipeline*)pipeline)->AddResize(width, height) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdPipelineAddGaussianBlur3x3(void * pipeline)
+{
+    return ((Base::Pipeline*)pipeline)->AddGaussianBlur3x3() ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdPipelineAddSobelAbs(void * pipeline, SimdBool dx)
+{
+    return ((Base::Pipeline*)pipeline)->AddSobelAbs(dx == SimdTrue) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdPipelineAddBinarization(void * pipeline, uint8_t value, uint8_t positive, uint8_t negative, SimdCompareType compareType)
+{
+    return ((Base::Pipeline*)pipeline)->AddBinarization(value, positive, negative, compareType) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdPipelineAddSetInput(void * pipeline, const float * lower, const float * upper, size_t channels, SimdTensorFormatType format)
+{
+    return ((Base::Pipeline*)pipeline)->AddSetInput(lower, upper, channels, format) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API void SimdPipelineRun(const void * pipeline, const uint8_t * const * src, const size_t * srcStride, uint8_t * dst, size_t dstStride)
+{
+    Base::ThreadBudgetScope budget(pipeline);
+    ((Base::Pipeline*)pipeline)->Run(src, srcStride, dst, dstStride);
 }
 
 SIMD_API void SimdReduceColor2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
     uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && srcWidth >= Avx2::DA)
-        Avx2::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && srcWidth >= Sse41::DA)
-        Sse41::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && srcWidth >= Sse2::DA)
-        Sse2::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth >= Neon::DA)
-        Neon::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
-#endif
-        Base::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+    const static Simd::Dispatch<decltype(&Base::ReduceColor2x2)> simdReduceColor2x2 = {
+        SIMD_AVX512BW_IMPL(ReduceColor2x2, 0) SIMD_AVX2_IMPL(ReduceColor2x2, Avx2::DA)
+        SIMD_SSE41_IMPL(ReduceColor2x2, Sse41::DA) SIMD_SSE2_IMPL(ReduceColor2x2, Sse2::DA)
+        SIMD_NEON_IMPL(ReduceColor2x2, Neon::DA) SIMD_BASE_IMPL(ReduceColor2x2) };
+
+    simdReduceColor2x2(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
 }
 
 SIMD_API void SimdReduceGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth >= Avx2::DA)
-        Avx2::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && srcWidth >= Sse41::DA)
-        Sse41::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth >= Sse2::DA)
-        Sse2::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth >= Vmx::DA)
-        Vmx::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth >= Neon::DA)
-        Neon::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-        Base::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    const static Simd::Dispatch<decltype(&Base::ReduceGray2x2)> simdReduceGray2x2 = {
+        SIMD_AVX512BW_IMPL(ReduceGray2x2, 0) SIMD_AVX2_IMPL(ReduceGray2x2, Avx2::DA)
+        SIMD_SSE41_IMPL(ReduceGray2x2, Sse41::DA) SIMD_SSE2_IMPL(ReduceGray2x2, Sse2::DA)
+        SIMD_VMX_IMPL(ReduceGray2x2, Vmx::DA) SIMD_NEON_IMPL(ReduceGray2x2, Neon::DA) SIMD_BASE_IMPL(ReduceGray2x2) };
+
+    simdReduceGray2x2(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
 }
 
 SIMD_API void SimdReduceGray3x3(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && srcWidth >= Avx512bw::DA)
-        Avx512bw::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth >= Avx2::DA)
-        Avx2::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth >= Sse2::A)
-        Sse2::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth >= Vmx::DA)
-        Vmx::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth >= Neon::DA)
-        Neon::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-        Base::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
+    const static Simd::Dispatch<decltype(&Base::ReduceGray3x3)> simdReduceGray3x3 = {
+        SIMD_AVX512BW_IMPL(ReduceGray3x3, Avx512bw::DA) SIMD_AVX2_IMPL(ReduceGray3x3, Avx2::DA)
+        SIMD_SSE2_IMPL(ReduceGray3x3, Sse2::A) SIMD_VMX_IMPL(ReduceGray3x3, Vmx::DA)
+        SIMD_NEON_IMPL(ReduceGray3x3, Neon::DA) SIMD_BASE_IMPL(ReduceGray3x3) };
+
+    simdReduceGray3x3(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
 }
 
 SIMD_API void SimdReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && srcWidth > Avx512bw::DA)
-        Avx512bw::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth > Avx2::DA)
-        Avx2::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && srcWidth > Sse41::A)
-        Sse41::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth > Sse2::A)
-        Sse2::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth > Vmx::DA)
-        Vmx::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth > Neon::DA)
-        Neon::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-        Base::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    const static Simd::Dispatch<decltype(&Base::ReduceGray4x4)> simdReduceGray4x4 = {
+        SIMD_AVX512BW_IMPL(ReduceGray4x4, Avx512bw::DA + 1) SIMD_AVX2_IMPL(ReduceGray4x4, Avx2::DA + 1)
+        SIMD_SSE41_IMPL(ReduceGray4x4, Sse41::A + 1) SIMD_SSE2_IMPL(ReduceGray4x4, Sse2::A + 1)
+        SIMD_VMX_IMPL(ReduceGray4x4, Vmx::DA + 1) SIMD_NEON_IMPL(ReduceGray4x4, Neon::DA + 1)
+        SIMD_BASE_IMPL(ReduceGray4x4) };
+
+    simdReduceGray4x4(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
 }
 
 SIMD_API void SimdReduceGray5x5(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && srcWidth >= Avx512bw::DA)
-        Avx512bw::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth >= Avx2::DA)
-        Avx2::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth >= Sse2::A)
-        Sse2::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth >= Vmx::DA)
-        Vmx::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth >= Neon::DA)
-        Neon::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-        Base::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
+    const static Simd::Dispatch<decltype(&Base::ReduceGray5x5)> simdReduceGray5x5 = {
+        SIMD_AVX512BW_IMPL(ReduceGray5x5, Avx512bw::DA) SIMD_AVX2_IMPL(ReduceGray5x5, Avx2::DA)
+        SIMD_SSE2_IMPL(ReduceGray5x5, Sse2::A) SIMD_VMX_IMPL(ReduceGray5x5, Vmx::DA)
+        SIMD_NEON_IMPL(ReduceGray5x5, Neon::DA) SIMD_BASE_IMPL(ReduceGray5x5) };
+
+    simdReduceGray5x5(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
 }
 
 SIMD_API void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Reorder16bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && size >= Avx2::A)
-        Avx2::Reorder16bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && size >= Sse41::A)
-        Sse41::Reorder16bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && size >= Sse2::A)
-        Sse2::Reorder16bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && size >= Vmx::A)
-        Vmx::Reorder16bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::Reorder16bit(src, size, dst);
-    else
-#endif
-        Base::Reorder16bit(src, size, dst);
-}
+    typedef void(*SimdReorder16bitPtr) (const uint8_t * src, size_t size, uint8_t * dst);
+    const static Simd::Dispatch<SimdReorder16bitPtr> simdReorder16bit = {
+        SIMD_AVX512BW_IMPL(Reorder16bit, 0) SIMD_AVX2_IMPL(Reorder16bit, Avx2::A)
+        SIMD_SSE41_IMPL(Reorder16bit, Sse41::A) SIMD_SSE2_IMPL(Reorder16bit, Sse2::A)
+        SIMD_VMX_IMPL(Reorder16bit, Vmx::A) SIMD_NEON_IMPL(Reorder16bit, Neon::A) SIMD_BASE_IMPL(Reorder16bit) };
 
-SIMD_API void SimdReorder32bit(const uint8_t * src, size_t size, uint8_t * dst)
-{
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Reorder32bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && size >= Avx2::A)
-        Avx2::Reorder32bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && size >= Sse41::A)
-        Sse41::Reorder32bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && size >= Sse2::A)
-        Sse2::Reorder32bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && size >= Vmx::A)
-        Vmx::Reorder32bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::Reorder32bit(src, size, dst);
-    else
-#endif
-        Base::Reorder32bit(src, size, dst);
+    simdReorder16bit(size)(src, size, dst);
+}
+
+SIMD_API void SimdReorder32bit(const uint8_t * src, size_t size, uint8_t * dst)
+{
+    typedef void(*SimdReorder32bitPtr) (const uint8_t * src, size_t size, uint8_t * dst);
+    const static Simd::Dispatch<SimdReorder32bitPtr> simdReorder32bit = {
+        SIMD_AVX512BW_IMPL(Reorder32bit, 0) SIMD_AVX2_IMPL(Reorder32bit, Avx2::A)
+        SIMD_SSE41_IMPL(Reorder32bit, Sse41::A) SIMD_SSE2_IMPL(Reorder32bit, Sse2::A)
+        SIMD_VMX_IMPL(Reorder32bit, Vmx::A) SIMD_NEON_IMPL(Reorder32bit, Neon::A) SIMD_BASE_IMPL(Reorder32bit) };
+
+    simdReorder32bit(size)(src, size, dst);
 }
 
 SIMD_API void SimdReorder64bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Reorder64bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && size >= Avx2::A)
-        Avx2::Reorder64bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && size >= Sse41::A)
-        Sse41::Reorder64bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && size >= Sse2::A)
-        Sse2::Reorder64bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && size >= Vmx::A)
-        Vmx::Reorder64bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::Reorder64bit(src, size, dst);
-    else
-#endif
-        Base::Reorder64bit(src, size, dst);
+    typedef void(*SimdReorder64bitPtr) (const uint8_t * src, size_t size, uint8_t * dst);
+    const static Simd::Dispatch<SimdReorder64bitPtr> simdReorder64bit = {
+        SIMD_AVX512BW_IMPL(Reorder64bit, 0) SIMD_AVX2_IMPL(Reorder64bit, Avx2::A)
+        SIMD_SSE41_IMPL(Reorder64bit, Sse41::A) SIMD_SSE2_IMPL(Reorder64bit, Sse2::A)
+        SIMD_VMX_IMPL(Reorder64bit, Vmx::A) SIMD_NEON_IMPL(Reorder64bit, Neon::A) SIMD_BASE_IMPL(Reorder64bit) };
+
+    simdReorder64bit(size)(src, size, dst);
 }
 
 SIMD_API void SimdResizeBilinear(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
     uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && dstWidth >= Avx512bw::A)
-        Avx512bw::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && dstWidth >= Avx2::A)
-        Avx2::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && dstWidth >= Sse41::A)
-        Sse41::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && dstWidth >= Sse2::A)
-        Sse2::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && dstWidth >= Vmx::A)
-        Vmx::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && dstWidth >= Neon::A)
-        Neon::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
-#endif
-        Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+    const static Simd::Dispatch<decltype(&Base::ResizeBilinear)> simdResizeBilinear = {
+        SIMD_AVX512BW_IMPL(ResizeBilinear, Avx512bw::A) SIMD_AVX2_IMPL(ResizeBilinear, Avx2::A)
+        SIMD_SSE41_IMPL(ResizeBilinear, Sse41::A) SIMD_SSE2_IMPL(ResizeBilinear, Sse2::A)
+        SIMD_VMX_IMPL(ResizeBilinear, Vmx::A) SIMD_NEON_IMPL(ResizeBilinear, Neon::A) SIMD_BASE_IMPL(ResizeBilinear) };
+
+    simdResizeBilinear(dstWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
 }
 
 SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
 {
     typedef void*(*SimdResizerInitPtr) (size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
-    const static SimdResizerInitPtr simdResizerInit = SIMD_FUNC6(ResizerInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdResizerInitPtr> simdResizerInit = {
+        SIMD_AVX512BW_IMPL(ResizerInit, 0) SIMD_AVX2_IMPL(ResizerInit, 0) SIMD_AVX_IMPL(ResizerInit, 0)
+        SIMD_SSE41_IMPL(ResizerInit, 0) SIMD_SSE2_IMPL(ResizerInit, 0) SIMD_NEON_IMPL(ResizerInit, 0)
+        SIMD_BASE_IMPL(ResizerInit) };
 
-    return simdResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+    return simdResizerInit()(srcX, srcY, dstX, dstY, channels, type, method);
 }
 
 SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
+    Base::ThreadBudgetScope budget(resizer);
     ((Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
 }
 
 SIMD_API void SimdRgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
-    else
-#endif
+    const static Simd::Dispatch<decltype(&Base::RgbToBgra)> simdRgbToBgra = {
+        SIMD_AVX512BW_IMPL(RgbToBgra, 0)
 #if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
-    else
+        SIMD_AVX2_IMPL(RgbToBgra, Avx2::A)
 #endif
-        Base::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
+        SIMD_SSE41_IMPL(RgbToBgra, Sse41::A)
+        SIMD_NEON_IMPL(RgbToBgra, Neon::A)
+        SIMD_BASE_IMPL(RgbToBgra)
+    };
+
+    simdRgbToBgra(width)(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
 }
 
 SIMD_API void SimdRgbToGray(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* gray, size_t grayStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
-    else
-#endif
+    const static Simd::Dispatch<decltype(&Base::RgbToGray)> simdRgbToGray = {
+        SIMD_AVX512BW_IMPL(RgbToGray, 0)
 #if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
-    else
+        SIMD_AVX2_IMPL(RgbToGray, Avx2::A)
 #endif
-        Base::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
+        SIMD_SSE41_IMPL(RgbToGray, Sse41::A)
+        SIMD_NEON_IMPL(RgbToGray, Neon::A)
+        SIMD_BASE_IMPL(RgbToGray)
+    };
+
+    simdRgbToGray(width)(rgb, width, height, rgbStride, gray, grayStride);
 }
 
 SIMD_API void SimdRgbaToGray(const uint8_t* rgba, size_t width, size_t height, size_t rgbaStride, uint8_t* gray, size_t grayStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::RgbaToGray(rgba, width, height, rgbaStride, gray, grayStride);
-    else
-#endif
-#if defined(SIMD_AVX2_ENABLE)
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::RgbaToGray(rgba, width, height, rgbaStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::RgbaToGray(rgba, width, height, rgbaStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::RgbaToGray(rgba, width, height, rgbaStride, gray, grayStride);
-    else
-#endif
-        Base::RgbaToGray(rgba, width, height, rgbaStride, gray, grayStride);
+    const static Simd::Dispatch<decltype(&Base::RgbaToGray)> simdRgbaToGray = {
+        SIMD_AVX512BW_IMPL(RgbaToGray, 0) SIMD_AVX2_IMPL(RgbaToGray, Avx2::A) SIMD_SSE2_IMPL(RgbaToGray, Sse2::A)
+        SIMD_NEON_IMPL(RgbaToGray, Neon::A) SIMD_BASE_IMPL(RgbaToGray) };
+
+    simdRgbaToGray(width)(rgba, width, height, rgbaStride, gray, grayStride);
 }
 
 SIMD_API void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-    else
-#endif
-        Base::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
+    const static Simd::Dispatch<decltype(&Base::SegmentationChangeIndex)> simdSegmentationChangeIndex = {
+        SIMD_AVX512BW_IMPL(SegmentationChangeIndex, 0) SIMD_AVX2_IMPL(SegmentationChangeIndex, Avx2::A)
+        SIMD_SSE2_IMPL(SegmentationChangeIndex, Sse2::A) SIMD_VMX_IMPL(SegmentationChangeIndex, Vmx::A)
+        SIMD_NEON_IMPL(SegmentationChangeIndex, Neon::A) SIMD_BASE_IMPL(SegmentationChangeIndex) };
+
+    simdSegmentationChangeIndex(width)(mask, stride, width, height, oldIndex, newIndex);
 }
 
 SIMD_API void SimdSegmentationFillSingleHoles(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SegmentationFillSingleHoles(mask, stride, width, height, index);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A + 2)
-        Avx2::SegmentationFillSingleHoles(mask, stride, width, height, index);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A + 2)
-        Sse2::SegmentationFillSingleHoles(mask, stride, width, height, index);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A + 2)
-        Vmx::SegmentationFillSingleHoles(mask, stride, width, height, index);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-        if (Neon::Enable && width > Neon::A + 2)
-            Neon::SegmentationFillSingleHoles(mask, stride, width, height, index);
-        else
-#endif
-        Base::SegmentationFillSingleHoles(mask, stride, width, height, index);
+    const static Simd::Dispatch<decltype(&Base::SegmentationFillSingleHoles)> simdSegmentationFillSingleHoles = {
+        SIMD_AVX512BW_IMPL(SegmentationFillSingleHoles, 0) SIMD_AVX2_IMPL(SegmentationFillSingleHoles, Avx2::A + 2 + 1)
+        SIMD_SSE2_IMPL(SegmentationFillSingleHoles, Sse2::A + 2 + 1)
+        SIMD_VMX_IMPL(SegmentationFillSingleHoles, Vmx::A + 2 + 1)
+        SIMD_NEON_IMPL(SegmentationFillSingleHoles, Neon::A + 2 + 1) SIMD_BASE_IMPL(SegmentationFillSingleHoles) };
+
+    simdSegmentationFillSingleHoles(width)(mask, stride, width, height, index);
 }
 
 SIMD_API void SimdSegmentationPropagate2x2(const uint8_t * parent, size_t parentStride, size_t width, size_t height, 
                                            uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride, 
                                            uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-        difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 1)
-        Avx2::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-        difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 1)
-        Sse2::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-        difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 1)
-        Vmx::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-        difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 1)
-        Neon::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-            difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-    else
-#endif
-        Base::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
+    const static Simd::Dispatch<decltype(&Base::SegmentationPropagate2x2)> simdSegmentationPropagate2x2 = {
+        SIMD_AVX512BW_IMPL(SegmentationPropagate2x2, 0) SIMD_AVX2_IMPL(SegmentationPropagate2x2, Avx2::A + 1)
+        SIMD_SSE2_IMPL(SegmentationPropagate2x2, Sse2::A + 1) SIMD_VMX_IMPL(SegmentationPropagate2x2, Vmx::A + 1)
+        SIMD_NEON_IMPL(SegmentationPropagate2x2, Neon::A + 1) SIMD_BASE_IMPL(SegmentationPropagate2x2) };
+
+    simdSegmentationPropagate2x2(width)(parent, parentStride, width, height, child, childStride,
         difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
 }
 
 SIMD_API void SimdSegmentationShrinkRegion(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
                                            ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A && *right - *left >= (ptrdiff_t)Avx2::A)
-        Avx2::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A && *right - *left >= (ptrdiff_t)Sse41::A)
-        Sse41::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A && *right - *left >= (ptrdiff_t)Vmx::A)
-        Vmx::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A && *right - *left >= (ptrdiff_t)Neon::A)
-        Neon::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
-    else
-#endif
-        Base::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
+    const static Simd::Dispatch<decltype(&Base::SegmentationShrinkRegion)> simdSegmentationShrinkRegion = {
+        SIMD_AVX512BW_IMPL(SegmentationShrinkRegion, 0) SIMD_AVX2_IMPL(SegmentationShrinkRegion, Avx2::A)
+        SIMD_SSE41_IMPL(SegmentationShrinkRegion, Sse41::A) SIMD_VMX_IMPL(SegmentationShrinkRegion, Vmx::A)
+        SIMD_NEON_IMPL(SegmentationShrinkRegion, Neon::A) SIMD_BASE_IMPL(SegmentationShrinkRegion) };
+
+    simdSegmentationShrinkRegion(*right > *left ? Simd::Min(width, size_t(*right - *left)) : 0)(mask, stride, width, height, index, left, top, right, bottom);
 }
 
 SIMD_API void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
     const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY,
     size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable)
-        Avx2::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable)
-        Sse2::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable)
-        Vmx::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-    else
-#endif
-        Base::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
+    typedef void(*SimdShiftBilinearPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY, size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride);
+    const static Simd::Dispatch<SimdShiftBilinearPtr> simdShiftBilinear = {
+        SIMD_AVX512BW_IMPL(ShiftBilinear, 0) SIMD_AVX2_IMPL(ShiftBilinear, 0) SIMD_SSE2_IMPL(ShiftBilinear, 0)
+        SIMD_VMX_IMPL(ShiftBilinear, 0) SIMD_NEON_IMPL(ShiftBilinear, 0) SIMD_BASE_IMPL(ShiftBilinear) };
+
+    simdShiftBilinear()(src, srcStride, width, height, channelCount, bkg, bkgStride,
         shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
 }
 
+static void SobelDxBand(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    const static Simd::Dispatch<decltype(&Base::SobelDx)> simdSobelDxBand = {
+        SIMD_AVX512BW_IMPL(SobelDx, Avx512bw::A + 1) SIMD_AVX2_IMPL(SobelDx, Avx2::A + 1)
+        SIMD_SSE41_IMPL(SobelDx, Sse41::A + 1) SIMD_SSE2_IMPL(SobelDx, Sse2::A + 1) SIMD_VMX_IMPL(SobelDx, Vmx::A + 1)
+        SIMD_NEON_IMPL(SobelDx, Neon::A + 1) SIMD_BASE_IMPL(SobelDx) };
+
+    simdSobelDxBand(width)(src, srcStride, width, height, dst, dstStride);
+}
+
 SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width > Sse41::A)
-        Sse41::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::SobelDx(src, srcStride, width, height, dst, dstStride);
+    ParallelFilterRows(src, srcStride, height, width * height, 1, dst, dstStride, width * sizeof(int16_t),
+        [=](const uint8_t * bandSrc, size_t bandHeight, uint8_t * bandDst, size_t bandDstStride)
+    {
+        SobelDxBand(bandSrc, srcStride, width, bandHeight, bandDst, bandDstStride);
+    });
 }
 
 SIMD_API void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width > Sse41::A)
-        Sse41::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::SobelDxAbs)> simdSobelDxAbs = {
+        SIMD_AVX512BW_IMPL(SobelDxAbs, Avx512bw::A + 1) SIMD_AVX2_IMPL(SobelDxAbs, Avx2::A + 1)
+        SIMD_SSE41_IMPL(SobelDxAbs, Sse41::A + 1) SIMD_VMX_IMPL(SobelDxAbs, Vmx::A + 1)
+        SIMD_NEON_IMPL(SobelDxAbs, Neon::A + 1) SIMD_BASE_IMPL(SobelDxAbs) };
+
+    simdSobelDxAbs(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdSobelDxAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::SobelDxAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDxAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width > Sse41::A)
-        Sse41::SobelDxAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDxAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::SobelDxAbsSum(src, stride, width, height, sum);
-    else
-#endif
-        Base::SobelDxAbsSum(src, stride, width, height, sum);
+    const static Simd::Dispatch<decltype(&Base::SobelDxAbsSum)> simdSobelDxAbsSum = {
+        SIMD_AVX512BW_IMPL(SobelDxAbsSum, Avx512bw::A + 1) SIMD_AVX2_IMPL(SobelDxAbsSum, Avx2::A + 1)
+        SIMD_SSE41_IMPL(SobelDxAbsSum, Sse41::A + 1) SIMD_VMX_IMPL(SobelDxAbsSum, Vmx::A + 1)
+        SIMD_NEON_IMPL(SobelDxAbsSum, Neon::A + 1) SIMD_BASE_IMPL(SobelDxAbsSum) };
+
+    simdSobelDxAbsSum(width)(src, stride, width, height, sum);
 }
 
 SIMD_API void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width > Sse41::A)
-        Sse41::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::SobelDy(src, srcStride, width, height, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::SobelDy)> simdSobelDy = {
+        SIMD_AVX512BW_IMPL(SobelDy, Avx512bw::A + 1) SIMD_AVX2_IMPL(SobelDy, Avx2::A + 1)
+        SIMD_SSE41_IMPL(SobelDy, Sse41::A + 1) SIMD_SSE2_IMPL(SobelDy, Sse2::A + 1) SIMD_VMX_IMPL(SobelDy, Vmx::A + 1)
+        SIMD_NEON_IMPL(SobelDy, Neon::A + 1) SIMD_BASE_IMPL(SobelDy) };
+
+    simdSobelDy(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width > Sse41::A)
-        Sse41::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::SobelDyAbs)> simdSobelDyAbs = {
+        SIMD_AVX512BW_IMPL(SobelDyAbs, Avx512bw::A + 1) SIMD_AVX2_IMPL(SobelDyAbs, Avx2::A + 1)
+        SIMD_SSE41_IMPL(SobelDyAbs, Sse41::A + 1) SIMD_VMX_IMPL(SobelDyAbs, Vmx::A + 1)
+        SIMD_NEON_IMPL(SobelDyAbs, Neon::A + 1) SIMD_BASE_IMPL(SobelDyAbs) };
+
+    simdSobelDyAbs(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdSobelDyAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::SobelDyAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDyAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width > Sse41::A)
-        Sse41::SobelDyAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDyAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::SobelDyAbsSum(src, stride, width, height, sum);
-    else
-#endif
-        Base::SobelDyAbsSum(src, stride, width, height, sum);
+    const static Simd::Dispatch<decltype(&Base::SobelDyAbsSum)> simdSobelDyAbsSum = {
+        SIMD_AVX512BW_IMPL(SobelDyAbsSum, Avx512bw::A + 1) SIMD_AVX2_IMPL(SobelDyAbsSum, Avx2::A + 1)
+        SIMD_SSE41_IMPL(SobelDyAbsSum, Sse41::A + 1) SIMD_VMX_IMPL(SobelDyAbsSum, Vmx::A + 1)
+        SIMD_NEON_IMPL(SobelDyAbsSum, Neon::A + 1) SIMD_BASE_IMPL(SobelDyAbsSum) };
+
+    simdSobelDyAbsSum(width)(src, stride, width, height, sum);
 }
 
 SIMD_API void SimdContourMetrics(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width > Sse41::A)
-        Sse41::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::ContourMetrics(src, srcStride, width, height, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::ContourMetrics)> simdContourMetrics = {
+        SIMD_AVX512BW_IMPL(ContourMetrics, Avx512bw::A + 1) SIMD_AVX2_IMPL(ContourMetrics, Avx2::A + 1)
+        SIMD_SSE41_IMPL(ContourMetrics, Sse41::A + 1) SIMD_VMX_IMPL(ContourMetrics, Vmx::A + 1)
+        SIMD_NEON_IMPL(ContourMetrics, Neon::A + 1) SIMD_BASE_IMPL(ContourMetrics) };
+
+    simdContourMetrics(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdContourMetricsMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                        const uint8_t * mask, size_t maskStride, uint8_t indexMin, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width > Sse41::A)
-        Sse41::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-    else
-#endif
-        Base::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::ContourMetricsMasked)> simdContourMetricsMasked = {
+        SIMD_AVX512BW_IMPL(ContourMetricsMasked, Avx512bw::A + 1) SIMD_AVX2_IMPL(ContourMetricsMasked, Avx2::A + 1)
+        SIMD_SSE41_IMPL(ContourMetricsMasked, Sse41::A + 1) SIMD_VMX_IMPL(ContourMetricsMasked, Vmx::A + 1)
+        SIMD_NEON_IMPL(ContourMetricsMasked, Neon::A + 1) SIMD_BASE_IMPL(ContourMetricsMasked) };
+
+    simdContourMetricsMasked(width)(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
 }
 
 SIMD_API void SimdContourAnchors(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t step, int16_t threshold, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
-    else
-#endif
-        Base::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::ContourAnchors)> simdContourAnchors = {
+        SIMD_AVX512BW_IMPL(ContourAnchors, Avx512bw::A + 1) SIMD_AVX2_IMPL(ContourAnchors, Avx2::A + 1)
+        SIMD_SSE2_IMPL(ContourAnchors, Sse2::A + 1) SIMD_VMX_IMPL(ContourAnchors, Vmx::A + 1)
+        SIMD_NEON_IMPL(ContourAnchors, Neon::A + 1) SIMD_BASE_IMPL(ContourAnchors) };
+
+    simdContourAnchors(width)(src, srcStride, width, height, step, threshold, dst, dstStride);
 }
 
 SIMD_API void SimdSquaredDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                           size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A)
-        Sse41::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-        Base::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
+    const static Simd::Dispatch<decltype(&Base::SquaredDifferenceSum)> simdSquaredDifferenceSum = {
+        SIMD_AVX512BW_IMPL(SquaredDifferenceSum, 0) SIMD_AVX2_IMPL(SquaredDifferenceSum, Avx2::A)
+        SIMD_SSE41_IMPL(SquaredDifferenceSum, Sse41::A) SIMD_SSE2_IMPL(SquaredDifferenceSum, Sse2::A)
+        SIMD_VMX_IMPL(SquaredDifferenceSum, Vmx::A) SIMD_NEON_IMPL(SquaredDifferenceSum, Neon::A)
+        SIMD_BASE_IMPL(SquaredDifferenceSum) };
+
+    simdSquaredDifferenceSum(width)(a, aStride, b, bStride, width, height, sum);
 }
 
 SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                           const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A)
-        Sse41::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-        Base::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
+    const static Simd::Dispatch<decltype(&Base::SquaredDifferenceSumMasked)> simdSquaredDifferenceSumMasked = {
+        SIMD_AVX512BW_IMPL(SquaredDifferenceSumMasked, 0) SIMD_AVX2_IMPL(SquaredDifferenceSumMasked, Avx2::A)
+        SIMD_SSE41_IMPL(SquaredDifferenceSumMasked, Sse41::A) SIMD_SSE2_IMPL(SquaredDifferenceSumMasked, Sse2::A)
+        SIMD_VMX_IMPL(SquaredDifferenceSumMasked, Vmx::A) SIMD_NEON_IMPL(SquaredDifferenceSumMasked, Neon::A)
+        SIMD_BASE_IMPL(SquaredDifferenceSumMasked) };
+
+    simdSquaredDifferenceSumMasked(width)(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
 }
 
 SIMD_API void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum)
 {
     typedef void (* SimdSquaredDifferenceSum32fPtr) (const float * a, const float * b, size_t size, float * sum);
-    const static SimdSquaredDifferenceSum32fPtr simdSquaredDifferenceSum32f = SIMD_FUNC5(SquaredDifferenceSum32f, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSquaredDifferenceSum32fPtr> simdSquaredDifferenceSum32f = {
+        SIMD_AVX512BW_IMPL(SquaredDifferenceSum32f, 0) SIMD_AVX_IMPL(SquaredDifferenceSum32f, 0)
+        SIMD_SSE2_IMPL(SquaredDifferenceSum32f, 0) SIMD_VSX_IMPL(SquaredDifferenceSum32f, 0)
+        SIMD_NEON_IMPL(SquaredDifferenceSum32f, 0) SIMD_BASE_IMPL(SquaredDifferenceSum32f) };
 
-    simdSquaredDifferenceSum32f(a, b, size, sum);
+    simdSquaredDifferenceSum32f()(a, b, size, sum);
 }
 
 SIMD_API void SimdSquaredDifferenceKahanSum32f(const float * a, const float * b, size_t size, float * sum)
 {
     typedef void (* SimdSquaredDifferenceKahanSum32fPtr) (const float * a, const float * b, size_t size, float * sum);
-    const static SimdSquaredDifferenceKahanSum32fPtr simdSquaredDifferenceKahanSum32f = SIMD_FUNC5(SquaredDifferenceKahanSum32f, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSquaredDifferenceKahanSum32fPtr> simdSquaredDifferenceKahanSum32f = {
+        SIMD_AVX512BW_IMPL(SquaredDifferenceKahanSum32f, 0) SIMD_AVX_IMPL(SquaredDifferenceKahanSum32f, 0)
+        SIMD_SSE2_IMPL(SquaredDifferenceKahanSum32f, 0) SIMD_VSX_IMPL(SquaredDifferenceKahanSum32f, 0)
+        SIMD_NEON_IMPL(SquaredDifferenceKahanSum32f, 0) SIMD_BASE_IMPL(SquaredDifferenceKahanSum32f) };
 
-    simdSquaredDifferenceKahanSum32f(a, b, size, sum);
+    simdSquaredDifferenceKahanSum32f()(a, b, size, sum);
 }
 
 SIMD_API void SimdGetStatistic(const uint8_t * src, size_t stride, size_t width, size_t height,
                   uint8_t * min, uint8_t * max, uint8_t * average)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GetStatistic(src, stride, width, height, min, max, average);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetStatistic(src, stride, width, height, min, max, average);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetStatistic(src, stride, width, height, min, max, average);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetStatistic(src, stride, width, height, min, max, average);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetStatistic(src, stride, width, height, min, max, average);
-    else
-#endif
-        Base::GetStatistic(src, stride, width, height, min, max, average);
+    const static Simd::Dispatch<decltype(&Base::GetStatistic)> simdGetStatistic = {
+        SIMD_AVX512BW_IMPL(GetStatistic, 0) SIMD_AVX2_IMPL(GetStatistic, Avx2::A) SIMD_SSE2_IMPL(GetStatistic, Sse2::A)
+        SIMD_VMX_IMPL(GetStatistic, Vmx::A) SIMD_NEON_IMPL(GetStatistic, Neon::A) SIMD_BASE_IMPL(GetStatistic) };
+
+    simdGetStatistic(width)(src, stride, width, height, min, max, average);
 }
 
 SIMD_API void SimdGetMoments(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
                 uint64_t * area, uint64_t * x, uint64_t * y, uint64_t * xx, uint64_t * xy, uint64_t * yy)
 {
+    const static Simd::Dispatch<decltype(&Base::GetMoments)> simdGetMoments = {
+        SIMD_AVX512BW_IMPL(GetMoments, Avx512bw::A) SIMD_AVX2_IMPL(GetMoments, Avx2::A)
+        SIMD_SSE2_IMPL(GetMoments, Sse2::A) SIMD_VMX_IMPL(GetMoments, Vmx::A) SIMD_NEON_IMPL(GetMoments, Neon::A)
+        SIMD_BASE_IMPL(GetMoments) };
+    const static Simd::Dispatch<decltype(&Base::GetMoments)> simdGetMomentsLarge = {
+        SIMD_AVX2_IMPL(GetMoments, Avx2::A) SIMD_SSE2_IMPL(GetMoments, Sse2::A) SIMD_BASE_IMPL(GetMoments) };
+
     const bool simd = width < SHRT_MAX && height < SHRT_MAX;
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A && simd)
-        Avx512bw::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A && simd)
-        Vmx::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A && simd)
-        Neon::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
-    else
-#endif
-        Base::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
+    (simd ? simdGetMoments : simdGetMomentsLarge)(width)(mask, stride, width, height, index, area, x, y, xx, xy, yy);
 }
 
 SIMD_API void SimdGetObjectMoments(const uint8_t* src, size_t srcStride, size_t width, size_t height, const uint8_t* mask, size_t maskStride, uint8_t index,
     uint64_t* n, uint64_t* s, uint64_t* sx, uint64_t* sy, uint64_t* sxx, uint64_t* sxy, uint64_t* syy)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GetObjectMoments(src, srcStride, width, height, mask, maskStride, index, n, s, sx, sy, sxx, sxy, syy);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::GetObjectMoments(src, srcStride, width, height, mask, maskStride, index, n, s, sx, sy, sxx, sxy, syy);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::GetObjectMoments(src, srcStride, width, height, mask, maskStride, index, n, s, sx, sy, sxx, sxy, syy);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetObjectMoments(src, srcStride, width, height, mask, maskStride, index, n, s, sx, sy, sxx, sxy, syy);
-    else
-#endif
-        Base::GetObjectMoments(src, srcStride, width, height, mask, maskStride, index, n, s, sx, sy, sxx, sxy, syy);
+    const static Simd::Dispatch<decltype(&Base::GetObjectMoments)> simdGetObjectMoments = {
+        SIMD_AVX512BW_IMPL(GetObjectMoments, 0) SIMD_AVX2_IMPL(GetObjectMoments, Avx2::A)
+        SIMD_SSE2_IMPL(GetObjectMoments, Sse2::A) SIMD_NEON_IMPL(GetObjectMoments, Neon::A)
+        SIMD_BASE_IMPL(GetObjectMoments) };
+
+    simdGetObjectMoments(width)(src, srcStride, width, height, mask, maskStride, index, n, s, sx, sy, sxx, sxy, syy);
 }
 
 SIMD_API void SimdGetRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GetRowSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetRowSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetRowSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetRowSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetRowSums(src, stride, width, height, sums);
-    else
-#endif
-        Base::GetRowSums(src, stride, width, height, sums);
+    const static Simd::Dispatch<decltype(&Base::GetRowSums)> simdGetRowSums = {
+        SIMD_AVX512BW_IMPL(GetRowSums, 0) SIMD_AVX2_IMPL(GetRowSums, Avx2::A) SIMD_SSE2_IMPL(GetRowSums, Sse2::A)
+        SIMD_VMX_IMPL(GetRowSums, Vmx::A) SIMD_NEON_IMPL(GetRowSums, Neon::A) SIMD_BASE_IMPL(GetRowSums) };
+
+    simdGetRowSums(width)(src, stride, width, height, sums);
 }
 
 SIMD_API void SimdGetColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GetColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetColSums(src, stride, width, height, sums);
-    else
-#endif
-        Base::GetColSums(src, stride, width, height, sums);
+    const static Simd::Dispatch<decltype(&Base::GetColSums)> simdGetColSums = {
+        SIMD_AVX512BW_IMPL(GetColSums, 0) SIMD_AVX2_IMPL(GetColSums, Avx2::A) SIMD_SSE2_IMPL(GetColSums, Sse2::A)
+        SIMD_VMX_IMPL(GetColSums, Vmx::A) SIMD_NEON_IMPL(GetColSums, Neon::A) SIMD_BASE_IMPL(GetColSums) };
+
+    simdGetColSums(width)(src, stride, width, height, sums);
 }
 
 SIMD_API void SimdGetAbsDyRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GetAbsDyRowSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetAbsDyRowSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetAbsDyRowSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetAbsDyRowSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetAbsDyRowSums(src, stride, width, height, sums);
-    else
-#endif
-        Base::GetAbsDyRowSums(src, stride, width, height, sums);
+    const static Simd::Dispatch<decltype(&Base::GetAbsDyRowSums)> simdGetAbsDyRowSums = {
+        SIMD_AVX512BW_IMPL(GetAbsDyRowSums, 0) SIMD_AVX2_IMPL(GetAbsDyRowSums, Avx2::A)
+        SIMD_SSE2_IMPL(GetAbsDyRowSums, Sse2::A) SIMD_VMX_IMPL(GetAbsDyRowSums, Vmx::A)
+        SIMD_NEON_IMPL(GetAbsDyRowSums, Neon::A) SIMD_BASE_IMPL(GetAbsDyRowSums) };
+
+    simdGetAbsDyRowSums(width)(src, stride, width, height, sums);
 }
 
 SIMD_API void SimdGetAbsDxColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GetAbsDxColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetAbsDxColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetAbsDxColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetAbsDxColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetAbsDxColSums(src, stride, width, height, sums);
-    else
-#endif
-        Base::GetAbsDxColSums(src, stride, width, height, sums);
+    const static Simd::Dispatch<decltype(&Base::GetAbsDxColSums)> simdGetAbsDxColSums = {
+        SIMD_AVX512BW_IMPL(GetAbsDxColSums, 0) SIMD_AVX2_IMPL(GetAbsDxColSums, Avx2::A)
+        SIMD_SSE2_IMPL(GetAbsDxColSums, Sse2::A) SIMD_VMX_IMPL(GetAbsDxColSums, Vmx::A)
+        SIMD_NEON_IMPL(GetAbsDxColSums, Neon::A) SIMD_BASE_IMPL(GetAbsDxColSums) };
+
+    simdGetAbsDxColSums(width)(src, stride, width, height, sums);
 }
 
 SIMD_API void SimdValueSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ValueSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ValueSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ValueSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ValueSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ValueSum(src, stride, width, height, sum);
-    else
-#endif
-        Base::ValueSum(src, stride, width, height, sum);
+    const static Simd::Dispatch<decltype(&Base::ValueSum)> simdValueSum = {
+        SIMD_AVX512BW_IMPL(ValueSum, 0) SIMD_AVX2_IMPL(ValueSum, Avx2::A) SIMD_SSE2_IMPL(ValueSum, Sse2::A)
+        SIMD_VMX_IMPL(ValueSum, Vmx::A) SIMD_NEON_IMPL(ValueSum, Neon::A) SIMD_BASE_IMPL(ValueSum) };
+
+    simdValueSum(width)(src, stride, width, height, sum);
 }
 
 SIMD_API void SimdSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::SquareSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::SquareSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::SquareSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::SquareSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::SquareSum(src, stride, width, height, sum);
-    else
-#endif
-        Base::SquareSum(src, stride, width, height, sum);
+    const static Simd::Dispatch<decltype(&Base::SquareSum)> simdSquareSum = {
+        SIMD_AVX512BW_IMPL(SquareSum, 0) SIMD_AVX2_IMPL(SquareSum, Avx2::A) SIMD_SSE2_IMPL(SquareSum, Sse2::A)
+        SIMD_VMX_IMPL(SquareSum, Vmx::A) SIMD_NEON_IMPL(SquareSum, Neon::A) SIMD_BASE_IMPL(SquareSum) };
+
+    simdSquareSum(width)(src, stride, width, height, sum);
 }
 
 SIMD_API void SimdValueSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * valueSum, uint64_t * squareSum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
-    else
-#endif
-        Base::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
+    const static Simd::Dispatch<decltype(&Base::ValueSquareSum)> simdValueSquareSum = {
+        SIMD_AVX512BW_IMPL(ValueSquareSum, 0) SIMD_AVX2_IMPL(ValueSquareSum, Avx2::A)
+        SIMD_SSE2_IMPL(ValueSquareSum, Sse2::A) SIMD_NEON_IMPL(ValueSquareSum, Neon::A) SIMD_BASE_IMPL(ValueSquareSum) };
+
+    simdValueSquareSum(width)(src, stride, width, height, valueSum, squareSum);
 }
 
 SIMD_API void SimdValueSquareSums(const uint8_t* src, size_t stride, size_t width, size_t height, size_t channels, uint64_t* valueSums, uint64_t* squareSums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ValueSquareSums(src, stride, width, height, channels, valueSums, squareSums);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::ValueSquareSums(src, stride, width, height, channels, valueSums, squareSums);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse2::A)
-        Sse41::ValueSquareSums(src, stride, width, height, channels, valueSums, squareSums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ValueSquareSums(src, stride, width, height, channels, valueSums, squareSums);
-    else
-#endif
-        Base::ValueSquareSums(src, stride, width, height, channels, valueSums, squareSums);
+    const static Simd::Dispatch<decltype(&Base::ValueSquareSums)> simdValueSquareSums = {
+        SIMD_AVX512BW_IMPL(ValueSquareSums, 0) SIMD_AVX2_IMPL(ValueSquareSums, Avx2::A)
+        SIMD_SSE41_IMPL(ValueSquareSums, Sse2::A) SIMD_NEON_IMPL(ValueSquareSums, Neon::A)
+        SIMD_BASE_IMPL(ValueSquareSums) };
+
+    simdValueSquareSums(width)(src, stride, width, height, channels, valueSums, squareSums);
 }
 
 SIMD_API void SimdCorrelationSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-        Base::CorrelationSum(a, aStride, b, bStride, width, height, sum);
+    const static Simd::Dispatch<decltype(&Base::CorrelationSum)> simdCorrelationSum = {
+        SIMD_AVX512BW_IMPL(CorrelationSum, 0) SIMD_AVX2_IMPL(CorrelationSum, Avx2::A)
+        SIMD_SSE2_IMPL(CorrelationSum, Sse2::A) SIMD_VMX_IMPL(CorrelationSum, Vmx::A)
+        SIMD_NEON_IMPL(CorrelationSum, Neon::A) SIMD_BASE_IMPL(CorrelationSum) };
+
+    simdCorrelationSum(width)(a, aStride, b, bStride, width, height, sum);
 }
 
 SIMD_API void SimdStretchGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                     uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth >= Avx2::A)
-        Avx2::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth >= Sse2::A)
-        Sse2::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth >= Vmx::A)
-        Vmx::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth >= Neon::A)
-        Neon::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-        Base::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    const static Simd::Dispatch<decltype(&Base::StretchGray2x2)> simdStretchGray2x2 = {
+        SIMD_AVX512BW_IMPL(StretchGray2x2, 0) SIMD_AVX2_IMPL(StretchGray2x2, Avx2::A)
+        SIMD_SSE2_IMPL(StretchGray2x2, Sse2::A) SIMD_VMX_IMPL(StretchGray2x2, Vmx::A)
+        SIMD_NEON_IMPL(StretchGray2x2, Neon::A) SIMD_BASE_IMPL(StretchGray2x2) };
+
+    simdStretchGray2x2(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
 }
 
 SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum)
 {
     typedef void(*SimdSvmSumLinearPtr) (const float* x, const float* svs, const float* weights, size_t length, size_t count, float* sum);
-    const static SimdSvmSumLinearPtr simdSvmSumLinear = SIMD_FUNC5(SvmSumLinear, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSvmSumLinearPtr> simdSvmSumLinear = {
+        SIMD_AVX512BW_IMPL(SvmSumLinear, 0) SIMD_AVX_IMPL(SvmSumLinear, 0) SIMD_SSE2_IMPL(SvmSumLinear, 0)
+        SIMD_VSX_IMPL(SvmSumLinear, 0) SIMD_NEON_IMPL(SvmSumLinear, 0) SIMD_BASE_IMPL(SvmSumLinear) };
 
-    simdSvmSumLinear(x, svs, weights, length, count, sum);
+    simdSvmSumLinear()(x, svs, weights, length, count, sum);
 }
 
 SIMD_API void SimdSynetAddBias(const float * bias, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetAddBiasPtr) (const float * bias, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
-    const static SimdSynetAddBiasPtr simdSynetAddBias = SIMD_FUNC4(SynetAddBias, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetAddBiasPtr> simdSynetAddBias = {
+        SIMD_AVX512BW_IMPL(SynetAddBias, 0) SIMD_AVX_IMPL(SynetAddBias, 0) SIMD_SSE2_IMPL(SynetAddBias, 0)
+        SIMD_NEON_IMPL(SynetAddBias, 0) SIMD_BASE_IMPL(SynetAddBias) };
 
-    simdSynetAddBias(bias, channels, spatial, dst, format);
+    simdSynetAddBias()(bias, channels, spatial, dst, format);
 #else
     assert(0);
 #endif
@@ -5590,9 +2848,11 @@ SIMD_API void SimdSynetAdd8i(const uint8_t* aData, const float* aScale, const fl
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetAdd8iPtr) (const uint8_t* aData, const float* aScale, const float* aShift, const uint8_t* bData, const float* bScale, const float* bShift,
         uint8_t* cData, const float* cScale, const float* cShift, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetAdd8iPtr simdSynetAdd8i = SIMD_FUNC3(SynetAdd8i, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    const static Simd::Dispatch<SimdSynetAdd8iPtr> simdSynetAdd8i = {
+        SIMD_AVX512BW_IMPL(SynetAdd8i, 0) SIMD_AVX2_IMPL(SynetAdd8i, 0) SIMD_SSE41_IMPL(SynetAdd8i, 0)
+        SIMD_BASE_IMPL(SynetAdd8i) };
 
-    simdSynetAdd8i(aData, aScale, aShift, bData, bScale, bShift, cData, cScale, cShift, batch, channels, spatial, format, compatibility);
+    simdSynetAdd8i()(aData, aScale, aShift, bData, bScale, bShift, cData, cScale, cShift, batch, channels, spatial, format, compatibility);
 #else
     assert(0);
 #endif
@@ -5602,9 +2862,12 @@ SIMD_API void SimdSynetConvert32fTo8u(const float* src, size_t batch, size_t cha
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetConvert32fTo8uPtr) (const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetConvert32fTo8uPtr simdSynetConvert32fTo8u = SIMD_FUNC4(SynetConvert32fTo8u, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetConvert32fTo8uPtr> simdSynetConvert32fTo8u = {
+        SIMD_AVX512BW_IMPL(SynetConvert32fTo8u, 0) SIMD_AVX2_IMPL(SynetConvert32fTo8u, 0)
+        SIMD_SSE2_IMPL(SynetConvert32fTo8u, 0) SIMD_NEON_IMPL(SynetConvert32fTo8u, 0)
+        SIMD_BASE_IMPL(SynetConvert32fTo8u) };
 
-    simdSynetConvert32fTo8u(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
+    simdSynetConvert32fTo8u()(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
 #else
     assert(0);
 #endif
@@ -5614,9 +2877,20 @@ SIMD_API void SimdSynetConvert8uTo32f(const uint8_t* src, size_t batch, size_t c
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetConvert8uTo32fPtr) (const uint8_t* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, float* dst, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetConvert8uTo32fPtr simdSynetConvert8uTo32f = SIMD_FUNC3(SynetConvert8uTo32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);//, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetConvert8uTo32fPtr> simdSynetConvert8uTo32f = {
+        SIMD_AVX512BW_IMPL(SynetConvert8uTo32f, 0) SIMD_AVX2_IMPL(SynetConvert8uTo32f, 0)
+        SIMD_SSE41_IMPL(SynetConvert8uTo32f, 0) SIMD_BASE_IMPL(SynetConvert8uTo32f) };//, SIMD_NEON_FUNC);
+
+    simdSynetConvert8uTo32f()(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
+#else
+    assert(0);
+#endif
+}
 
-    simdSynetConvert8uTo32f(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
+SIMD_API void SimdSynetSetTuning(SimdBool enable, const char * database)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    Base::SynetSetTuning(enable, database);
 #else
     assert(0);
 #endif
@@ -5626,9 +2900,14 @@ SIMD_API void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionP
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void* (*SimdSynetConvolution32fInitPtr) (size_t batch, const SimdConvolutionParameters * params, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetConvolution32fInitPtr simdSynetConvolution32fInit = SIMD_FUNC8(SynetConvolution32fInit, SIMD_AMX_FUNC, SIMD_AVX512BF16_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-    return simdSynetConvolution32fInit(batch, params, compatibility);
+    const static Simd::Dispatch<SimdSynetConvolution32fInitPtr> simdSynetConvolution32fInit = {
+        SIMD_AMX_IMPL(SynetConvolution32fInit, 0) SIMD_AVX512BF16_IMPL(SynetConvolution32fInit, 0)
+        SIMD_AVX512BW_IMPL(SynetConvolution32fInit, 0) SIMD_AVX2_IMPL(SynetConvolution32fInit, 0)
+        SIMD_AVX_IMPL(SynetConvolution32fInit, 0) SIMD_SSE41_IMPL(SynetConvolution32fInit, 0)
+        SIMD_SSE2_IMPL(SynetConvolution32fInit, 0) SIMD_NEON_IMPL(SynetConvolution32fInit, 0)
+        SIMD_BASE_IMPL(SynetConvolution32fInit) };
+
+    return simdSynetConvolution32fInit()(batch, params, compatibility);
 #else
     assert(0);
     return 0;
@@ -5674,10 +2953,31 @@ SIMD_API void SimdSynetConvolution32fSetParams(void * context, const float * wei
 #endif
 }
 
+SIMD_API size_t SimdSynetConvolution32fExport(const void * context, void * data, size_t size)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    return ((const SynetConvolution32f*)context)->Export(data, size);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetConvolution32fImport(void * context, const void * data, size_t size, const float * weight, SimdBool * internal, const float * bias, const float * params)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution32f*)context)->Import(data, size, weight, internal, bias, params) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
 SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst)
 {
 #if defined(SIMD_SYNET_ENABLE)
     SynetConvolution32f * c = (SynetConvolution32f*)context;
+    Base::ThreadBudgetScope budget(c);
     SIMD_PERF_EXT(c);
     c->Forward(src, buf, dst);
 #else
@@ -5685,13 +2985,39 @@ SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src,
 #endif
 }
 
+SIMD_API SimdBool SimdSynetConvolution32fForwardAdd(void * context, const float * src, float * buf, float * dst)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    SynetConvolution32f * c = (SynetConvolution32f*)context;
+    Base::ThreadBudgetScope budget(c);
+    SIMD_PERF_EXT(c);
+    return c->ForwardAdd(src, buf, dst) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
+SIMD_API void * SimdSynetConvolution32fShare(void * context)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    return new SynetConvolution32fShared((SynetConvolution32f*)context);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
 SIMD_API void* SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void* (*SimdSynetConvolution8iInitPtr) (size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetConvolution8iInitPtr simdSynetConvolution8iInit = SIMD_FUNC5(SynetConvolution8iInit, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetConvolution8iInitPtr> simdSynetConvolution8iInit = {
+        SIMD_AVX512VNNI_IMPL(SynetConvolution8iInit, 0) SIMD_AVX512BW_IMPL(SynetConvolution8iInit, 0)
+        SIMD_AVX2_IMPL(SynetConvolution8iInit, 0) SIMD_SSE41_IMPL(SynetConvolution8iInit, 0)
+        SIMD_NEON_IMPL(SynetConvolution8iInit, 0) SIMD_BASE_IMPL(SynetConvolution8iInit) };
     
-    return simdSynetConvolution8iInit(batch, conv, compatibility);
+    return simdSynetConvolution8iInit()(batch, conv, compatibility);
 #else
     assert(0);
     return 0;
@@ -5737,10 +3063,31 @@ SIMD_API void SimdSynetConvolution8iSetParams(void* context, const float* weight
 #endif
 }
 
+SIMD_API size_t SimdSynetConvolution8iExport(const void* context, void* data, size_t size)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    return ((const SynetConvolution8i*)context)->Export(data, size);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetConvolution8iImport(void* context, const void* data, size_t size, const float* weight, const float* bias, const float* params, const float* const* stats)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution8i*)context)->Import(data, size, weight, bias, params, stats) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
 SIMD_API void SimdSynetConvolution8iForward(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst)
 {
 #if defined(SIMD_SYNET_ENABLE)
     SynetConvolution8i* c = (SynetConvolution8i*)context;
+    Base::ThreadBudgetScope budget(c);
     SIMD_PERF_EXT(c);
     c->Forward(src, buf, dst);
 #else
@@ -5748,13 +3095,26 @@ SIMD_API void SimdSynetConvolution8iForward(void* context, const uint8_t* src, u
 #endif
 }
 
+SIMD_API void* SimdSynetConvolution8iShare(void* context)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    return new SynetConvolution8iShared((SynetConvolution8i*)context);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
 SIMD_API void * SimdSynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * params, SimdSynetCompatibilityType compatibility)
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void* (*SimdSynetDeconvolution32fInitPtr) (size_t batch, const SimdConvolutionParameters * params, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetDeconvolution32fInitPtr simdSynetDeconvolution32fInit = SIMD_FUNC5(SynetDeconvolution32fInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetDeconvolution32fInitPtr> simdSynetDeconvolution32fInit = {
+        SIMD_AVX512BW_IMPL(SynetDeconvolution32fInit, 0) SIMD_AVX2_IMPL(SynetDeconvolution32fInit, 0)
+        SIMD_AVX_IMPL(SynetDeconvolution32fInit, 0) SIMD_SSE2_IMPL(SynetDeconvolution32fInit, 0)
+        SIMD_NEON_IMPL(SynetDeconvolution32fInit, 0) SIMD_BASE_IMPL(SynetDeconvolution32fInit) };
     
-    return simdSynetDeconvolution32fInit(batch, params, compatibility);
+    return simdSynetDeconvolution32fInit()(batch, params, compatibility);
 #else
     assert(0);
     return 0;
@@ -5804,6 +3164,7 @@ SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src
 {
 #if defined(SIMD_SYNET_ENABLE)
     SynetDeconvolution32f * d = (SynetDeconvolution32f*)context;
+    Base::ThreadBudgetScope budget(d);
     SIMD_PERF_EXT(d);
     d->Forward(src, buf, dst);
 #else
@@ -5815,9 +3176,12 @@ SIMD_API void SimdSynetEltwiseLayerForward(float const * const * src, const floa
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetEltwiseLayerForwardPtr) (float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
-    const static SimdSynetEltwiseLayerForwardPtr simdSynetEltwiseLayerForward = SIMD_FUNC5(SynetEltwiseLayerForward, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetEltwiseLayerForwardPtr> simdSynetEltwiseLayerForward = {
+        SIMD_AVX512BW_IMPL(SynetEltwiseLayerForward, 0) SIMD_AVX2_IMPL(SynetEltwiseLayerForward, 0)
+        SIMD_AVX_IMPL(SynetEltwiseLayerForward, 0) SIMD_SSE2_IMPL(SynetEltwiseLayerForward, 0)
+        SIMD_NEON_IMPL(SynetEltwiseLayerForward, 0) SIMD_BASE_IMPL(SynetEltwiseLayerForward) };
 
-    simdSynetEltwiseLayerForward(src, weight, count, size, type, dst);
+    simdSynetEltwiseLayerForward()(src, weight, count, size, type, dst);
 #else
     assert(0);
 #endif
@@ -5827,9 +3191,11 @@ SIMD_API void SimdSynetElu32f(const float * src, size_t size, const float * alph
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetElu32fPtr) (const float * src, size_t size, const float * alpha, float * dst);
-    const static SimdSynetElu32fPtr simdSynetElu32f = SIMD_FUNC4(SynetElu32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetElu32fPtr> simdSynetElu32f = {
+        SIMD_AVX512BW_IMPL(SynetElu32f, 0) SIMD_AVX2_IMPL(SynetElu32f, 0) SIMD_SSE2_IMPL(SynetElu32f, 0)
+        SIMD_NEON_IMPL(SynetElu32f, 0) SIMD_BASE_IMPL(SynetElu32f) };
 
-    simdSynetElu32f(src, size, alpha, dst);
+    simdSynetElu32f()(src, size, alpha, dst);
 #else
     assert(0);
 #endif
@@ -5839,9 +3205,12 @@ SIMD_API void SimdSynetFusedLayerForward0(const float * src, const float * bias,
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetFusedLayerForward0Ptr) (const float * src, const float * bias, const float * scale, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
-    const static SimdSynetFusedLayerForward0Ptr simdSynetFusedLayerForward0 = SIMD_FUNC4(SynetFusedLayerForward0, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetFusedLayerForward0Ptr> simdSynetFusedLayerForward0 = {
+        SIMD_AVX512BW_IMPL(SynetFusedLayerForward0, 0) SIMD_AVX_IMPL(SynetFusedLayerForward0, 0)
+        SIMD_SSE2_IMPL(SynetFusedLayerForward0, 0) SIMD_NEON_IMPL(SynetFusedLayerForward0, 0)
+        SIMD_BASE_IMPL(SynetFusedLayerForward0) };
 
-    simdSynetFusedLayerForward0(src, bias, scale, channels, spatial, dst, format);
+    simdSynetFusedLayerForward0()(src, bias, scale, channels, spatial, dst, format);
 #else
     assert(0);
 #endif
@@ -5851,9 +3220,12 @@ SIMD_API void SimdSynetFusedLayerForward1(const float * src, const float * bias0
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetFusedLayerForward1Ptr) (const float * src, const float * bias0, const float * scale1, const float * bias1, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
-    const static SimdSynetFusedLayerForward1Ptr simdSynetFusedLayerForward1 = SIMD_FUNC4(SynetFusedLayerForward1, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetFusedLayerForward1Ptr> simdSynetFusedLayerForward1 = {
+        SIMD_AVX512BW_IMPL(SynetFusedLayerForward1, 0) SIMD_AVX_IMPL(SynetFusedLayerForward1, 0)
+        SIMD_SSE2_IMPL(SynetFusedLayerForward1, 0) SIMD_NEON_IMPL(SynetFusedLayerForward1, 0)
+        SIMD_BASE_IMPL(SynetFusedLayerForward1) };
 
-    simdSynetFusedLayerForward1(src, bias0, scale1, bias1, channels, spatial, dst, format);
+    simdSynetFusedLayerForward1()(src, bias0, scale1, bias1, channels, spatial, dst, format);
 #else
     assert(0);
 #endif
@@ -5863,9 +3235,12 @@ SIMD_API void SimdSynetFusedLayerForward2(const float * src, const float * scale
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetFusedLayerForward2Ptr) (const float * src, const float * scale, const float * bias, size_t channels, size_t spatial, const float * slope, float * dst, SimdTensorFormatType format);
-    const static SimdSynetFusedLayerForward2Ptr simdSynetFusedLayerForward2 = SIMD_FUNC4(SynetFusedLayerForward2, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetFusedLayerForward2Ptr> simdSynetFusedLayerForward2 = {
+        SIMD_AVX512BW_IMPL(SynetFusedLayerForward2, 0) SIMD_AVX_IMPL(SynetFusedLayerForward2, 0)
+        SIMD_SSE2_IMPL(SynetFusedLayerForward2, 0) SIMD_NEON_IMPL(SynetFusedLayerForward2, 0)
+        SIMD_BASE_IMPL(SynetFusedLayerForward2) };
 
-    simdSynetFusedLayerForward2(src, scale, bias, channels, spatial, slope, dst, format);
+    simdSynetFusedLayerForward2()(src, scale, bias, channels, spatial, slope, dst, format);
 #else
     assert(0);
 #endif
@@ -5875,9 +3250,12 @@ SIMD_API void SimdSynetFusedLayerForward3(const float * src, const float * bias,
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetFusedLayerForward3Ptr) (const float * src, const float * bias, const float * scale, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
-    const static SimdSynetFusedLayerForward3Ptr simdSynetFusedLayerForward3 = SIMD_FUNC4(SynetFusedLayerForward3, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetFusedLayerForward3Ptr> simdSynetFusedLayerForward3 = {
+        SIMD_AVX512BW_IMPL(SynetFusedLayerForward3, 0) SIMD_AVX_IMPL(SynetFusedLayerForward3, 0)
+        SIMD_SSE2_IMPL(SynetFusedLayerForward3, 0) SIMD_NEON_IMPL(SynetFusedLayerForward3, 0)
+        SIMD_BASE_IMPL(SynetFusedLayerForward3) };
 
-    simdSynetFusedLayerForward3(src, bias, scale, channels, spatial, dst, format);
+    simdSynetFusedLayerForward3()(src, bias, scale, channels, spatial, dst, format);
 #else
     assert(0);
 #endif
@@ -5887,9 +3265,12 @@ SIMD_API void SimdSynetFusedLayerForward4(const float * src, const float * bias0
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetFusedLayerForward4Ptr) (const float * src, const float * bias0, const float * scale1, const float * bias1, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
-    const static SimdSynetFusedLayerForward4Ptr simdSynetFusedLayerForward4 = SIMD_FUNC4(SynetFusedLayerForward4, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetFusedLayerForward4Ptr> simdSynetFusedLayerForward4 = {
+        SIMD_AVX512BW_IMPL(SynetFusedLayerForward4, 0) SIMD_AVX_IMPL(SynetFusedLayerForward4, 0)
+        SIMD_SSE2_IMPL(SynetFusedLayerForward4, 0) SIMD_NEON_IMPL(SynetFusedLayerForward4, 0)
+        SIMD_BASE_IMPL(SynetFusedLayerForward4) };
 
-    simdSynetFusedLayerForward4(src, bias0, scale1, bias1, channels, spatial, dst, format);
+    simdSynetFusedLayerForward4()(src, bias0, scale1, bias1, channels, spatial, dst, format);
 #else
     assert(0);
 #endif
@@ -5899,9 +3280,12 @@ SIMD_API void SimdSynetFusedLayerForward8(const float * src0, const float * src1
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetFusedLayerForward8Ptr) (const float * src0, const float * src1, const float * src2, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
-    const static SimdSynetFusedLayerForward8Ptr simdSynetFusedLayerForward8 = SIMD_FUNC4(SynetFusedLayerForward8, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetFusedLayerForward8Ptr> simdSynetFusedLayerForward8 = {
+        SIMD_AVX512BW_IMPL(SynetFusedLayerForward8, 0) SIMD_AVX_IMPL(SynetFusedLayerForward8, 0)
+        SIMD_SSE2_IMPL(SynetFusedLayerForward8, 0) SIMD_NEON_IMPL(SynetFusedLayerForward8, 0)
+        SIMD_BASE_IMPL(SynetFusedLayerForward8) };
 
-    simdSynetFusedLayerForward8(src0, src1, src2, channels, spatial, dst, format);
+    simdSynetFusedLayerForward8()(src0, src1, src2, channels, spatial, dst, format);
 #else
     assert(0);
 #endif
@@ -5911,9 +3295,12 @@ SIMD_API void SimdSynetFusedLayerForward9(const float * src0, const float * src1
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetFusedLayerForward9Ptr) (const float * src0, const float * src1, const float * scale, const float * bias, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format);
-    const static SimdSynetFusedLayerForward9Ptr simdSynetFusedLayerForward9 = SIMD_FUNC4(SynetFusedLayerForward9, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetFusedLayerForward9Ptr> simdSynetFusedLayerForward9 = {
+        SIMD_AVX512BW_IMPL(SynetFusedLayerForward9, 0) SIMD_AVX_IMPL(SynetFusedLayerForward9, 0)
+        SIMD_SSE2_IMPL(SynetFusedLayerForward9, 0) SIMD_NEON_IMPL(SynetFusedLayerForward9, 0)
+        SIMD_BASE_IMPL(SynetFusedLayerForward9) };
 
-    simdSynetFusedLayerForward9(src0, src1, scale, bias, channels0, channels1, spatial, dst0, dst1, format);
+    simdSynetFusedLayerForward9()(src0, src1, scale, bias, channels0, channels1, spatial, dst0, dst1, format);
 #else
     assert(0);
 #endif
@@ -5923,9 +3310,12 @@ SIMD_API void SimdSynetHardSigmoid32f(const float* src, size_t size, const float
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetHardSigmoid32fPtr) (const float* src, size_t size, const float* scale, const float* shift, float* dst);
-    const static SimdSynetHardSigmoid32fPtr simdSynetHardSigmoid32f = SIMD_FUNC4(SynetHardSigmoid32f, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetHardSigmoid32fPtr> simdSynetHardSigmoid32f = {
+        SIMD_AVX512BW_IMPL(SynetHardSigmoid32f, 0) SIMD_AVX_IMPL(SynetHardSigmoid32f, 0)
+        SIMD_SSE2_IMPL(SynetHardSigmoid32f, 0) SIMD_NEON_IMPL(SynetHardSigmoid32f, 0)
+        SIMD_BASE_IMPL(SynetHardSigmoid32f) };
 
-    simdSynetHardSigmoid32f(src, size, scale, shift, dst);
+    simdSynetHardSigmoid32f()(src, size, scale, shift, dst);
 #else
     assert(0);
 #endif
@@ -5935,9 +3325,11 @@ SIMD_API void SimdSynetHswish32f(const float * src, size_t size, const float * s
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetHswish32fPtr) (const float * src, size_t size, const float * shift, const float * scale, float * dst);
-    const static SimdSynetHswish32fPtr simdSynetHswish32f = SIMD_FUNC4(SynetHswish32f, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetHswish32fPtr> simdSynetHswish32f = {
+        SIMD_AVX512BW_IMPL(SynetHswish32f, 0) SIMD_AVX_IMPL(SynetHswish32f, 0) SIMD_SSE2_IMPL(SynetHswish32f, 0)
+        SIMD_NEON_IMPL(SynetHswish32f, 0) SIMD_BASE_IMPL(SynetHswish32f) };
 
-    simdSynetHswish32f(src, size, shift, scale, dst);
+    simdSynetHswish32f()(src, size, shift, scale, dst);
 #else
 assert(0);
 #endif
@@ -5947,9 +3339,12 @@ SIMD_API void* SimdSynetInnerProduct32fInit(size_t batch, size_t input, size_t o
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void* (*SimdSynetInnerProduct32fInitPtr) (size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
-    const static SimdSynetInnerProduct32fInitPtr simdSynetInnerProduct32fInit = SIMD_FUNC5(SynetInnerProduct32fInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetInnerProduct32fInitPtr> simdSynetInnerProduct32fInit = {
+        SIMD_AVX512BW_IMPL(SynetInnerProduct32fInit, 0) SIMD_AVX2_IMPL(SynetInnerProduct32fInit, 0)
+        SIMD_AVX_IMPL(SynetInnerProduct32fInit, 0) SIMD_SSE41_IMPL(SynetInnerProduct32fInit, 0)
+        SIMD_NEON_IMPL(SynetInnerProduct32fInit, 0) SIMD_BASE_IMPL(SynetInnerProduct32fInit) };
 
-    return simdSynetInnerProduct32fInit(batch, input, output, transpose, activation);
+    return simdSynetInnerProduct32fInit()(batch, input, output, transpose, activation);
 #else
     assert(0);
     return 0;
@@ -5979,6 +3374,7 @@ SIMD_API void SimdSynetInnerProduct32fForward(void* context, const float* src, f
 {
 #if defined(SIMD_SYNET_ENABLE)
     SynetInnerProduct32f* c = (SynetInnerProduct32f*)context;
+    Base::ThreadBudgetScope budget(c);
     SIMD_PERF_EXT(c);
     c->Forward(src, dst);
 #else
@@ -5990,9 +3386,12 @@ SIMD_API void SimdSynetInnerProductLayerForward(const float * src, const float *
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetInnerProductLayerForwardPtr) (const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
-    const static SimdSynetInnerProductLayerForwardPtr simdSynetInnerProductLayerForward = SIMD_FUNC5(SynetInnerProductLayerForward, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetInnerProductLayerForwardPtr> simdSynetInnerProductLayerForward = {
+        SIMD_AVX512BW_IMPL(SynetInnerProductLayerForward, 0) SIMD_AVX2_IMPL(SynetInnerProductLayerForward, 0)
+        SIMD_AVX_IMPL(SynetInnerProductLayerForward, 0) SIMD_SSE2_IMPL(SynetInnerProductLayerForward, 0)
+        SIMD_NEON_IMPL(SynetInnerProductLayerForward, 0) SIMD_BASE_IMPL(SynetInnerProductLayerForward) };
 
-    simdSynetInnerProductLayerForward(src, weight, bias, count, size, dst);
+    simdSynetInnerProductLayerForward()(src, weight, bias, count, size, dst);
 #else
     assert(0);
 #endif
@@ -6002,9 +3401,11 @@ SIMD_API void SimdSynetInnerProduct8i(size_t M, size_t N, size_t K, const uint8_
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetInnerProduct8iPtr) (size_t M, size_t N, size_t K, const uint8_t* src, const int8_t* weight, int32_t* dst, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetInnerProduct8iPtr simdSynetInnerProduct8i = SIMD_FUNC3(SynetInnerProduct8i, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    const static Simd::Dispatch<SimdSynetInnerProduct8iPtr> simdSynetInnerProduct8i = {
+        SIMD_AVX512BW_IMPL(SynetInnerProduct8i, 0) SIMD_AVX2_IMPL(SynetInnerProduct8i, 0)
+        SIMD_SSE41_IMPL(SynetInnerProduct8i, 0) SIMD_BASE_IMPL(SynetInnerProduct8i) };
 
-    simdSynetInnerProduct8i(M, N, K, src, weight, dst, compatibility);
+    simdSynetInnerProduct8i()(M, N, K, src, weight, dst, compatibility);
 #else
     assert(0);
 #endif
@@ -6014,9 +3415,12 @@ SIMD_API void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, siz
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetLrnLayerCrossChannelsPtr) (const float * src, size_t half, size_t channels, size_t spatial, const float * k, float * dst, SimdTensorFormatType format);
-    const static SimdSynetLrnLayerCrossChannelsPtr simdSynetLrnLayerCrossChannels = SIMD_FUNC4(SynetLrnLayerCrossChannels, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetLrnLayerCrossChannelsPtr> simdSynetLrnLayerCrossChannels = {
+        SIMD_AVX512BW_IMPL(SynetLrnLayerCrossChannels, 0) SIMD_AVX2_IMPL(SynetLrnLayerCrossChannels, 0)
+        SIMD_SSE2_IMPL(SynetLrnLayerCrossChannels, 0) SIMD_NEON_IMPL(SynetLrnLayerCrossChannels, 0)
+        SIMD_BASE_IMPL(SynetLrnLayerCrossChannels) };
 
-    simdSynetLrnLayerCrossChannels(src, half, channels, spatial, k, dst, format);
+    simdSynetLrnLayerCrossChannels()(src, half, channels, spatial, k, dst, format);
 #else
     assert(0);
 #endif
@@ -6026,9 +3430,14 @@ SIMD_API void * SimdSynetMergedConvolution32fInit(size_t batch, const SimdConvol
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void* (*SimdSynetMergedConvolution32fInitPtr) (size_t batch, const SimdConvolutionParameters * convs, size_t count, SimdBool add, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetMergedConvolution32fInitPtr simdSynetMergedConvolution32fInit = SIMD_FUNC8(SynetMergedConvolution32fInit, SIMD_AMX_FUNC, SIMD_AVX512BF16_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-    return simdSynetMergedConvolution32fInit(batch, convs, count, add, compatibility);
+    const static Simd::Dispatch<SimdSynetMergedConvolution32fInitPtr> simdSynetMergedConvolution32fInit = {
+        SIMD_AMX_IMPL(SynetMergedConvolution32fInit, 0) SIMD_AVX512BF16_IMPL(SynetMergedConvolution32fInit, 0)
+        SIMD_AVX512BW_IMPL(SynetMergedConvolution32fInit, 0) SIMD_AVX2_IMPL(SynetMergedConvolution32fInit, 0)
+        SIMD_AVX_IMPL(SynetMergedConvolution32fInit, 0) SIMD_SSE41_IMPL(SynetMergedConvolution32fInit, 0)
+        SIMD_SSE2_IMPL(SynetMergedConvolution32fInit, 0) SIMD_NEON_IMPL(SynetMergedConvolution32fInit, 0)
+        SIMD_BASE_IMPL(SynetMergedConvolution32fInit) };
+
+    return simdSynetMergedConvolution32fInit()(batch, convs, count, add, compatibility);
 #else
     assert(0);
     return 0;
@@ -6078,6 +3487,7 @@ SIMD_API void SimdSynetMergedConvolution32fForward(void * context, const float *
 {
 #if defined(SIMD_SYNET_ENABLE)
     SynetMergedConvolution32f * c = (SynetMergedConvolution32f*)context;
+    Base::ThreadBudgetScope budget(c);
     SIMD_PERF_EXT(c);
     c->Forward(src, buf, dst);
 #else
@@ -6089,9 +3499,12 @@ SIMD_API void* SimdSynetMergedConvolution8iInit(size_t batch, const SimdConvolut
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void* (*SimdSynetMergedConvolution8iInitPtr) (size_t batch, const SimdConvolutionParameters* convs, size_t count, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetMergedConvolution8iInitPtr simdSynetMergedConvolution8iInit = SIMD_FUNC4(SynetMergedConvolution8iInit, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    const static Simd::Dispatch<SimdSynetMergedConvolution8iInitPtr> simdSynetMergedConvolution8iInit = {
+        SIMD_AVX512VNNI_IMPL(SynetMergedConvolution8iInit, 0) SIMD_AVX512BW_IMPL(SynetMergedConvolution8iInit, 0)
+        SIMD_AVX2_IMPL(SynetMergedConvolution8iInit, 0) SIMD_SSE41_IMPL(SynetMergedConvolution8iInit, 0)
+        SIMD_BASE_IMPL(SynetMergedConvolution8iInit) };
 
-    return simdSynetMergedConvolution8iInit(batch, convs, count, compatibility);
+    return simdSynetMergedConvolution8iInit()(batch, convs, count, compatibility);
 #else
     assert(0);
     return 0;
@@ -6141,6 +3554,7 @@ SIMD_API void SimdSynetMergedConvolution8iForward(void* context, const uint8_t*
 {
 #if defined(SIMD_SYNET_ENABLE)
     SynetMergedConvolution8i* c = (SynetMergedConvolution8i*)context;
+    Base::ThreadBudgetScope budget(c);
     SIMD_PERF_EXT(c);
     c->Forward(src, buf, dst);
 #else
@@ -6148,13 +3562,85 @@ SIMD_API void SimdSynetMergedConvolution8iForward(void* context, const uint8_t*
 #endif
 }
 
+SIMD_API void * SimdSynetPlannerInit()
+{
+#if defined(SIMD_SYNET_ENABLE)
+    return new Base::SynetPlanner();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetPlannerAddTensor(void * planner, size_t size)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    return ((Base::SynetPlanner*)planner)->AddTensor(size);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetPlannerAddLayer(void * planner, SimdSynetPlannerLayerType type, const void * context, const size_t * src, size_t srcCount, const size_t * dst, size_t dstCount)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    size_t buffer = 0;
+    switch (type)
+    {
+    case SimdSynetPlannerLayerConvolution32f: buffer = ((const SynetConvolution32f*)context)->ExternalBufferSize() * sizeof(float); break;
+    case SimdSynetPlannerLayerConvolution8i: buffer = ((const SynetConvolution8i*)context)->ExternalBufferSize(); break;
+    case SimdSynetPlannerLayerDeconvolution32f: buffer = ((const SynetDeconvolution32f*)context)->ExternalBufferSize() * sizeof(float); break;
+    case SimdSynetPlannerLayerMergedConvolution32f: buffer = ((const SynetMergedConvolution32f*)context)->ExternalBufferSize() * sizeof(float); break;
+    case SimdSynetPlannerLayerMergedConvolution8i: buffer = ((const SynetMergedConvolution8i*)context)->ExternalBufferSize(); break;
+    default: break;
+    }
+    return ((Base::SynetPlanner*)planner)->AddLayer(buffer, src, srcCount, dst, dstCount);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetPlannerPlan(void * planner)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    return ((Base::SynetPlanner*)planner)->Plan();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetPlannerTensorOffset(const void * planner, size_t tensor)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    return ((const Base::SynetPlanner*)planner)->TensorOffset(tensor);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetPlannerBufferOffset(const void * planner, size_t layer)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    return ((const Base::SynetPlanner*)planner)->BufferOffset(layer);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
 SIMD_API void SimdSynetMish32f(const float* src, size_t size, const float* threshold, float* dst)
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetMish32fPtr) (const float* src, size_t size, const float* threshold, float* dst);
-    const static SimdSynetMish32fPtr simdSynetMish32f = SIMD_FUNC4(SynetMish32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetMish32fPtr> simdSynetMish32f = {
+        SIMD_AVX512BW_IMPL(SynetMish32f, 0) SIMD_AVX2_IMPL(SynetMish32f, 0) SIMD_SSE2_IMPL(SynetMish32f, 0)
+        SIMD_NEON_IMPL(SynetMish32f, 0) SIMD_BASE_IMPL(SynetMish32f) };
 
-    simdSynetMish32f(src, size, threshold, dst);
+    simdSynetMish32f()(src, size, threshold, dst);
 #else
     assert(0);
 #endif
@@ -6166,9 +3652,12 @@ void SimdSynetPoolingAverage(const float* src, size_t srcC, size_t srcH, size_t
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetPoolingAveragePtr) (const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
         size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, SimdBool exludePad, SimdTensorFormatType format);
-    const static SimdSynetPoolingAveragePtr simdSynetPoolingAverage = SIMD_FUNC4(SynetPoolingAverage, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetPoolingAveragePtr> simdSynetPoolingAverage = {
+        SIMD_AVX512BW_IMPL(SynetPoolingAverage, 0) SIMD_AVX_IMPL(SynetPoolingAverage, 0)
+        SIMD_SSE2_IMPL(SynetPoolingAverage, 0) SIMD_NEON_IMPL(SynetPoolingAverage, 0)
+        SIMD_BASE_IMPL(SynetPoolingAverage) };
 
-    simdSynetPoolingAverage(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, excludePad, format);
+    simdSynetPoolingAverage()(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, excludePad, format);
 #else
     assert(0);
 #endif
@@ -6182,9 +3671,11 @@ SIMD_API void SimdSynetPoolingMax32f(const float* src, size_t srcC, size_t srcH,
     typedef void(*SimdSynetPoolingMax32fPtr) (const float* src, size_t srcC, size_t srcH, size_t srcW,
         size_t kernelC, size_t kernelY, size_t kernelX, size_t strideC, size_t strideY, size_t strideX,
         size_t padC, size_t padY, size_t padX, float* dst, size_t dstC, size_t dstH, size_t dstW, SimdTensorFormatType format);
-    const static SimdSynetPoolingMax32fPtr simdSynetPoolingMax32f = SIMD_FUNC4(SynetPoolingMax32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetPoolingMax32fPtr> simdSynetPoolingMax32f = {
+        SIMD_AVX512BW_IMPL(SynetPoolingMax32f, 0) SIMD_AVX2_IMPL(SynetPoolingMax32f, 0)
+        SIMD_SSE41_IMPL(SynetPoolingMax32f, 0) SIMD_NEON_IMPL(SynetPoolingMax32f, 0) SIMD_BASE_IMPL(SynetPoolingMax32f) };
 
-    simdSynetPoolingMax32f(src, srcC, srcH, srcW, kernelC, kernelY, kernelX, strideC, strideY, strideX, padC, padY, padX, dst, dstC, dstH, dstW, format);
+    simdSynetPoolingMax32f()(src, srcC, srcH, srcW, kernelC, kernelY, kernelX, strideC, strideY, strideX, padC, padY, padX, dst, dstC, dstH, dstW, format);
 #else
     assert(0);
 #endif
@@ -6196,9 +3687,11 @@ SIMD_API void SimdSynetPoolingMax8u(const uint8_t* src, size_t srcC, size_t srcH
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetPoolingMax8uPtr) (const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
         size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
-    const static SimdSynetPoolingMax8uPtr simdSynetPoolingMax8u = SIMD_FUNC4(SynetPoolingMax8u, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetPoolingMax8uPtr> simdSynetPoolingMax8u = {
+        SIMD_AVX512BW_IMPL(SynetPoolingMax8u, 0) SIMD_AVX2_IMPL(SynetPoolingMax8u, 0)
+        SIMD_SSE41_IMPL(SynetPoolingMax8u, 0) SIMD_NEON_IMPL(SynetPoolingMax8u, 0) SIMD_BASE_IMPL(SynetPoolingMax8u) };
 
-    simdSynetPoolingMax8u(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, format);
+    simdSynetPoolingMax8u()(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, format);
 #else
     assert(0);
 #endif
@@ -6208,9 +3701,12 @@ SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope,
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetPreluLayerForwardPtr) (const float * src, const float * slope, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
-    const static SimdSynetPreluLayerForwardPtr simdSynetPreluLayerForward = SIMD_FUNC4(SynetPreluLayerForward, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetPreluLayerForwardPtr> simdSynetPreluLayerForward = {
+        SIMD_AVX512BW_IMPL(SynetPreluLayerForward, 0) SIMD_AVX_IMPL(SynetPreluLayerForward, 0)
+        SIMD_SSE2_IMPL(SynetPreluLayerForward, 0) SIMD_NEON_IMPL(SynetPreluLayerForward, 0)
+        SIMD_BASE_IMPL(SynetPreluLayerForward) };
 
-    simdSynetPreluLayerForward(src, slope, channels, spatial, dst, format);
+    simdSynetPreluLayerForward()(src, slope, channels, spatial, dst, format);
 #else
     assert(0);
 #endif
@@ -6220,9 +3716,11 @@ SIMD_API void SimdSynetRelu32f(const float* src, size_t size, const float* slope
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetRelu32fPtr) (const float* src, size_t size, const float* slope, float* dst);
-    const static SimdSynetRelu32fPtr simdSynetRelu32f = SIMD_FUNC4(SynetRelu32f, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetRelu32fPtr> simdSynetRelu32f = {
+        SIMD_AVX512BW_IMPL(SynetRelu32f, 0) SIMD_AVX_IMPL(SynetRelu32f, 0) SIMD_SSE2_IMPL(SynetRelu32f, 0)
+        SIMD_NEON_IMPL(SynetRelu32f, 0) SIMD_BASE_IMPL(SynetRelu32f) };
 
-    simdSynetRelu32f(src, size, slope, dst);
+    simdSynetRelu32f()(src, size, slope, dst);
 #else
     assert(0);
 #endif
@@ -6232,9 +3730,11 @@ SIMD_API void SimdSynetReorderImage(size_t batch, size_t channels, size_t spatia
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetReorderImagePtr) (size_t batch, size_t channels, size_t spatial, const float* src, SimdTensorFormatType srcFormat, float* dst, SimdTensorFormatType dstFormat);
-    const static SimdSynetReorderImagePtr simdSynetReorderImage = SIMD_FUNC4(SynetReorderImage, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetReorderImagePtr> simdSynetReorderImage = {
+        SIMD_AVX512BW_IMPL(SynetReorderImage, 0) SIMD_AVX_IMPL(SynetReorderImage, 0)
+        SIMD_SSE2_IMPL(SynetReorderImage, 0) SIMD_NEON_IMPL(SynetReorderImage, 0) SIMD_BASE_IMPL(SynetReorderImage) };
 
-    simdSynetReorderImage(batch, channels, spatial, src, srcFormat, dst, dstFormat);
+    simdSynetReorderImage()(batch, channels, spatial, src, srcFormat, dst, dstFormat);
 #else
     assert(0);
 #endif
@@ -6244,9 +3744,11 @@ SIMD_API void SimdSynetReorderFilter(size_t output, size_t input, size_t kernel,
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetReorderFilterPtr) (size_t output, size_t input, size_t kernel, const float* src, SimdTensorFormatType srcFormat, float* dst, SimdTensorFormatType dstFormat);
-    const static SimdSynetReorderFilterPtr simdSynetReorderFilter = SIMD_FUNC4(SynetReorderFilter, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetReorderFilterPtr> simdSynetReorderFilter = {
+        SIMD_AVX512BW_IMPL(SynetReorderFilter, 0) SIMD_AVX_IMPL(SynetReorderFilter, 0)
+        SIMD_SSE2_IMPL(SynetReorderFilter, 0) SIMD_NEON_IMPL(SynetReorderFilter, 0) SIMD_BASE_IMPL(SynetReorderFilter) };
 
-    simdSynetReorderFilter(output, input, kernel, src, srcFormat, dst, dstFormat);
+    simdSynetReorderFilter()(output, input, kernel, src, srcFormat, dst, dstFormat);
 #else
     assert(0);
 #endif
@@ -6256,9 +3758,12 @@ SIMD_API void SimdSynetRestrictRange32f(const float * src, size_t size, const fl
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetRestrictRange32fPtr) (const float * src, size_t size, const float * lower, const float * upper, float * dst);
-    const static SimdSynetRestrictRange32fPtr simdSynetRestrictRange32f = SIMD_FUNC4(SynetRestrictRange32f, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetRestrictRange32fPtr> simdSynetRestrictRange32f = {
+        SIMD_AVX512BW_IMPL(SynetRestrictRange32f, 0) SIMD_AVX_IMPL(SynetRestrictRange32f, 0)
+        SIMD_SSE2_IMPL(SynetRestrictRange32f, 0) SIMD_NEON_IMPL(SynetRestrictRange32f, 0)
+        SIMD_BASE_IMPL(SynetRestrictRange32f) };
 
-    simdSynetRestrictRange32f(src, size, lower, upper, dst);
+    simdSynetRestrictRange32f()(src, size, lower, upper, dst);
 #else
     assert(0);
 #endif
@@ -6268,9 +3773,12 @@ SIMD_API void SimdSynetScaleLayerForward(const float* src, const float* scale, c
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetScaleLayerForwardPtr) (const float* src, const float* scale, const float* bias, size_t channels, size_t height, size_t width, float* dst, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetScaleLayerForwardPtr simdSynetScaleLayerForward = SIMD_FUNC5(SynetScaleLayerForward, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetScaleLayerForwardPtr> simdSynetScaleLayerForward = {
+        SIMD_AVX512BW_IMPL(SynetScaleLayerForward, 0) SIMD_AVX2_IMPL(SynetScaleLayerForward, 0)
+        SIMD_AVX_IMPL(SynetScaleLayerForward, 0) SIMD_SSE2_IMPL(SynetScaleLayerForward, 0)
+        SIMD_NEON_IMPL(SynetScaleLayerForward, 0) SIMD_BASE_IMPL(SynetScaleLayerForward) };
 
-    simdSynetScaleLayerForward(src, scale, bias, channels, height, width, dst, format, compatibility);
+    simdSynetScaleLayerForward()(src, scale, bias, channels, height, width, dst, format, compatibility);
 #else
     assert(0);
 #endif
@@ -6280,9 +3788,11 @@ SIMD_API void* SimdSynetScale8iInit(size_t batch, size_t channels, size_t spatia
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void* (*SimdSynetScale8iInitPtr) (size_t batch, size_t channels, size_t spatial, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetScale8iInitPtr simdSynetScale8iInit = SIMD_FUNC3(SynetScale8iInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    const static Simd::Dispatch<SimdSynetScale8iInitPtr> simdSynetScale8iInit = {
+        SIMD_AVX512BW_IMPL(SynetScale8iInit, 0) SIMD_AVX2_IMPL(SynetScale8iInit, 0) SIMD_SSE41_IMPL(SynetScale8iInit, 0)
+        SIMD_BASE_IMPL(SynetScale8iInit) };
 
-    return simdSynetScale8iInit(batch, channels, spatial, srcType, dstType, format, compatibility);
+    return simdSynetScale8iInit()(batch, channels, spatial, srcType, dstType, format, compatibility);
 #else
     assert(0);
     return 0;
@@ -6311,6 +3821,7 @@ SIMD_API void SimdSynetScale8iSetParams(void* context, const float* weight, cons
 SIMD_API void SimdSynetScale8iForward(void* context, const uint8_t* src, uint8_t* dst)
 {
 #if defined(SIMD_SYNET_ENABLE)
+    Base::ThreadBudgetScope budget(context);
     ((Base::SynetScale8i*)context)->Forward(src, dst);
 #else
     assert(0);
@@ -6321,27 +3832,11 @@ SIMD_API void SimdSynetSetInput(const uint8_t * src, size_t width, size_t height
     const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
 {
 #if defined(SIMD_SYNET_ENABLE)
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A)
-        Avx512bw::SynetSetInput(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::SynetSetInput(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::SynetSetInput(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::SynetSetInput(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat);
-    else
-#endif
-        Base::SynetSetInput(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat);
+    const static Simd::Dispatch<decltype(&Base::SynetSetInput)> simdSynetSetInput = {
+        SIMD_AVX512BW_IMPL(SynetSetInput, Avx512bw::A) SIMD_AVX2_IMPL(SynetSetInput, Avx2::A)
+        SIMD_SSE41_IMPL(SynetSetInput, Sse41::A) SIMD_NEON_IMPL(SynetSetInput, Neon::A) SIMD_BASE_IMPL(SynetSetInput) };
+
+    simdSynetSetInput(width)(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat);
 #else
     assert(0);
 #endif
@@ -6351,9 +3846,12 @@ SIMD_API void SimdSynetShuffleLayerForward(const float* src0, const float* src1,
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetShuffleLayerForwardPtr) (const float* src0, const float* src1, size_t channels0, size_t channels1, size_t spatial, float* dst0, float* dst1, SimdTensorFormatType format, int type);
-    const static SimdSynetShuffleLayerForwardPtr simdSynetShuffleLayerForward = SIMD_FUNC4(SynetShuffleLayerForward, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetShuffleLayerForwardPtr> simdSynetShuffleLayerForward = {
+        SIMD_AVX512BW_IMPL(SynetShuffleLayerForward, 0) SIMD_AVX_IMPL(SynetShuffleLayerForward, 0)
+        SIMD_SSE2_IMPL(SynetShuffleLayerForward, 0) SIMD_NEON_IMPL(SynetShuffleLayerForward, 0)
+        SIMD_BASE_IMPL(SynetShuffleLayerForward) };
 
-    simdSynetShuffleLayerForward(src0, src1, channels0, channels1, spatial, dst0, dst1, format, type);
+    simdSynetShuffleLayerForward()(src0, src1, channels0, channels1, spatial, dst0, dst1, format, type);
 #else
     assert(0);
 #endif
@@ -6363,9 +3861,11 @@ SIMD_API void SimdSynetSigmoid32f(const float* src, size_t size, const float* sl
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetSigmoid32fPtr) (const float* src, size_t size, const float* slope, float* dst);
-    const static SimdSynetSigmoid32fPtr simdSynetSigmoid32f = SIMD_FUNC4(SynetSigmoid32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetSigmoid32fPtr> simdSynetSigmoid32f = {
+        SIMD_AVX512BW_IMPL(SynetSigmoid32f, 0) SIMD_AVX2_IMPL(SynetSigmoid32f, 0) SIMD_SSE2_IMPL(SynetSigmoid32f, 0)
+        SIMD_NEON_IMPL(SynetSigmoid32f, 0) SIMD_BASE_IMPL(SynetSigmoid32f) };
 
-    simdSynetSigmoid32f(src, size, slope, dst);
+    simdSynetSigmoid32f()(src, size, slope, dst);
 #else
     assert(0);
 #endif
@@ -6375,9 +3875,12 @@ SIMD_API void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetSoftmaxLayerForwardPtr) (const float * src, size_t outer, size_t count, size_t inner, float * dst);
-    const static SimdSynetSoftmaxLayerForwardPtr simdSynetSoftmaxLayerForward = SIMD_FUNC4(SynetSoftmaxLayerForward, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetSoftmaxLayerForwardPtr> simdSynetSoftmaxLayerForward = {
+        SIMD_AVX512BW_IMPL(SynetSoftmaxLayerForward, 0) SIMD_AVX2_IMPL(SynetSoftmaxLayerForward, 0)
+        SIMD_SSE2_IMPL(SynetSoftmaxLayerForward, 0) SIMD_NEON_IMPL(SynetSoftmaxLayerForward, 0)
+        SIMD_BASE_IMPL(SynetSoftmaxLayerForward) };
 
-    simdSynetSoftmaxLayerForward(src, outer, count, inner, dst);
+    simdSynetSoftmaxLayerForward()(src, outer, count, inner, dst);
 #else
     assert(0);
 #endif
@@ -6387,9 +3890,11 @@ SIMD_API void SimdSynetSoftplus32f(const float* src, size_t size, const float* b
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetSoftplus32fPtr) (const float* src, size_t size, const float* beta, const float* threshold, float* dst);
-    const static SimdSynetSoftplus32fPtr simdSynetSoftplus32f = SIMD_FUNC4(SynetSoftplus32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetSoftplus32fPtr> simdSynetSoftplus32f = {
+        SIMD_AVX512BW_IMPL(SynetSoftplus32f, 0) SIMD_AVX2_IMPL(SynetSoftplus32f, 0) SIMD_SSE2_IMPL(SynetSoftplus32f, 0)
+        SIMD_NEON_IMPL(SynetSoftplus32f, 0) SIMD_BASE_IMPL(SynetSoftplus32f) };
 
-    simdSynetSoftplus32f(src, size, beta, threshold, dst);
+    simdSynetSoftplus32f()(src, size, beta, threshold, dst);
 #else
     assert(0);
 #endif
@@ -6409,9 +3914,11 @@ SIMD_API void SimdSynetSwish32f(const float* src, size_t size, const float* slop
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetSwish32fPtr) (const float* src, size_t size, const float* slope, float* dst);
-    const static SimdSynetSwish32fPtr simdSynetSwish32f = SIMD_FUNC4(SynetSwish32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetSwish32fPtr> simdSynetSwish32f = {
+        SIMD_AVX512BW_IMPL(SynetSwish32f, 0) SIMD_AVX2_IMPL(SynetSwish32f, 0) SIMD_SSE2_IMPL(SynetSwish32f, 0)
+        SIMD_NEON_IMPL(SynetSwish32f, 0) SIMD_BASE_IMPL(SynetSwish32f) };
 
-    simdSynetSwish32f(src, size, slope, dst);
+    simdSynetSwish32f()(src, size, slope, dst);
 #else
     assert(0);
 #endif
@@ -6421,9 +3928,11 @@ SIMD_API void SimdSynetTanh32f(const float* src, size_t size, const float* slope
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetTanh32fPtr) (const float* src, size_t size, const float* slope, float* dst);
-    const static SimdSynetTanh32fPtr simdSynetTanh32f = SIMD_FUNC4(SynetTanh32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetTanh32fPtr> simdSynetTanh32f = {
+        SIMD_AVX512BW_IMPL(SynetTanh32f, 0) SIMD_AVX2_IMPL(SynetTanh32f, 0) SIMD_SSE2_IMPL(SynetTanh32f, 0)
+        SIMD_NEON_IMPL(SynetTanh32f, 0) SIMD_BASE_IMPL(SynetTanh32f) };
 
-    simdSynetTanh32f(src, size, slope, dst);
+    simdSynetTanh32f()(src, size, slope, dst);
 #else
     assert(0);
 #endif
@@ -6444,9 +3953,12 @@ SIMD_API void SimdSynetUnaryOperation32fLayerForward(const float* src, size_t si
 {
 #if defined(SIMD_SYNET_ENABLE)
     typedef void(*SimdSynetUnaryOperation32fLayerForwardPtr) (const float* src, size_t size, SimdSynetUnaryOperation32fType type, float* dst);
-    const static SimdSynetUnaryOperation32fLayerForwardPtr simdSynetUnaryOperation32fLayerForward = SIMD_FUNC4(SynetUnaryOperation32fLayerForward, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdSynetUnaryOperation32fLayerForwardPtr> simdSynetUnaryOperation32fLayerForward = {
+        SIMD_AVX512BW_IMPL(SynetUnaryOperation32fLayerForward, 0) SIMD_AVX2_IMPL(SynetUnaryOperation32fLayerForward, 0)
+        SIMD_SSE2_IMPL(SynetUnaryOperation32fLayerForward, 0) SIMD_NEON_IMPL(SynetUnaryOperation32fLayerForward, 0)
+        SIMD_BASE_IMPL(SynetUnaryOperation32fLayerForward) };
 
-    simdSynetUnaryOperation32fLayerForward(src, size, type, dst);
+    simdSynetUnaryOperation32fLayerForward()(src, size, type, dst);
 #else
     assert(0);
 #endif
@@ -6455,205 +3967,75 @@ SIMD_API void SimdSynetUnaryOperation32fLayerForward(const float* src, size_t si
 SIMD_API void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                      uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A)
-        Sse41::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
-#endif
-        Base::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
+    const static Simd::Dispatch<decltype(&Base::TextureBoostedSaturatedGradient)> simdTextureBoostedSaturatedGradient = {
+        SIMD_AVX512BW_IMPL(TextureBoostedSaturatedGradient, 0) SIMD_AVX2_IMPL(TextureBoostedSaturatedGradient, Avx2::A)
+        SIMD_SSE41_IMPL(TextureBoostedSaturatedGradient, Sse41::A)
+        SIMD_SSE2_IMPL(TextureBoostedSaturatedGradient, Sse2::A) SIMD_VMX_IMPL(TextureBoostedSaturatedGradient, Vmx::A)
+        SIMD_NEON_IMPL(TextureBoostedSaturatedGradient, Neon::A) SIMD_BASE_IMPL(TextureBoostedSaturatedGradient) };
+
+    simdTextureBoostedSaturatedGradient(width)(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
 }
 
 SIMD_API void SimdTextureBoostedUv(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                       uint8_t boost, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-    else
-#endif
-        Base::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::TextureBoostedUv)> simdTextureBoostedUv = {
+        SIMD_AVX512BW_IMPL(TextureBoostedUv, 0) SIMD_AVX2_IMPL(TextureBoostedUv, Avx2::A)
+        SIMD_SSE2_IMPL(TextureBoostedUv, Sse2::A) SIMD_VMX_IMPL(TextureBoostedUv, Vmx::A)
+        SIMD_NEON_IMPL(TextureBoostedUv, Neon::A) SIMD_BASE_IMPL(TextureBoostedUv) };
+
+    simdTextureBoostedUv(width)(src, srcStride, width, height, boost, dst, dstStride);
 }
 
 SIMD_API void SimdTextureGetDifferenceSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                              const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride, int64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-    else
-#endif
-        Base::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
+    const static Simd::Dispatch<decltype(&Base::TextureGetDifferenceSum)> simdTextureGetDifferenceSum = {
+        SIMD_AVX512BW_IMPL(TextureGetDifferenceSum, 0) SIMD_AVX2_IMPL(TextureGetDifferenceSum, Avx2::A)
+        SIMD_SSE2_IMPL(TextureGetDifferenceSum, Sse2::A) SIMD_VMX_IMPL(TextureGetDifferenceSum, Vmx::A)
+        SIMD_NEON_IMPL(TextureGetDifferenceSum, Neon::A) SIMD_BASE_IMPL(TextureGetDifferenceSum) };
+
+    simdTextureGetDifferenceSum(width)(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
 }
 
 SIMD_API void SimdTexturePerformCompensation(const uint8_t * src, size_t srcStride, size_t width, size_t height,
     int32_t shift, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if (Vmx::Enable && width >= Vmx::A)
-        Vmx::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-    else
-#endif
-        Base::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-}
-
-SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride)
-{
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx2::A)
-        Avx512bw::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
-    else
-#endif
-        Base::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
+    const static Simd::Dispatch<decltype(&Base::TexturePerformCompensation)> simdTexturePerformCompensation = {
+        SIMD_AVX512BW_IMPL(TexturePerformCompensation, 0) SIMD_AVX2_IMPL(TexturePerformCompensation, Avx2::A)
+        SIMD_SSE2_IMPL(TexturePerformCompensation, Sse2::A) SIMD_VMX_IMPL(TexturePerformCompensation, Vmx::A)
+        SIMD_NEON_IMPL(TexturePerformCompensation, Neon::A) SIMD_BASE_IMPL(TexturePerformCompensation) };
+
+    simdTexturePerformCompensation(width)(src, srcStride, width, height, shift, dst, dstStride);
+}
+
+SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride)
+{
+    const static Simd::Dispatch<decltype(&Base::TransformImage)> simdTransformImage = {
+        SIMD_AVX512BW_IMPL(TransformImage, Avx2::A) SIMD_AVX2_IMPL(TransformImage, Avx2::A)
+        SIMD_SSE41_IMPL(TransformImage, Sse41::A) SIMD_NEON_IMPL(TransformImage, Neon::HA)
+        SIMD_BASE_IMPL(TransformImage) };
+
+    simdTransformImage(width)(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
 }
 
 SIMD_API void SimdUyvy422ToBgr(const uint8_t* uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Uyvy422ToBgr(uyvy, uyvyStride, width, height, bgr, bgrStride, yuvType);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::DA)
-        Avx2::Uyvy422ToBgr(uyvy, uyvyStride, width, height, bgr, bgrStride, yuvType);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::DA)
-        Sse41::Uyvy422ToBgr(uyvy, uyvyStride, width, height, bgr, bgrStride, yuvType);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Uyvy422ToBgr(uyvy, uyvyStride, width, height, bgr, bgrStride, yuvType);
-    else
-#endif
-        Base::Uyvy422ToBgr(uyvy, uyvyStride, width, height, bgr, bgrStride, yuvType);
+    const static Simd::Dispatch<decltype(&Base::Uyvy422ToBgr)> simdUyvy422ToBgr = {
+        SIMD_AVX512BW_IMPL(Uyvy422ToBgr, 0) SIMD_AVX2_IMPL(Uyvy422ToBgr, Avx2::DA)
+        SIMD_SSE41_IMPL(Uyvy422ToBgr, Sse41::DA) SIMD_NEON_IMPL(Uyvy422ToBgr, Neon::DA) SIMD_BASE_IMPL(Uyvy422ToBgr) };
+
+    simdUyvy422ToBgr(width)(uyvy, uyvyStride, width, height, bgr, bgrStride, yuvType);
 }
 
 SIMD_API void SimdUyvy422ToYuv420p(const uint8_t* uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* u, size_t uStride, uint8_t* v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Uyvy422ToYuv420p(uyvy, uyvyStride, width, height, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::DA)
-        Avx2::Uyvy422ToYuv420p(uyvy, uyvyStride, width, height, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::DA)
-        Sse41::Uyvy422ToYuv420p(uyvy, uyvyStride, width, height, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Uyvy422ToYuv420p(uyvy, uyvyStride, width, height, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-        Base::Uyvy422ToYuv420p(uyvy, uyvyStride, width, height, y, yStride, u, uStride, v, vStride);
+    const static Simd::Dispatch<decltype(&Base::Uyvy422ToYuv420p)> simdUyvy422ToYuv420p = {
+        SIMD_AVX512BW_IMPL(Uyvy422ToYuv420p, 0) SIMD_AVX2_IMPL(Uyvy422ToYuv420p, Avx2::DA)
+        SIMD_SSE41_IMPL(Uyvy422ToYuv420p, Sse41::DA) SIMD_NEON_IMPL(Uyvy422ToYuv420p, Neon::DA)
+        SIMD_BASE_IMPL(Uyvy422ToYuv420p) };
+
+    simdUyvy422ToYuv420p(width)(uyvy, uyvyStride, width, height, y, yStride, u, uStride, v, vStride);
 }
 
 typedef void(*SimdWinogradSetFilterPtr) (const float * src, size_t size, float * dst, SimdBool trans);
@@ -6663,9 +4045,12 @@ typedef void(*SimdWinogradSetOutputPtr) (const float * src, size_t srcStride, fl
 SIMD_API void SimdWinogradKernel1x3Block1x4SetFilter(const float* src, size_t size, float* dst, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetFilterPtr simdWinogradKernel1x3Block1x4SetFilter = SIMD_FUNC4(WinogradKernel1x3Block1x4SetFilter, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetFilterPtr> simdWinogradKernel1x3Block1x4SetFilter = {
+        SIMD_AVX512BW_IMPL(WinogradKernel1x3Block1x4SetFilter, 0) SIMD_AVX_IMPL(WinogradKernel1x3Block1x4SetFilter, 0)
+        SIMD_SSE2_IMPL(WinogradKernel1x3Block1x4SetFilter, 0) SIMD_NEON_IMPL(WinogradKernel1x3Block1x4SetFilter, 0)
+        SIMD_BASE_IMPL(WinogradKernel1x3Block1x4SetFilter) };
 
-    simdWinogradKernel1x3Block1x4SetFilter(src, size, dst, trans);
+    simdWinogradKernel1x3Block1x4SetFilter()(src, size, dst, trans);
 #else
     assert(0);
 #endif
@@ -6675,9 +4060,12 @@ SIMD_API void SimdWinogradKernel1x3Block1x4SetInput(const float* src, size_t src
     size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetInputPtr simdWinogradKernel1x3Block1x4SetInput = SIMD_FUNC4(WinogradKernel1x3Block1x4SetInput, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetInputPtr> simdWinogradKernel1x3Block1x4SetInput = {
+        SIMD_AVX512BW_IMPL(WinogradKernel1x3Block1x4SetInput, 0) SIMD_AVX_IMPL(WinogradKernel1x3Block1x4SetInput, 0)
+        SIMD_SSE2_IMPL(WinogradKernel1x3Block1x4SetInput, 0) SIMD_NEON_IMPL(WinogradKernel1x3Block1x4SetInput, 0)
+        SIMD_BASE_IMPL(WinogradKernel1x3Block1x4SetInput) };
 
-    simdWinogradKernel1x3Block1x4SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+    simdWinogradKernel1x3Block1x4SetInput()(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
 #else
     assert(0);
 #endif
@@ -6686,9 +4074,12 @@ SIMD_API void SimdWinogradKernel1x3Block1x4SetInput(const float* src, size_t src
 SIMD_API void SimdWinogradKernel1x3Block1x4SetOutput(const float* src, size_t srcStride, float* dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetOutputPtr simdWinogradKernel1x3Block1x4SetOutput = SIMD_FUNC4(WinogradKernel1x3Block1x4SetOutput, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetOutputPtr> simdWinogradKernel1x3Block1x4SetOutput = {
+        SIMD_AVX512BW_IMPL(WinogradKernel1x3Block1x4SetOutput, 0) SIMD_AVX_IMPL(WinogradKernel1x3Block1x4SetOutput, 0)
+        SIMD_SSE2_IMPL(WinogradKernel1x3Block1x4SetOutput, 0) SIMD_NEON_IMPL(WinogradKernel1x3Block1x4SetOutput, 0)
+        SIMD_BASE_IMPL(WinogradKernel1x3Block1x4SetOutput) };
 
-    simdWinogradKernel1x3Block1x4SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+    simdWinogradKernel1x3Block1x4SetOutput()(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 #else
     assert(0);
 #endif
@@ -6697,9 +4088,12 @@ SIMD_API void SimdWinogradKernel1x3Block1x4SetOutput(const float* src, size_t sr
 SIMD_API void SimdWinogradKernel1x5Block1x4SetFilter(const float* src, size_t size, float* dst, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetFilterPtr simdWinogradKernel1x5Block1x4SetFilter = SIMD_FUNC4(WinogradKernel1x5Block1x4SetFilter, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetFilterPtr> simdWinogradKernel1x5Block1x4SetFilter = {
+        SIMD_AVX512BW_IMPL(WinogradKernel1x5Block1x4SetFilter, 0) SIMD_AVX_IMPL(WinogradKernel1x5Block1x4SetFilter, 0)
+        SIMD_SSE2_IMPL(WinogradKernel1x5Block1x4SetFilter, 0) SIMD_NEON_IMPL(WinogradKernel1x5Block1x4SetFilter, 0)
+        SIMD_BASE_IMPL(WinogradKernel1x5Block1x4SetFilter) };
 
-    simdWinogradKernel1x5Block1x4SetFilter(src, size, dst, trans);
+    simdWinogradKernel1x5Block1x4SetFilter()(src, size, dst, trans);
 #else
     assert(0);
 #endif
@@ -6709,9 +4103,12 @@ SIMD_API void SimdWinogradKernel1x5Block1x4SetInput(const float* src, size_t src
     size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetInputPtr simdWinogradKernel1x5Block1x4SetInput = SIMD_FUNC4(WinogradKernel1x5Block1x4SetInput, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetInputPtr> simdWinogradKernel1x5Block1x4SetInput = {
+        SIMD_AVX512BW_IMPL(WinogradKernel1x5Block1x4SetInput, 0) SIMD_AVX_IMPL(WinogradKernel1x5Block1x4SetInput, 0)
+        SIMD_SSE2_IMPL(WinogradKernel1x5Block1x4SetInput, 0) SIMD_NEON_IMPL(WinogradKernel1x5Block1x4SetInput, 0)
+        SIMD_BASE_IMPL(WinogradKernel1x5Block1x4SetInput) };
 
-    simdWinogradKernel1x5Block1x4SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+    simdWinogradKernel1x5Block1x4SetInput()(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
 #else
     assert(0);
 #endif
@@ -6720,9 +4117,12 @@ SIMD_API void SimdWinogradKernel1x5Block1x4SetInput(const float* src, size_t src
 SIMD_API void SimdWinogradKernel1x5Block1x4SetOutput(const float* src, size_t srcStride, float* dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetOutputPtr simdWinogradKernel1x5Block1x4SetOutput = SIMD_FUNC4(WinogradKernel1x5Block1x4SetOutput, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetOutputPtr> simdWinogradKernel1x5Block1x4SetOutput = {
+        SIMD_AVX512BW_IMPL(WinogradKernel1x5Block1x4SetOutput, 0) SIMD_AVX_IMPL(WinogradKernel1x5Block1x4SetOutput, 0)
+        SIMD_SSE2_IMPL(WinogradKernel1x5Block1x4SetOutput, 0) SIMD_NEON_IMPL(WinogradKernel1x5Block1x4SetOutput, 0)
+        SIMD_BASE_IMPL(WinogradKernel1x5Block1x4SetOutput) };
 
-    simdWinogradKernel1x5Block1x4SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+    simdWinogradKernel1x5Block1x4SetOutput()(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 #else
     assert(0);
 #endif
@@ -6731,9 +4131,12 @@ SIMD_API void SimdWinogradKernel1x5Block1x4SetOutput(const float* src, size_t sr
 SIMD_API void SimdWinogradKernel2x2Block2x2SetFilter(const float* src, size_t size, float* dst, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetFilterPtr simdWinogradKernel2x2Block2x2SetFilter = SIMD_FUNC4(WinogradKernel2x2Block2x2SetFilter, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetFilterPtr> simdWinogradKernel2x2Block2x2SetFilter = {
+        SIMD_AVX512BW_IMPL(WinogradKernel2x2Block2x2SetFilter, 0) SIMD_AVX_IMPL(WinogradKernel2x2Block2x2SetFilter, 0)
+        SIMD_SSE2_IMPL(WinogradKernel2x2Block2x2SetFilter, 0) SIMD_NEON_IMPL(WinogradKernel2x2Block2x2SetFilter, 0)
+        SIMD_BASE_IMPL(WinogradKernel2x2Block2x2SetFilter) };
 
-    simdWinogradKernel2x2Block2x2SetFilter(src, size, dst, trans);
+    simdWinogradKernel2x2Block2x2SetFilter()(src, size, dst, trans);
 #else
     assert(0);
 #endif
@@ -6743,9 +4146,12 @@ SIMD_API void SimdWinogradKernel2x2Block2x2SetInput(const float* src, size_t src
     size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetInputPtr simdWinogradKernel2x2Block2x2SetInput = SIMD_FUNC4(WinogradKernel2x2Block2x2SetInput, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetInputPtr> simdWinogradKernel2x2Block2x2SetInput = {
+        SIMD_AVX512BW_IMPL(WinogradKernel2x2Block2x2SetInput, 0) SIMD_AVX_IMPL(WinogradKernel2x2Block2x2SetInput, 0)
+        SIMD_SSE2_IMPL(WinogradKernel2x2Block2x2SetInput, 0) SIMD_NEON_IMPL(WinogradKernel2x2Block2x2SetInput, 0)
+        SIMD_BASE_IMPL(WinogradKernel2x2Block2x2SetInput) };
 
-    simdWinogradKernel2x2Block2x2SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+    simdWinogradKernel2x2Block2x2SetInput()(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
 #else
     assert(0);
 #endif
@@ -6754,9 +4160,12 @@ SIMD_API void SimdWinogradKernel2x2Block2x2SetInput(const float* src, size_t src
 SIMD_API void SimdWinogradKernel2x2Block2x2SetOutput(const float* src, size_t srcStride, float* dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetOutputPtr simdWinogradKernel2x2Block2x2SetOutput = SIMD_FUNC4(WinogradKernel2x2Block2x2SetOutput, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetOutputPtr> simdWinogradKernel2x2Block2x2SetOutput = {
+        SIMD_AVX512BW_IMPL(WinogradKernel2x2Block2x2SetOutput, 0) SIMD_AVX_IMPL(WinogradKernel2x2Block2x2SetOutput, 0)
+        SIMD_SSE2_IMPL(WinogradKernel2x2Block2x2SetOutput, 0) SIMD_NEON_IMPL(WinogradKernel2x2Block2x2SetOutput, 0)
+        SIMD_BASE_IMPL(WinogradKernel2x2Block2x2SetOutput) };
 
-    simdWinogradKernel2x2Block2x2SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+    simdWinogradKernel2x2Block2x2SetOutput()(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 #else
     assert(0);
 #endif
@@ -6765,9 +4174,12 @@ SIMD_API void SimdWinogradKernel2x2Block2x2SetOutput(const float* src, size_t sr
 SIMD_API void SimdWinogradKernel2x2Block4x4SetFilter(const float* src, size_t size, float* dst, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetFilterPtr simdWinogradKernel2x2Block4x4SetFilter = SIMD_FUNC4(WinogradKernel2x2Block4x4SetFilter, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetFilterPtr> simdWinogradKernel2x2Block4x4SetFilter = {
+        SIMD_AVX512BW_IMPL(WinogradKernel2x2Block4x4SetFilter, 0) SIMD_AVX_IMPL(WinogradKernel2x2Block4x4SetFilter, 0)
+        SIMD_SSE2_IMPL(WinogradKernel2x2Block4x4SetFilter, 0) SIMD_NEON_IMPL(WinogradKernel2x2Block4x4SetFilter, 0)
+        SIMD_BASE_IMPL(WinogradKernel2x2Block4x4SetFilter) };
 
-    simdWinogradKernel2x2Block4x4SetFilter(src, size, dst, trans);
+    simdWinogradKernel2x2Block4x4SetFilter()(src, size, dst, trans);
 #else
     assert(0);
 #endif
@@ -6777,9 +4189,12 @@ SIMD_API void SimdWinogradKernel2x2Block4x4SetInput(const float* src, size_t src
     size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetInputPtr simdWinogradKernel2x2Block4x4SetInput = SIMD_FUNC4(WinogradKernel2x2Block4x4SetInput, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetInputPtr> simdWinogradKernel2x2Block4x4SetInput = {
+        SIMD_AVX512BW_IMPL(WinogradKernel2x2Block4x4SetInput, 0) SIMD_AVX_IMPL(WinogradKernel2x2Block4x4SetInput, 0)
+        SIMD_SSE2_IMPL(WinogradKernel2x2Block4x4SetInput, 0) SIMD_NEON_IMPL(WinogradKernel2x2Block4x4SetInput, 0)
+        SIMD_BASE_IMPL(WinogradKernel2x2Block4x4SetInput) };
 
-    simdWinogradKernel2x2Block4x4SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+    simdWinogradKernel2x2Block4x4SetInput()(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
 #else
     assert(0);
 #endif
@@ -6788,9 +4203,12 @@ SIMD_API void SimdWinogradKernel2x2Block4x4SetInput(const float* src, size_t src
 SIMD_API void SimdWinogradKernel2x2Block4x4SetOutput(const float* src, size_t srcStride, float* dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetOutputPtr simdWinogradKernel2x2Block4x4SetOutput = SIMD_FUNC4(WinogradKernel2x2Block4x4SetOutput, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetOutputPtr> simdWinogradKernel2x2Block4x4SetOutput = {
+        SIMD_AVX512BW_IMPL(WinogradKernel2x2Block4x4SetOutput, 0) SIMD_AVX_IMPL(WinogradKernel2x2Block4x4SetOutput, 0)
+        SIMD_SSE2_IMPL(WinogradKernel2x2Block4x4SetOutput, 0) SIMD_NEON_IMPL(WinogradKernel2x2Block4x4SetOutput, 0)
+        SIMD_BASE_IMPL(WinogradKernel2x2Block4x4SetOutput) };
 
-    simdWinogradKernel2x2Block4x4SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+    simdWinogradKernel2x2Block4x4SetOutput()(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 #else
     assert(0);
 #endif
@@ -6799,9 +4217,12 @@ SIMD_API void SimdWinogradKernel2x2Block4x4SetOutput(const float* src, size_t sr
 SIMD_API void SimdWinogradKernel3x3Block2x2SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetFilterPtr simdWinogradKernel3x3Block2x2SetFilter = SIMD_FUNC4(WinogradKernel3x3Block2x2SetFilter, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetFilterPtr> simdWinogradKernel3x3Block2x2SetFilter = {
+        SIMD_AVX512BW_IMPL(WinogradKernel3x3Block2x2SetFilter, 0) SIMD_AVX_IMPL(WinogradKernel3x3Block2x2SetFilter, 0)
+        SIMD_SSE2_IMPL(WinogradKernel3x3Block2x2SetFilter, 0) SIMD_NEON_IMPL(WinogradKernel3x3Block2x2SetFilter, 0)
+        SIMD_BASE_IMPL(WinogradKernel3x3Block2x2SetFilter) };
 
-    simdWinogradKernel3x3Block2x2SetFilter(src, size, dst, trans);
+    simdWinogradKernel3x3Block2x2SetFilter()(src, size, dst, trans);
 #else
     assert(0);
 #endif
@@ -6811,9 +4232,12 @@ SIMD_API void SimdWinogradKernel3x3Block2x2SetInput(const float* src, size_t src
     size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetInputPtr simdWinogradKernel3x3Block2x2SetInput = SIMD_FUNC4(WinogradKernel3x3Block2x2SetInput, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetInputPtr> simdWinogradKernel3x3Block2x2SetInput = {
+        SIMD_AVX512BW_IMPL(WinogradKernel3x3Block2x2SetInput, 0) SIMD_AVX_IMPL(WinogradKernel3x3Block2x2SetInput, 0)
+        SIMD_SSE2_IMPL(WinogradKernel3x3Block2x2SetInput, 0) SIMD_NEON_IMPL(WinogradKernel3x3Block2x2SetInput, 0)
+        SIMD_BASE_IMPL(WinogradKernel3x3Block2x2SetInput) };
 
-    simdWinogradKernel3x3Block2x2SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+    simdWinogradKernel3x3Block2x2SetInput()(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
 #else
     assert(0);
 #endif
@@ -6822,9 +4246,12 @@ SIMD_API void SimdWinogradKernel3x3Block2x2SetInput(const float* src, size_t src
 SIMD_API void SimdWinogradKernel3x3Block2x2SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetOutputPtr simdWinogradKernel3x3Block2x2SetOutput = SIMD_FUNC4(WinogradKernel3x3Block2x2SetOutput, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetOutputPtr> simdWinogradKernel3x3Block2x2SetOutput = {
+        SIMD_AVX512BW_IMPL(WinogradKernel3x3Block2x2SetOutput, 0) SIMD_AVX_IMPL(WinogradKernel3x3Block2x2SetOutput, 0)
+        SIMD_SSE2_IMPL(WinogradKernel3x3Block2x2SetOutput, 0) SIMD_NEON_IMPL(WinogradKernel3x3Block2x2SetOutput, 0)
+        SIMD_BASE_IMPL(WinogradKernel3x3Block2x2SetOutput) };
 
-    simdWinogradKernel3x3Block2x2SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+    simdWinogradKernel3x3Block2x2SetOutput()(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 #else
     assert(0);
 #endif
@@ -6833,9 +4260,12 @@ SIMD_API void SimdWinogradKernel3x3Block2x2SetOutput(const float * src, size_t s
 SIMD_API void SimdWinogradKernel3x3Block3x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetFilterPtr simdWinogradKernel3x3Block3x3SetFilter = SIMD_FUNC4(WinogradKernel3x3Block3x3SetFilter, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetFilterPtr> simdWinogradKernel3x3Block3x3SetFilter = {
+        SIMD_AVX512BW_IMPL(WinogradKernel3x3Block3x3SetFilter, 0) SIMD_AVX_IMPL(WinogradKernel3x3Block3x3SetFilter, 0)
+        SIMD_SSE2_IMPL(WinogradKernel3x3Block3x3SetFilter, 0) SIMD_NEON_IMPL(WinogradKernel3x3Block3x3SetFilter, 0)
+        SIMD_BASE_IMPL(WinogradKernel3x3Block3x3SetFilter) };
 
-    simdWinogradKernel3x3Block3x3SetFilter(src, size, dst, trans);
+    simdWinogradKernel3x3Block3x3SetFilter()(src, size, dst, trans);
 #else
     assert(0);
 #endif
@@ -6845,9 +4275,12 @@ SIMD_API void SimdWinogradKernel3x3Block3x3SetInput(const float* src, size_t src
     size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetInputPtr simdWinogradKernel3x3Block3x3SetInput = SIMD_FUNC4(WinogradKernel3x3Block3x3SetInput, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC); 
+    const static Simd::Dispatch<SimdWinogradSetInputPtr> simdWinogradKernel3x3Block3x3SetInput = {
+        SIMD_AVX512BW_IMPL(WinogradKernel3x3Block3x3SetInput, 0) SIMD_AVX_IMPL(WinogradKernel3x3Block3x3SetInput, 0)
+        SIMD_SSE2_IMPL(WinogradKernel3x3Block3x3SetInput, 0) SIMD_NEON_IMPL(WinogradKernel3x3Block3x3SetInput, 0)
+        SIMD_BASE_IMPL(WinogradKernel3x3Block3x3SetInput) }; 
 
-    simdWinogradKernel3x3Block3x3SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+    simdWinogradKernel3x3Block3x3SetInput()(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
 #else
     assert(0);
 #endif
@@ -6856,9 +4289,12 @@ SIMD_API void SimdWinogradKernel3x3Block3x3SetInput(const float* src, size_t src
 SIMD_API void SimdWinogradKernel3x3Block3x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetOutputPtr simdWinogradKernel3x3Block3x3SetOutput = SIMD_FUNC4(WinogradKernel3x3Block3x3SetOutput, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetOutputPtr> simdWinogradKernel3x3Block3x3SetOutput = {
+        SIMD_AVX512BW_IMPL(WinogradKernel3x3Block3x3SetOutput, 0) SIMD_AVX_IMPL(WinogradKernel3x3Block3x3SetOutput, 0)
+        SIMD_SSE2_IMPL(WinogradKernel3x3Block3x3SetOutput, 0) SIMD_NEON_IMPL(WinogradKernel3x3Block3x3SetOutput, 0)
+        SIMD_BASE_IMPL(WinogradKernel3x3Block3x3SetOutput) };
 
-    simdWinogradKernel3x3Block3x3SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+    simdWinogradKernel3x3Block3x3SetOutput()(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 #else
     assert(0);
 #endif
@@ -6867,9 +4303,12 @@ SIMD_API void SimdWinogradKernel3x3Block3x3SetOutput(const float * src, size_t s
 SIMD_API void SimdWinogradKernel3x3Block4x4SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetFilterPtr simdWinogradKernel3x3Block4x4SetFilter = SIMD_FUNC4(WinogradKernel3x3Block4x4SetFilter, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetFilterPtr> simdWinogradKernel3x3Block4x4SetFilter = {
+        SIMD_AVX512BW_IMPL(WinogradKernel3x3Block4x4SetFilter, 0) SIMD_AVX_IMPL(WinogradKernel3x3Block4x4SetFilter, 0)
+        SIMD_SSE2_IMPL(WinogradKernel3x3Block4x4SetFilter, 0) SIMD_NEON_IMPL(WinogradKernel3x3Block4x4SetFilter, 0)
+        SIMD_BASE_IMPL(WinogradKernel3x3Block4x4SetFilter) };
 
-    simdWinogradKernel3x3Block4x4SetFilter(src, size, dst, trans);
+    simdWinogradKernel3x3Block4x4SetFilter()(src, size, dst, trans);
 #else
     assert(0);
 #endif
@@ -6879,9 +4318,12 @@ SIMD_API void SimdWinogradKernel3x3Block4x4SetInput(const float* src, size_t src
     size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetInputPtr simdWinogradKernel3x3Block4x4SetInput = SIMD_FUNC4(WinogradKernel3x3Block4x4SetInput, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetInputPtr> simdWinogradKernel3x3Block4x4SetInput = {
+        SIMD_AVX512BW_IMPL(WinogradKernel3x3Block4x4SetInput, 0) SIMD_AVX_IMPL(WinogradKernel3x3Block4x4SetInput, 0)
+        SIMD_SSE2_IMPL(WinogradKernel3x3Block4x4SetInput, 0) SIMD_NEON_IMPL(WinogradKernel3x3Block4x4SetInput, 0)
+        SIMD_BASE_IMPL(WinogradKernel3x3Block4x4SetInput) };
 
-    simdWinogradKernel3x3Block4x4SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+    simdWinogradKernel3x3Block4x4SetInput()(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
 #else
     assert(0);
 #endif
@@ -6890,9 +4332,12 @@ SIMD_API void SimdWinogradKernel3x3Block4x4SetInput(const float* src, size_t src
 SIMD_API void SimdWinogradKernel3x3Block4x4SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    const static SimdWinogradSetOutputPtr simdWinogradKernel3x3Block4x4SetOutput = SIMD_FUNC4(WinogradKernel3x3Block4x4SetOutput, SIMD_AVX512BW_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+    const static Simd::Dispatch<SimdWinogradSetOutputPtr> simdWinogradKernel3x3Block4x4SetOutput = {
+        SIMD_AVX512BW_IMPL(WinogradKernel3x3Block4x4SetOutput, 0) SIMD_AVX_IMPL(WinogradKernel3x3Block4x4SetOutput, 0)
+        SIMD_SSE2_IMPL(WinogradKernel3x3Block4x4SetOutput, 0) SIMD_NEON_IMPL(WinogradKernel3x3Block4x4SetOutput, 0)
+        SIMD_BASE_IMPL(WinogradKernel3x3Block4x4SetOutput) };
 
-    simdWinogradKernel3x3Block4x4SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+    simdWinogradKernel3x3Block4x4SetOutput()(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 #else
     assert(0);
 #endif
@@ -6901,265 +4346,109 @@ SIMD_API void SimdWinogradKernel3x3Block4x4SetOutput(const float * src, size_t s
 SIMD_API void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
     const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
-    else
-#endif
-        Base::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
+    const static Simd::Dispatch<decltype(&Base::Yuva420pToBgra)> simdYuva420pToBgra = {
+        SIMD_AVX512BW_IMPL(Yuva420pToBgra, 0) SIMD_AVX2_IMPL(Yuva420pToBgra, Avx2::DA)
+        SIMD_SSE2_IMPL(Yuva420pToBgra, Sse2::DA) SIMD_NEON_IMPL(Yuva420pToBgra, Neon::DA) SIMD_BASE_IMPL(Yuva420pToBgra) };
+
+    simdYuva420pToBgra(width)(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
 }
 
 SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::DA)
-        Sse41::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-        Base::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    const static Simd::Dispatch<decltype(&Base::Yuv420pToBgr)> simdYuv420pToBgr = {
+        SIMD_AVX512BW_IMPL(Yuv420pToBgr, 0) SIMD_AVX2_IMPL(Yuv420pToBgr, Avx2::DA)
+        SIMD_SSE41_IMPL(Yuv420pToBgr, Sse41::DA) SIMD_VMX_IMPL(Yuv420pToBgr, Vmx::DA)
+        SIMD_NEON_IMPL(Yuv420pToBgr, Neon::DA) SIMD_BASE_IMPL(Yuv420pToBgr) };
+
+    simdYuv420pToBgr(width)(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
 SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::DA)
-        Sse41::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-        Base::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    const static Simd::Dispatch<decltype(&Base::Yuv422pToBgr)> simdYuv422pToBgr = {
+        SIMD_AVX512BW_IMPL(Yuv422pToBgr, 0) SIMD_AVX2_IMPL(Yuv422pToBgr, Avx2::DA)
+        SIMD_SSE41_IMPL(Yuv422pToBgr, Sse41::DA) SIMD_VMX_IMPL(Yuv422pToBgr, Vmx::DA)
+        SIMD_NEON_IMPL(Yuv422pToBgr, Neon::DA) SIMD_BASE_IMPL(Yuv422pToBgr) };
+
+    simdYuv422pToBgr(width)(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
 SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A)
-        Sse41::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-        Base::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    const static Simd::Dispatch<decltype(&Base::Yuv444pToBgr)> simdYuv444pToBgr = {
+        SIMD_AVX512BW_IMPL(Yuv444pToBgr, 0) SIMD_AVX2_IMPL(Yuv444pToBgr, Avx2::A)
+        SIMD_SSE41_IMPL(Yuv444pToBgr, Sse41::A) SIMD_VMX_IMPL(Yuv444pToBgr, Vmx::A)
+        SIMD_NEON_IMPL(Yuv444pToBgr, Neon::A) SIMD_BASE_IMPL(Yuv444pToBgr) };
+
+    simdYuv444pToBgr(width)(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+}
+
+static void Yuv420pToBgraBand(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    const static Simd::Dispatch<decltype(&Base::Yuv420pToBgra)> simdYuv420pToBgraBand = {
+        SIMD_AVX512BW_IMPL(Yuv420pToBgra, 0) SIMD_AVX2_IMPL(Yuv420pToBgra, Avx2::DA)
+        SIMD_SSE2_IMPL(Yuv420pToBgra, Sse2::DA) SIMD_VMX_IMPL(Yuv420pToBgra, Vmx::DA)
+        SIMD_NEON_IMPL(Yuv420pToBgra, Neon::DA) SIMD_BASE_IMPL(Yuv420pToBgra) };
+
+    simdYuv420pToBgraBand(width)(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
 SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-        Base::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    ParallelRows(height, width * height, 2, [=](size_t begin, size_t end)
+    {
+        Yuv420pToBgraBand(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride,
+            width, end - begin, bgra + begin * bgraStride, bgraStride, alpha);
+    });
 }
 
 SIMD_API void SimdYuv420pToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
-    else
-#endif
-        Base::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    const static Simd::Dispatch<decltype(&Base::Yuv420pToBgraV2)> simdYuv420pToBgraV2 = {
+        SIMD_AVX512BW_IMPL(Yuv420pToBgraV2, 0) SIMD_AVX2_IMPL(Yuv420pToBgraV2, Avx2::DA)
+        SIMD_SSE2_IMPL(Yuv420pToBgraV2, Sse2::DA) SIMD_NEON_IMPL(Yuv420pToBgraV2, Neon::DA)
+        SIMD_BASE_IMPL(Yuv420pToBgraV2) };
+
+    simdYuv420pToBgraV2(width)(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
 }
 
 SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                 size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-        Base::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    const static Simd::Dispatch<decltype(&Base::Yuv422pToBgra)> simdYuv422pToBgra = {
+        SIMD_AVX512BW_IMPL(Yuv422pToBgra, 0) SIMD_AVX2_IMPL(Yuv422pToBgra, Avx2::DA)
+        SIMD_SSE2_IMPL(Yuv422pToBgra, Sse2::DA) SIMD_VMX_IMPL(Yuv422pToBgra, Vmx::DA)
+        SIMD_NEON_IMPL(Yuv422pToBgra, Neon::DA) SIMD_BASE_IMPL(Yuv422pToBgra) };
+
+    simdYuv422pToBgra(width)(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
 SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-        Base::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    const static Simd::Dispatch<decltype(&Base::Yuv444pToBgra)> simdYuv444pToBgra = {
+        SIMD_AVX512BW_IMPL(Yuv444pToBgra, 0) SIMD_AVX2_IMPL(Yuv444pToBgra, Avx2::A)
+        SIMD_SSE2_IMPL(Yuv444pToBgra, Sse2::A) SIMD_VMX_IMPL(Yuv444pToBgra, Vmx::A)
+        SIMD_NEON_IMPL(Yuv444pToBgra, Neon::A) SIMD_BASE_IMPL(Yuv444pToBgra) };
+
+    simdYuv444pToBgra(width)(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
 SIMD_API void SimdYuv444pToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
-    else
-#endif
-        Base::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    const static Simd::Dispatch<decltype(&Base::Yuv444pToBgraV2)> simdYuv444pToBgraV2 = {
+        SIMD_AVX512BW_IMPL(Yuv444pToBgraV2, 0) SIMD_AVX2_IMPL(Yuv444pToBgraV2, Avx2::A)
+        SIMD_SSE2_IMPL(Yuv444pToBgraV2, Sse2::A) SIMD_NEON_IMPL(Yuv444pToBgraV2, Neon::A)
+        SIMD_BASE_IMPL(Yuv444pToBgraV2) };
+
+    simdYuv444pToBgraV2(width)(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
 }
 
 SIMD_API void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
@@ -7177,167 +4466,63 @@ SIMD_API void SimdYuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * hue, size_t hueStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-#ifdef SIMD_VSX_ENABLE
-    if(Vsx::Enable && width >= Vsx::DA)
-        Vsx::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-        Base::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+    const static Simd::Dispatch<decltype(&Base::Yuv420pToHue)> simdYuv420pToHue = {
+        SIMD_AVX512BW_IMPL(Yuv420pToHue, 0) SIMD_AVX2_IMPL(Yuv420pToHue, Avx2::DA)
+        SIMD_SSE2_IMPL(Yuv420pToHue, Sse2::DA) SIMD_VSX_IMPL(Yuv420pToHue, Vsx::DA)
+        SIMD_NEON_IMPL(Yuv420pToHue, Neon::DA) SIMD_BASE_IMPL(Yuv420pToHue) };
+
+    simdYuv420pToHue(width)(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
 }
 
 SIMD_API void SimdYuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * hue, size_t hueStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-#ifdef SIMD_VSX_ENABLE
-    if(Vsx::Enable && width >= Vsx::A)
-        Vsx::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-        Base::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+    const static Simd::Dispatch<decltype(&Base::Yuv444pToHue)> simdYuv444pToHue = {
+        SIMD_AVX512BW_IMPL(Yuv444pToHue, 0) SIMD_AVX2_IMPL(Yuv444pToHue, Avx2::A) SIMD_SSE2_IMPL(Yuv444pToHue, Sse2::A)
+        SIMD_VSX_IMPL(Yuv444pToHue, Vsx::A) SIMD_NEON_IMPL(Yuv444pToHue, Neon::A) SIMD_BASE_IMPL(Yuv444pToHue) };
+
+    simdYuv444pToHue(width)(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
 }
 
 SIMD_API void SimdYuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::DA)
-        Sse41::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
-#endif
-        Base::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+    const static Simd::Dispatch<decltype(&Base::Yuv420pToRgb)> simdYuv420pToRgb = {
+        SIMD_AVX512BW_IMPL(Yuv420pToRgb, 0) SIMD_AVX2_IMPL(Yuv420pToRgb, Avx2::DA)
+        SIMD_SSE41_IMPL(Yuv420pToRgb, Sse41::DA) SIMD_NEON_IMPL(Yuv420pToRgb, Neon::DA) SIMD_BASE_IMPL(Yuv420pToRgb) };
+
+    simdYuv420pToRgb(width)(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
 SIMD_API void SimdYuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::DA)
-        Sse41::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
-#endif
-        Base::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+    const static Simd::Dispatch<decltype(&Base::Yuv422pToRgb)> simdYuv422pToRgb = {
+        SIMD_AVX512BW_IMPL(Yuv422pToRgb, 0) SIMD_AVX2_IMPL(Yuv422pToRgb, Avx2::DA)
+        SIMD_SSE41_IMPL(Yuv422pToRgb, Sse41::DA) SIMD_NEON_IMPL(Yuv422pToRgb, Neon::DA) SIMD_BASE_IMPL(Yuv422pToRgb) };
+
+    simdYuv422pToRgb(width)(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
 SIMD_API void SimdYuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
-    else
-#endif
-        Base::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+    const static Simd::Dispatch<decltype(&Base::Yuv444pToRgb)> simdYuv444pToRgb = {
+        SIMD_AVX512BW_IMPL(Yuv444pToRgb, 0) SIMD_AVX2_IMPL(Yuv444pToRgb, Avx2::A)
+        SIMD_SSE41_IMPL(Yuv444pToRgb, Sse41::A) SIMD_NEON_IMPL(Yuv444pToRgb, Neon::A) SIMD_BASE_IMPL(Yuv444pToRgb) };
+
+    simdYuv444pToRgb(width)(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
 SIMD_API void SimdYuv420pToUyvy422(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* uyvy, size_t uyvyStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Yuv420pToUyvy422(y, yStride, u, uStride, v, vStride, width, height, uyvy, uyvyStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToUyvy422(y, yStride, u, uStride, v, vStride, width, height, uyvy, uyvyStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::DA)
-        Sse41::Yuv420pToUyvy422(y, yStride, u, uStride, v, vStride, width, height, uyvy, uyvyStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv420pToUyvy422(y, yStride, u, uStride, v, vStride, width, height, uyvy, uyvyStride);
-    else
-#endif
-        Base::Yuv420pToUyvy422(y, yStride, u, uStride, v, vStride, width, height, uyvy, uyvyStride);
+    const static Simd::Dispatch<decltype(&Base::Yuv420pToUyvy422)> simdYuv420pToUyvy422 = {
+        SIMD_AVX512BW_IMPL(Yuv420pToUyvy422, 0) SIMD_AVX2_IMPL(Yuv420pToUyvy422, Avx2::DA)
+        SIMD_SSE41_IMPL(Yuv420pToUyvy422, Sse41::DA) SIMD_NEON_IMPL(Yuv420pToUyvy422, Neon::DA)
+        SIMD_BASE_IMPL(Yuv420pToUyvy422) };
+
+    simdYuv420pToUyvy422(width)(y, yStride, u, uStride, v, vStride, width, height, uyvy, uyvyStride);
 }
 
 
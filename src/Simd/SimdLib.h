@@ -290,6 +290,17 @@ typedef enum
     SimdOperationBinary16iSubtraction,
 } SimdOperationBinary16iType;
 
+/*! @ingroup c_types
+    Describes formats of exported performance statistics. It is used in function ::SimdPerformanceStatisticExport.
+*/
+typedef enum
+{
+    /*! A JSON document: an object with array "functions", one object per measured function. */
+    SimdPerformanceFormatJson,
+    /*! A CSV table with header line and one line per measured function. */
+    SimdPerformanceFormatCsv,
+} SimdPerformanceFormatType;
+
 /*! @ingroup c_types
     Describes pixel format types of an image.
     In particular this type is used in functions ::SimdBayerToBgr, ::SimdBayerToBgra, ::SimdBgraToBayer and ::SimdBgrToBayer.
@@ -417,6 +428,20 @@ typedef enum
     SimdSynetEltwiseOperationMin, /*!< Minimum. */
 } SimdSynetEltwiseOperationType;
 
+/*! @ingroup synet_planner
+    Describes type of layer context registered in memory planner by function ::SimdSynetPlannerAddLayer.
+*/
+typedef enum
+{
+    SimdSynetPlannerLayerOther, /*!< A layer without external temporary buffer (context is ignored). */
+    SimdSynetPlannerLayerConvolution32f, /*!< FP32 convolution (context is created by function ::SimdSynetConvolution32fInit). */
+    SimdSynetPlannerLayerConvolution8i, /*!< INT8 convolution (context is created by function ::SimdSynetConvolution8iInit). */
+    SimdSynetPlannerLayerDeconvolution32f, /*!< FP32 deconvolution (context is created by function ::SimdSynetDeconvolution32fInit). */
+    SimdSynetPlannerLayerInnerProduct32f, /*!< FP32 inner product (context is created by function ::SimdSynetInnerProduct32fInit). */
+    SimdSynetPlannerLayerMergedConvolution32f, /*!< FP32 merged convolution (context is created by function ::SimdSynetMergedConvolution32fInit). */
+    SimdSynetPlannerLayerMergedConvolution8i, /*!< INT8 merged convolution (context is created by function ::SimdSynetMergedConvolution8iInit). */
+} SimdSynetPlannerLayerType;
+
 /*! @ingroup synet
     Describes operation type used in function ::SimdSynetUnaryOperation32fLayerForward.
 */
@@ -664,18 +689,68 @@ extern "C"
     */
     SIMD_API size_t SimdCpuInfo(SimdCpuInfoType type);
 
+    /*! @ingroup info
+
+        \fn void SimdSetMaxIsa(SimdCpuInfoType isa);
+
+        \short Restricts instruction sets which are used by %Simd Library.
+
+        Every function of %Simd Library binds its available implementations at first call. 
+        This function allows to switch at runtime (for example for A/B testing) to implementations which use given instruction set and older ones.
+        The order of instruction sets is the order of ::SimdCpuInfoType: ::SimdCpuInfoSse2 < ::SimdCpuInfoSse41 < ... < ::SimdCpuInfoAmx.
+        Restriction to ::SimdCpuInfoNeon (it is default value) removes any restriction.
+        Values which are not instruction sets (from ::SimdCpuInfoSockets to ::SimdCpuInfoCacheL3) restrict library to Base (scalar) implementations.
+
+        \note It doesn't enable instruction sets which are not supported by CPU. 
+            It has no effect on already created contexts (for example ::SimdSynetConvolution32fInit) which keep their implementation.
+            The function is not synchronized with running functions of %Simd Library.
+
+        \param [in] isa - the newest allowed instruction set.
+    */
+    SIMD_API void SimdSetMaxIsa(SimdCpuInfoType isa);
+
     /*! @ingroup info
 
         \fn const char *SimdPerformanceStatistic();
 
         \short Gets internal performance statistics of %Simd Library.
 
+        For every measured function it contains total and average time, number of calls, minimal and maximal time,
+        50 and 99 percentiles of time (estimated with using of logarithmic histogram) and GFLOPS (if it is known).
+        If %Simd Library is built for Linux with defined SIMD_PERFORMANCE_COUNTERS macro (CMake option SIMD_PERF_COUNTERS) it also contains 
+        average number of CPU cycles, instructions per cycle, L1D and LLC misses and stalled cycles per call
+        (hardware counters are read with using of perf_event_open for the calling thread only, they are skipped if the kernel doesn't allow it).
+
         \note %Simd Library have to be build with defined SIMD_PERFORMANCE_STATISTIC macro.
 
         \return string with internal performance statistics of %Simd Library.
     */
     SIMD_API const char * SimdPerformanceStatistic();
 
+    /*! @ingroup info
+
+        \fn const char * SimdPerformanceStatisticExport(SimdPerformanceFormatType format, SimdBool reset);
+
+        \short Exports internal performance statistics of %Simd Library in machine-readable format.
+
+        Every record describes one measured function (functions of Synet contexts are measured separately for every parameter set)
+        and contains: name, description, used instruction set (Base, Sse41, Avx2, Avx512bw, ...), number of calls, 
+        total, minimal, maximal, 50 and 99 percentiles of time (in milliseconds), GFLOPS and effective memory bandwidth (in GB/s, 
+        it is estimated from size of input, output and weights) if they are known. Records also contain total values of hardware counters 
+        (cycles, instructions, l1d_misses, llc_misses, stalled_cycles), they are zero if the counters are not enabled (see ::SimdPerformanceStatistic).
+
+        If reset is ::SimdTrue then the statistics is snapshotted: every next export contains only calls performed after this one.
+        It allows to monitor per-interval performance of long running process. Minimal and maximal times of interval are estimated with 
+        accuracy of histogram bucket (25%).
+
+        \note %Simd Library have to be build with defined SIMD_PERFORMANCE_STATISTIC macro.
+
+        \param [in] format - a format of exported statistics (see ::SimdPerformanceFormatType).
+        \param [in] reset - a flag to start a new interval of measurement after export.
+        \return string with exported performance statistics. It is valid until next call of this function.
+    */
+    SIMD_API const char * SimdPerformanceStatisticExport(SimdPerformanceFormatType format, SimdBool reset);
+
     /*! @ingroup memory
 
         \fn void * SimdAllocate(size_t size, size_t align);
@@ -726,6 +801,80 @@ extern "C"
     */
     SIMD_API size_t SimdAlignment();
 
+    /*! @ingroup memory
+
+        \fn size_t SimdScratchMark();
+
+        \short Gets current position of thread-local scratch memory.
+
+        Scratch memory is a per-thread arena of aligned memory which is reused between calls instead of heap allocation.
+        The position returned by this function has to be passed to ::SimdScratchReset when temporary buffers are no longer needed.
+
+        \return a current position of scratch memory of calling thread.
+    */
+    SIMD_API size_t SimdScratchMark();
+
+    /*! @ingroup memory
+
+        \fn void * SimdScratchAllocate(size_t size, size_t align);
+
+        \short Allocates temporary aligned memory block from thread-local scratch memory.
+
+        \note The memory allocated by this function is valid until call of ::SimdScratchReset with position obtained before allocation. It must not be deleted by function ::SimdFree.
+
+        \param [in] size - a size of memory block.
+        \param [in] align - a required alignment of memory block.
+
+        \return a pointer to allocated memory.
+    */
+    SIMD_API void * SimdScratchAllocate(size_t size, size_t align);
+
+    /*! @ingroup memory
+
+        \fn void SimdScratchReset(size_t mark);
+
+        \short Releases all memory blocks allocated from thread-local scratch memory after given position.
+
+        \param [in] mark - a position obtained by function ::SimdScratchMark.
+    */
+    SIMD_API void SimdScratchReset(size_t mark);
+
+    /*! @ingroup memory
+
+        \fn size_t SimdGetHugePageThreshold();
+
+        \short Gets minimal size of memory block which is backed by huge (2 MB) pages.
+
+        \return a current threshold of huge page allocation. 0 means that huge page allocation is disabled.
+    */
+    SIMD_API size_t SimdGetHugePageThreshold();
+
+    /*! @ingroup memory
+
+        \fn void SimdSetHugePageThreshold(size_t threshold);
+
+        \short Sets minimal size of memory block which is backed by huge (2 MB) pages.
+
+        Memory blocks allocated by ::SimdAllocate (and internally by Simd Library) with size not less than the threshold are aligned to 2 MB
+        and advised to be backed by transparent huge pages. It reduces TLB misses for large images and tensors.
+        By default huge page allocation is disabled.
+
+        \note This function is supported only on Linux. Huge pages are used only if transparent huge pages are enabled in the system.
+
+        \param [in] threshold - a minimal size of memory block to be backed by huge pages. 0 disables huge page allocation.
+    */
+    SIMD_API void SimdSetHugePageThreshold(size_t threshold);
+
+    /*! @ingroup memory
+
+        \fn size_t SimdGetHugePageBytes();
+
+        \short Gets total size of currently allocated memory blocks which are advised to be backed by huge pages.
+
+        \return a total size (in bytes) of memory backed by huge pages.
+    */
+    SIMD_API size_t SimdGetHugePageBytes();
+
     /*! @ingroup memory
 
         \fn void SimdRelease(void * context);
@@ -733,6 +882,8 @@ extern "C"
         \short Releases context created with using of Simd Library API.
 
         \note This function releases a context created by functions ::SimdDetectionLoadA and ::SimdDetectionInit.
+            Contexts are reference counted: a context whose weights are shared (see functions ::SimdSynetConvolution32fShare and ::SimdSynetConvolution8iShare)
+            is destroyed only after the last context which refers to it is released.
 
         \param [in] context - a context to be released.
     */    
@@ -754,10 +905,201 @@ extern "C"
 
         \short Sets number of threads used by Simd Library to parallelize some algorithms.
 
+        \note The threads are taken from persistent pool of Simd Library. Its workers are started once (at first call of this function or of multithreaded algorithm) and are reused later.
+
+        \note Besides of matrix multiplication and neural network functions the thread number is used by next per-pixel functions:
+        ::SimdAlphaBlending, ::SimdBgraToGray, ::SimdGaussianBlur3x3, ::SimdIntegral (without tilted sum), ::SimdMedianFilterSquare5x5,
+        ::SimdSobelDx and ::SimdYuv420pToBgra. They split the image into horizontal bands which are processed in parallel.
+        Each band has at least 128K (128*1024) pixels, so small images are processed in the calling thread.
+        ::SimdResizeBilinear is not parallelized: its source row coordinates are calculated from the whole image height
+        so separate bands would not give bit exact result.
+
         \param [in] threadNumber - a number of threads.
     */
     SIMD_API void SimdSetThreadNumber(size_t threadNumber);
 
+    /*! @ingroup thread
+
+        \short Describes a task which is executed by ::SimdParallel.
+
+        \param [in, out] context - a pointer to user defined context of the task.
+        \param [in] thread - an index of the block (from 0 to threadNumber - 1). It can be used to access thread specific buffers.
+        \param [in] begin - a beginning of the processed block.
+        \param [in] end - an end of the processed block.
+    */
+    typedef void(*SimdParallelTaskPtr)(void * context, size_t thread, size_t begin, size_t end);
+
+    /*! @ingroup thread
+
+        \fn void SimdParallel(size_t begin, size_t end, SimdParallelTaskPtr task, void * context, size_t threadNumber, size_t blockAlign);
+
+        \short Splits range [begin, end) into blocks and executes given task for them in parallel.
+
+        The blocks are executed by persistent pool of worker threads of Simd Library (with using of work stealing).
+        The workers are started once and are reused by all subsequent calls. The calling thread processes the first block itself.
+        While it waits for the rest blocks it executes only not started blocks of the same call (never tasks of other calls).
+        The function can be called from several external threads concurrently and from inside of the task (nested call).
+        If the task throws an exception then the function waits for all blocks and rethrows the first exception.
+        The worker threads are detached at process exit.
+
+        \note This function is used by C++ wrapper Simd::Parallel.
+
+        \param [in] begin - a beginning of the range.
+        \param [in] end - an end of the range.
+        \param [in] task - a pointer to the task function.
+        \param [in, out] context - a pointer to user defined context which is passed to the task.
+        \param [in] threadNumber - a maximal number of threads (blocks).
+        \param [in] blockAlign - an alignment of block size.
+    */
+    SIMD_API void SimdParallel(size_t begin, size_t end, SimdParallelTaskPtr task, void * context, size_t threadNumber, size_t blockAlign);
+
+    /*! @ingroup thread
+
+        \fn void SimdSetThreadBudget(void * context, size_t threadNumber, const size_t * cpus, size_t cpuCount);
+
+        \short Sets own thread budget (a number of threads and optional set of CPUs) for given context.
+
+        By default a context uses global thread number (see ::SimdSetThreadNumber) and global pool of worker threads.
+        The budget of the context is used instead of them in all calls which take this context
+        (for example ::SimdSynetConvolution32fForward, ::SimdResizerRun or ::SimdGaussianBlurRun), including nested multithreaded algorithms.
+        If the set of CPUs is given then the blocks of the context are executed by separate pool of workers which are bound to these CPUs
+        (this pool is shared by all contexts with the same set of CPUs). It allows to run several independent streams without oversubscription of cores.
+
+        \note The function must not be called concurrently with other calls which use this context.
+
+        \param [in, out] context - a context created by any Init function of Simd Library (for example ::SimdSynetConvolution32fInit, ::SimdResizerInit or ::SimdGaussianBlurInit).
+        \param [in] threadNumber - a number of threads of the context. Zero value means that the number of threads is equal to number of given CPUs (or global thread number if CPUs are not given).
+        \param [in] cpus - a pointer to array with indexes of logical CPUs. Can be NULL.
+        \param [in] cpuCount - a size of array with CPU indexes. Zero value resets CPU binding.
+    */
+    SIMD_API void SimdSetThreadBudget(void * context, size_t threadNumber, const size_t * cpus, size_t cpuCount);
+
+    /*! @ingroup thread
+
+        \fn size_t SimdGetThreadBudget(const void * context);
+
+        \short Gets number of threads used by given context.
+
+        \param [in] context - a context created by any Init function of Simd Library.
+        \return number of threads of the context (see ::SimdSetThreadBudget).
+    */
+    SIMD_API size_t SimdGetThreadBudget(const void * context);
+
+    /*! @ingroup thread
+
+        \fn void SimdSetThreadAffinity(const size_t * cpus, size_t cpuCount);
+
+        \short Binds worker threads of global thread pool of Simd Library to given logical CPUs.
+
+        The worker with index i is bound to CPU cpus[i % cpuCount] (with using of sched_setaffinity on Linux and SetThreadAffinityMask on Windows).
+        The workers apply new binding at their next wake up. Per-thread buffers of multithreaded algorithms (for example packed buffers of matrix multiplication)
+        are allocated by the worker which uses them, so their memory is placed on NUMA node of this worker.
+
+        \note The calling thread is not bound. Use ::SimdGetThreadTopology to check current placement of workers.
+
+        \param [in] cpus - a pointer to array with indexes of logical CPUs. Can be NULL.
+        \param [in] cpuCount - a size of array with CPU indexes. Zero value removes the binding.
+    */
+    SIMD_API void SimdSetThreadAffinity(const size_t * cpus, size_t cpuCount);
+
+    /*! @ingroup thread
+
+        \fn size_t SimdGetThreadTopology(size_t * cpus, size_t * nodes, size_t size);
+
+        \short Gets placement of started worker threads of global thread pool of Simd Library.
+
+        \param [out] cpus - a pointer to array for CPU index of every worker (-1 for worker which is not bound to single CPU). Can be NULL.
+        \param [out] nodes - a pointer to array for NUMA node index of every worker (-1 for worker which is not bound to single CPU). Can be NULL.
+        \param [in] size - a size of output arrays.
+        \return number of started workers (it can be greater than size).
+    */
+    SIMD_API size_t SimdGetThreadTopology(size_t * cpus, size_t * nodes, size_t size);
+
+    /*! @ingroup thread
+
+        \short Describes a task which is executed by task graph (see ::SimdTaskGraphSubmit).
+
+        \param [in, out] context - a pointer to user defined context of the task.
+        \param [in] skip - a flag that one of dependencies of the task has failed. In this case the task must only release its context and return.
+    */
+    typedef void(*SimdTaskGraphTaskPtr)(void * context, SimdBool skip);
+
+    /*! @ingroup thread
+
+        \fn void * SimdTaskGraphInit();
+
+        \short Creates asynchronous task graph.
+
+        The task graph executes submitted tasks by persistent pool of worker threads of Simd Library as soon as all their dependencies are finished.
+        It allows to overlap independent stages of processing (for example JPEG encoding of previous frame and detection on the current one):
+
+        \verbatim
+        void * graph = SimdTaskGraphInit();
+        size_t motion = SimdTaskGraphSubmit(graph, MotionTask, frame, NULL, 0);
+        size_t detect = SimdTaskGraphSubmit(graph, DetectTask, frame, &motion, 1);
+        size_t encode = SimdTaskGraphSubmit(graph, EncodeTask, previous, NULL, 0);
+        SimdTaskGraphWait(graph, detect);
+        SimdTaskGraphWait(graph, encode);
+        SimdRelease(graph);
+        \endverbatim
+
+        The number of used threads is equal to global thread number (see ::SimdSetThreadNumber) or to thread budget of the graph (see ::SimdSetThreadBudget).
+        The thread budget of the graph is also used by multithreaded algorithms called inside of the tasks.
+        If there is only one thread then the tasks are executed immediately in the thread which submits them (or finishes their last dependency).
+
+        \note This function has a C++ wrapper Simd::TaskGraph.
+
+        \return a pointer to task graph context. It must be released with using of function ::SimdRelease (it waits for all submitted tasks).
+    */
+    SIMD_API void * SimdTaskGraphInit();
+
+    /*! @ingroup thread
+
+        \fn size_t SimdTaskGraphSubmit(void * graph, SimdTaskGraphTaskPtr task, void * context, const size_t * deps, size_t depCount);
+
+        \short Submits task to task graph.
+
+        The task is started after all its dependencies are finished. If the task throws an exception then it is marked as failed,
+        and all tasks which depend on it are called with skip flag (and are also marked as failed).
+        The function can be called from several threads concurrently and from inside of the tasks.
+
+        \param [in, out] graph - a pointer to task graph context. It must be created by function ::SimdTaskGraphInit.
+        \param [in] task - a pointer to the task function.
+        \param [in, out] context - a pointer to user defined context which is passed to the task.
+        \param [in] deps - a pointer to array with identifiers of tasks this task depends on. Can be NULL.
+        \param [in] depCount - a size of array with dependencies.
+        \return a nonzero identifier of the task. It returns 0 (and the task is not submitted) if dependencies are wrong.
+    */
+    SIMD_API size_t SimdTaskGraphSubmit(void * graph, SimdTaskGraphTaskPtr task, void * context, const size_t * deps, size_t depCount);
+
+    /*! @ingroup thread
+
+        \fn SimdBool SimdTaskGraphWait(void * graph, size_t task);
+
+        \short Waits for finish of given task of task graph.
+
+        While the calling thread waits it executes not started tasks of the graph.
+        The result of a failed task is reported only once (by this function or by ::SimdTaskGraphWaitAll).
+
+        \note The tasks should express the order of execution with dependencies instead of waiting for each other.
+
+        \param [in, out] graph - a pointer to task graph context. It must be created by function ::SimdTaskGraphInit.
+        \param [in] task - an identifier of the task returned by function ::SimdTaskGraphSubmit.
+        \return ::SimdFalse if the task has failed (or was skipped).
+    */
+    SIMD_API SimdBool SimdTaskGraphWait(void * graph, size_t task);
+
+    /*! @ingroup thread
+
+        \fn SimdBool SimdTaskGraphWaitAll(void * graph);
+
+        \short Waits for finish of all submitted tasks of task graph.
+
+        \param [in, out] graph - a pointer to task graph context. It must be created by function ::SimdTaskGraphInit.
+        \return ::SimdFalse if any task has failed since the previous call of this function.
+    */
+    SIMD_API SimdBool SimdTaskGraphWaitAll(void * graph);
+
     /*! @ingroup cpu_flags
 
         \fn SimdBool SimdGetFastMode();
@@ -1003,6 +1345,8 @@ extern "C"
 
         This function is used for image drawing.
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \note This function has a C++ wrapper Simd::AlphaBlending(const View<A>& src, const View<A>& alpha, View<A>& dst).
 
         \param [in] src - a pointer to pixels data of foreground image.
@@ -1537,6 +1881,8 @@ extern "C"
 
         All images must have the same width and height.
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \note This function has a C++ wrapper Simd::BgraToGray(const View<A>& bgra, View<A>& gray).
 
         \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
@@ -3168,6 +3514,8 @@ extern "C"
 
         All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \note This function has a C++ wrapper Simd::GaussianBlur3x3(const View<A>& src, View<A>& dst).
 
         \param [in] src - a pointer to pixels data of source image.
@@ -3929,6 +4277,8 @@ extern "C"
         The function can calculates sum integral image, square sum integral image (optionally) and tilted sum integral image (optionally).
         A integral images must have width and height per unit greater than that of the input image.
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \note This function has a C++ wrappers:
         \n Simd::Integral(const View<A>& src, View<A>& sum),
         \n Simd::Integral(const View<A>& src, View<A>& sum, View<A>& sqsum),
@@ -4329,6 +4679,8 @@ extern "C"
 
         All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \note This function has a C++ wrappers: Simd::MedianFilterSquare5x5(const View<A>& src, View<A>& dst).
 
         \param [in] src - a pointer to pixels data of original input image.
@@ -5056,6 +5408,137 @@ extern "C"
     SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal,
         uint8_t * dst, size_t stride, size_t width, size_t height);
 
+    /*! @ingroup pipeline
+
+        \fn void * SimdPipelineInit(size_t width, size_t height, SimdPixelFormatType format);
+
+        \short Creates context of fused image processing pipeline.
+
+        A pipeline executes a chain of stages (conversion, resizing, filtering, binarization, conversion to input tensor of neural network) 
+        tile by tile in horizontal strips which fit into L2 cache. So intermediate images never leave the cache. Strips are processed in parallel.
+        An using example (NV12 frame to normalized NCHW input tensor):
+        \verbatim
+        void * pipeline = SimdPipelineInit(1920, 1080, SimdPixelFormatUv16);
+        SimdPipelineAddConvert(pipeline, SimdPixelFormatBgr24);
+        SimdPipelineAddResize(pipeline, 640, 360);
+        SimdPipelineAddSetInput(pipeline, lower, upper, 3, SimdTensorFormatNchw);
+        const uint8_t * src[2] = { y, uv };
+        size_t srcStride[2] = { yStride, uvStride };
+        SimdPipelineRun(pipeline, src, srcStride, (uint8_t*)tensor, 0);
+        SimdRelease(pipeline);
+        \endverbatim
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber, ::SimdSetThreadNumber and ::SimdSetThreadBudget).
+
+        \param [in] width - a width of input image.
+        \param [in] height - a height of input image.
+        \param [in] format - a pixel format of input image. There are supported following pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, 
+            ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24 and ::SimdPixelFormatUv16 (it means NV12 image with two planes: 8-bit Y plane and 16-bit interleaved UV plane of half size).
+        \return a pointer to pipeline context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdPipelineInit(size_t width, size_t height, SimdPixelFormatType format);
+
+    /*! @ingroup pipeline
+
+        \fn SimdBool SimdPipelineAddConvert(void * pipeline, SimdPixelFormatType format);
+
+        \short Adds pixel format conversion stage to the pipeline.
+
+        There are supported following conversions: NV12 to Gray8, Bgr24 or Bgra32; Gray8 to Bgr24; Bgr24, Rgb24 or Bgra32 to Gray8; Bgra32 to Bgr24.
+
+        \param [in, out] pipeline - a pointer to pipeline context. It must be created by function ::SimdPipelineInit.
+        \param [in] format - a pixel format of output image of the stage.
+        \return result of operation. It returns ::SimdFalse if this conversion is not supported.
+    */
+    SIMD_API SimdBool SimdPipelineAddConvert(void * pipeline, SimdPixelFormatType format);
+
+    /*! @ingroup pipeline
+
+        \fn SimdBool SimdPipelineAddResize(void * pipeline, size_t width, size_t height);
+
+        \short Adds stage of bilinear image resizing to the pipeline.
+
+        \param [in, out] pipeline - a pointer to pipeline context. It must be created by function ::SimdPipelineInit.
+        \param [in] width - a width of output image of the stage.
+        \param [in] height - a height of output image of the stage.
+        \return result of operation.
+    */
+    SIMD_API SimdBool SimdPipelineAddResize(void * pipeline, size_t width, size_t height);
+
+    /*! @ingroup pipeline
+
+        \fn SimdBool SimdPipelineAddGaussianBlur3x3(void * pipeline);
+
+        \short Adds stage of Gaussian blur 3x3 filter (see function ::SimdGaussianBlur3x3) to the pipeline.
+
+        \param [in, out] pipeline - a pointer to pipeline context. It must be created by function ::SimdPipelineInit.
+        \return result of operation.
+    */
+    SIMD_API SimdBool SimdPipelineAddGaussianBlur3x3(void * pipeline);
+
+    /*! @ingroup pipeline
+
+        \fn SimdBool SimdPipelineAddSobelAbs(void * pipeline, SimdBool dx);
+
+        \short Adds stage of absolute value of Sobel filter (see functions ::SimdSobelDxAbs and ::SimdSobelDyAbs) to the pipeline.
+
+        Input image of the stage must have 8-bit gray format. Output image of the stage has 16-bit format (::SimdPixelFormatInt16), 
+        so it must be the last stage of the pipeline.
+
+        \param [in, out] pipeline - a pointer to pipeline context. It must be created by function ::SimdPipelineInit.
+        \param [in] dx - a flag of Sobel filter along x axis. Otherwise it is Sobel filter along y axis.
+        \return result of operation.
+    */
+    SIMD_API SimdBool SimdPipelineAddSobelAbs(void * pipeline, SimdBool dx);
+
+    /*! @ingroup pipeline
+
+        \fn SimdBool SimdPipelineAddBinarization(void * pipeline, uint8_t value, uint8_t positive, uint8_t negative, SimdCompareType compareType);
+
+        \short Adds binarization stage (see function ::SimdBinarization) to the pipeline.
+
+        Input image of the stage must have 8-bit gray format.
+
+        \param [in, out] pipeline - a pointer to pipeline context. It must be created by function ::SimdPipelineInit.
+        \param [in] value - a value for compare operation.
+        \param [in] positive - a destination value if comparison operation has a positive result.
+        \param [in] negative - a destination value if comparison operation has a negative result.
+        \param [in] compareType - a compare operation type (see ::SimdCompareType).
+        \return result of operation.
+    */
+    SIMD_API SimdBool SimdPipelineAddBinarization(void * pipeline, uint8_t value, uint8_t positive, uint8_t negative, SimdCompareType compareType);
+
+    /*! @ingroup pipeline
+
+        \fn SimdBool SimdPipelineAddSetInput(void * pipeline, const float * lower, const float * upper, size_t channels, SimdTensorFormatType format);
+
+        \short Adds stage of conversion to input tensor of neural network (see function ::SimdSynetSetInput) to the pipeline.
+
+        It must be the last stage of the pipeline. The output of the pipeline is 32-bit float tensor, the output stride is ignored.
+
+        \param [in, out] pipeline - a pointer to pipeline context. It must be created by function ::SimdPipelineInit.
+        \param [in] lower - a pointer to the array with lower bound of values of the output tensor.
+        \param [in] upper - a pointer to the array with upper bound of values of the output tensor.
+        \param [in] channels - a number of channels in the output tensor. It can be 1 or 3.
+        \param [in] format - a format of output tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \return result of operation.
+    */
+    SIMD_API SimdBool SimdPipelineAddSetInput(void * pipeline, const float * lower, const float * upper, size_t channels, SimdTensorFormatType format);
+
+    /*! @ingroup pipeline
+
+        \fn void SimdPipelineRun(const void * pipeline, const uint8_t * const * src, const size_t * srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Runs the pipeline.
+
+        \param [in] pipeline - a pointer to pipeline context. It must be created by function ::SimdPipelineInit.
+        \param [in] src - a pointer to array with pointers to planes of input image (one plane or two planes for NV12 image).
+        \param [in] srcStride - a pointer to array with row sizes of planes of input image.
+        \param [out] dst - a pointer to pixels data of output image (or to output tensor).
+        \param [in] dstStride - a row size of output image. It is ignored for tensor output.
+    */
+    SIMD_API void SimdPipelineRun(const void * pipeline, const uint8_t * const * src, const size_t * srcStride, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup resizing
 
         \fn void SimdReduceColor2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
@@ -5533,6 +6016,8 @@ extern "C"
         For every point:
         \n dst[x, y] = (src[x+1,y-1] + 2*src[x+1, y] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x-1, y] + src[x-1, y+1]).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \note This function has a C++ wrappers: Simd::SobelDx(const View<A>& src, View<A>& dst).
 
         \param [in] src - a pointer to pixels data of the input image.
@@ -6311,6 +6796,23 @@ extern "C"
     */
     SIMD_API void SimdSynetConvert8uTo32f(const uint8_t* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, float* dst, SimdSynetCompatibilityType compatibility);
 
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void SimdSynetSetTuning(SimdBool enable, const char * database);
+
+        \short Enables or disables autotuning of convolution algorithms.
+
+        If autotuning is enabled, function ::SimdSynetConvolution32fInit benchmarks all applicable algorithms (and their variants of blocking) 
+        for given convolution parameters on the current machine and creates the fastest one. 
+        The winner is stored in tuning database with key which consists of CPU model, instruction set and convolution parameters. 
+        So the next creation of the same convolution (also at later process starts if database is stored in the file) skips benchmarking.
+        Autotuning is disabled by default. It has no effect on already created contexts.
+
+        \param [in] enable - a flag to enable autotuning.
+        \param [in] database - a path to the file with tuning database. It is loaded at this call, new results are appended to it. Can be NULL (database is kept in memory only).
+    */
+    SIMD_API void SimdSynetSetTuning(SimdBool enable, const char * database);
+
     /*! @ingroup synet_convolution_fp32
 
         \fn void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
@@ -6322,7 +6824,8 @@ extern "C"
         \param [in] compatibility - a flags of calculation compatibility.
         \return a pointer to FP32 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
             This pointer is used in functions ::SimdSynetConvolution32fExternalBufferSize, ::SimdSynetConvolution32fInternalBufferSize, 
-            ::SimdSynetConvolution32fInfo, ::SimdSynetConvolution32fSetParams and ::SimdSynetConvolution32fForward.
+            ::SimdSynetConvolution32fInfo, ::SimdSynetConvolution32fSetParams, ::SimdSynetConvolution32fExport, ::SimdSynetConvolution32fImport, 
+            ::SimdSynetConvolution32fForward and ::SimdSynetConvolution32fForwardAdd.
     */
     SIMD_API void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
 
@@ -6373,6 +6876,42 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution32fSetParams(void * context, const float * weight, SimdBool * internal, const float * bias, const float * params);
 
+    /*! @ingroup synet_convolution_fp32
+
+        \fn size_t SimdSynetConvolution32fExport(const void * context, void * data, size_t size);
+
+        \short Exports packed (reordered, transformed or converted to BF16) weights of FP32 convolution algorithm.
+
+        The image is tagged with algorithm, instruction set, cache sizes and blocking parameters. It can be stored to file and restored later with using of function ::SimdSynetConvolution32fImport.
+
+        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and initialized by function ::SimdSynetConvolution32fSetParams.
+        \param [out] data - a pointer to output buffer. Can be NULL.
+        \param [in] size - a size of output buffer in bytes.
+        \return the size of the image in bytes. The image is written only if data is not NULL and size is enough. 
+            Returns 0 if the algorithm uses original weights directly (there is nothing to export).
+    */
+    SIMD_API size_t SimdSynetConvolution32fExport(const void * context, void * data, size_t size);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn SimdBool SimdSynetConvolution32fImport(void * context, const void * data, size_t size, const float * weight, SimdBool * internal, const float * bias, const float * params);
+
+        \short Sets parameters of FP32 convolution algorithm with using of packed weights exported by function ::SimdSynetConvolution32fExport.
+
+        If the image was created for the same convolution parameters, algorithm, instruction set, cache sizes and blocking parameters, the weights are copied from it 
+        without any transformation. Otherwise the function falls back to ::SimdSynetConvolution32fSetParams.
+
+        \param [in, out] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] data - a pointer to the image (for example memory mapped file).
+        \param [in] size - a size of the image in bytes.
+        \param [in] weight - a pointer to original convolution weights. It is used for fallback. Can be NULL (then the context stays uninitialized if the image does not match).
+        \param [out] internal - a flag signalized that weight is stored in the internal buffer. Can be NULL.
+        \param [in] bias - a pointer to bias. Can be NULL.
+        \param [in] params - a pointer to parameters of activation functions (see ::SimdConvolutionActivationType). Can be NULL.
+        \return ::SimdTrue if the weights were restored from the image and ::SimdFalse if the image does not match the context.
+    */
+    SIMD_API SimdBool SimdSynetConvolution32fImport(void * context, const void * data, size_t size, const float * weight, SimdBool * internal, const float * bias, const float * params);
+
     /*! @ingroup synet_convolution_fp32
 
         \fn void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst);
@@ -6383,9 +6922,50 @@ extern "C"
         \param [in] src - a pointer to input tensor.
         \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetConvolution32fExternalBufferSize. Can be NULL (it causes usage of internal buffer).
         \param [out] dst - a pointer to output tensor.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber, ::SimdSetThreadNumber and ::SimdSetThreadBudget).
+            Additional threads use their own temporary buffers, the external buffer is used only by the calling thread.
     */
     SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_convolution_fp32
+
+        \fn SimdBool SimdSynetConvolution32fForwardAdd(void * context, const float * src, float * buf, float * dst);
+
+        \short Performs forward propagation of FP32 convolution algorithm with addition of residual input.
+
+        It calculates: dst = activation(convolution(src) + bias + dst). The residual input is passed in the output tensor and it is added before activation
+        (for identity activation it is equivalent to dst += convolution(src) + bias). Algorithms NhwcDirect and GemmNN (with NCHW format or without NHWC GEMM kernels)
+        accumulate the result in the output tensor without any additional pass over memory.
+
+        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor.
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetConvolution32fExternalBufferSize. Can be NULL (it causes usage of internal buffer).
+        \param [in, out] dst - a pointer to residual input and output tensor.
+        \return SimdTrue on success. If the selected algorithm can't add residual input before non-identity activation it returns SimdFalse and doesn't change the output tensor.
+            In this case the addition has to be performed separately (for example with using of function ::SimdSynetEltwiseLayerForward).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber, ::SimdSetThreadNumber and ::SimdSetThreadBudget).
+    */
+    SIMD_API SimdBool SimdSynetConvolution32fForwardAdd(void * context, const float * src, float * buf, float * dst);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void * SimdSynetConvolution32fShare(void * context);
+
+        \short Creates a new FP32 convolution context which shares packed weights with given context.
+
+        The new context refers to read-only weights of the original context and owns only its thread budget (see ::SimdSetThreadBudget).
+        It allows to run the same convolution concurrently from several threads (or inference sessions) without duplication of weights.
+
+        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and initialized by function ::SimdSynetConvolution32fSetParams.
+        \return a pointer to new FP32 convolution context. It must be released with using of function ::SimdRelease.
+            Function ::SimdSynetConvolution32fSetParams must not be called for this context.
+
+        \note The weights are released together with the last context which refers to them. The original context may be released before shared ones.
+    */
+    SIMD_API void * SimdSynetConvolution32fShare(void * context);
+
     /*! @ingroup synet_convolution_int8
 
         \fn void * SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
@@ -6397,7 +6977,7 @@ extern "C"
         \param [in] compatibility - a flags of calculation compatibility.
         \return a pointer to INT8 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
             This pointer is used in functions ::SimdSynetConvolution8iExternalBufferSize, ::SimdSynetConvolution8iInternalBufferSize, 
-            ::SimdSynetConvolution8iInfo, ::SimdSynetConvolution8iSetParams and ::SimdSynetConvolution8iForward.
+            ::SimdSynetConvolution8iInfo, ::SimdSynetConvolution8iSetParams, ::SimdSynetConvolution8iExport, ::SimdSynetConvolution8iImport and ::SimdSynetConvolution8iForward.
     */
     SIMD_API void * SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
 
@@ -6448,6 +7028,41 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution8iSetParams(void * context, const float * weight, const float * bias, const float * params, const float * const* stats);
 
+    /*! @ingroup synet_convolution_int8
+
+        \fn size_t SimdSynetConvolution8iExport(const void * context, void * data, size_t size);
+
+        \short Exports quantized (and reordered) weights of INT8 convolution algorithm.
+
+        The image is tagged with algorithm, instruction set, cache sizes, blocking parameters and input quantization. 
+        It can be stored to file and restored later with using of function ::SimdSynetConvolution8iImport.
+
+        \param [in] context - a pointer to INT8 convolution context. It must be created by function ::SimdSynetConvolution8iInit and initialized by function ::SimdSynetConvolution8iSetParams.
+        \param [out] data - a pointer to output buffer. Can be NULL.
+        \param [in] size - a size of output buffer in bytes.
+        \return the size of the image in bytes. The image is written only if data is not NULL and size is enough.
+    */
+    SIMD_API size_t SimdSynetConvolution8iExport(const void * context, void * data, size_t size);
+
+    /*! @ingroup synet_convolution_int8
+
+        \fn SimdBool SimdSynetConvolution8iImport(void * context, const void * data, size_t size, const float * weight, const float * bias, const float * params, const float * const * stats);
+
+        \short Sets parameters of INT8 convolution algorithm with using of quantized weights exported by function ::SimdSynetConvolution8iExport.
+
+        If the image matches the context, the weights are copied from it without quantization. Otherwise the function falls back to ::SimdSynetConvolution8iSetParams.
+
+        \param [in, out] context - a pointer to INT8 convolution context. It must be created by function ::SimdSynetConvolution8iInit and released by function ::SimdRelease.
+        \param [in] data - a pointer to the image (for example memory mapped file).
+        \param [in] size - a size of the image in bytes.
+        \param [in] weight - a pointer to original (32-bit float point) convolution weights. It is used for fallback. Can be NULL.
+        \param [in] bias - a pointer to original (32-bit float point) bias. Can be NULL.
+        \param [in] params - a pointer to original (32-bit float point) parameters of activation functions (see ::SimdConvolutionActivationType). Can be NULL.
+        \param [in] stats - a pointer to pointers with statistics of input(min - stats[0], max - stats[1]) and output(min - stats[2], max - stats[3]) tensors.
+        \return ::SimdTrue if the weights were restored from the image and ::SimdFalse if the image does not match the context.
+    */
+    SIMD_API SimdBool SimdSynetConvolution8iImport(void * context, const void * data, size_t size, const float * weight, const float * bias, const float * params, const float * const * stats);
+
     /*! @ingroup synet_convolution_int8
 
         \fn void SimdSynetConvolution8iForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
@@ -6458,9 +7073,27 @@ extern "C"
         \param [in] src - a pointer to input tensor.
         \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetConvolution8iExternalBufferSize. Can be NULL (it causes usage of internal buffer).
         \param [out] dst - a pointer to output tensor.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber, ::SimdSetThreadNumber and ::SimdSetThreadBudget).
     */
     SIMD_API void SimdSynetConvolution8iForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
 
+    /*! @ingroup synet_convolution_int8
+
+        \fn void * SimdSynetConvolution8iShare(void * context);
+
+        \short Creates a new INT8 convolution context which shares quantized weights with given context.
+
+        The new context refers to read-only weights of the original context and owns only its thread budget (see ::SimdSetThreadBudget).
+
+        \param [in] context - a pointer to INT8 convolution context. It must be created by function ::SimdSynetConvolution8iInit and initialized by function ::SimdSynetConvolution8iSetParams.
+        \return a pointer to new INT8 convolution context. It must be released with using of function ::SimdRelease.
+            Function ::SimdSynetConvolution8iSetParams must not be called for this context.
+
+        \note The weights are released together with the last context which refers to them. The original context may be released before shared ones.
+    */
+    SIMD_API void * SimdSynetConvolution8iShare(void * context);
+
     /*! @ingroup synet_deconvolution_fp32
 
         \fn void * SimdSynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
@@ -7094,6 +7727,9 @@ extern "C"
         \param [in] src - a pointer to input image.
         \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetMergedConvolution32fExternalBufferSize. Can be NULL (it causes usage of internal buffer).
         \param [out] dst - a pointer to output image.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber, ::SimdSetThreadNumber and ::SimdSetThreadBudget).
+            Additional threads use their own temporary buffers, the external buffer is used only by the calling thread.
     */
     SIMD_API void SimdSynetMergedConvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
@@ -7171,9 +7807,106 @@ extern "C"
         \param [in] src - a pointer to input image.
         \param [out] buf - a pointer to external temporary buffer. The sizein bytes of the external temporary buffer is determined by function ::SimdSynetMergedConvolution8iExternalBufferSize. Can be NULL (it causes usage of internal buffer).
         \param [out] dst - a pointer to output image.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber, ::SimdSetThreadNumber and ::SimdSetThreadBudget).
+            Additional threads use their own temporary buffers, the external buffer is used only by the calling thread.
     */
     SIMD_API void SimdSynetMergedConvolution8iForward(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst);
 
+    /*! @ingroup synet_planner
+
+        \fn void * SimdSynetPlannerInit();
+
+        \short Creates memory planner for sequence of Synet layers.
+
+        The planner places activation tensors and external temporary buffers of the layers in one memory arena.
+        A tensor is alive from the first layer which uses it to the last one: tensors without producer (network inputs) are alive from the beginning,
+        tensors without consumer (network outputs) are alive to the end. A temporary buffer is alive only during its layer.
+        Memory of dead tensors and buffers is reused by others:
+
+        \verbatim
+        void * planner = SimdSynetPlannerInit();
+        size_t src = SimdSynetPlannerAddTensor(planner, srcSize * sizeof(float));
+        size_t tmp = SimdSynetPlannerAddTensor(planner, tmpSize * sizeof(float));
+        size_t dst = SimdSynetPlannerAddTensor(planner, dstSize * sizeof(float));
+        size_t conv0 = SimdSynetPlannerAddLayer(planner, SimdSynetPlannerLayerConvolution32f, context0, &src, 1, &tmp, 1);
+        size_t conv1 = SimdSynetPlannerAddLayer(planner, SimdSynetPlannerLayerConvolution32f, context1, &tmp, 1, &dst, 1);
+        uint8_t * arena = (uint8_t*)SimdAllocate(SimdSynetPlannerPlan(planner), SimdAlignment());
+        float * buf0 = (float*)(arena + SimdSynetPlannerBufferOffset(planner, conv0));
+        ...
+        \endverbatim
+
+        \return a pointer to memory planner context. It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdSynetPlannerInit();
+
+    /*! @ingroup synet_planner
+
+        \fn size_t SimdSynetPlannerAddTensor(void * planner, size_t size);
+
+        \short Registers a tensor in memory planner.
+
+        \param [in, out] planner - a pointer to memory planner context. It must be created by function ::SimdSynetPlannerInit.
+        \param [in] size - a size of the tensor in bytes.
+        \return an index of the tensor.
+    */
+    SIMD_API size_t SimdSynetPlannerAddTensor(void * planner, size_t size);
+
+    /*! @ingroup synet_planner
+
+        \fn size_t SimdSynetPlannerAddLayer(void * planner, SimdSynetPlannerLayerType type, const void * context, const size_t * src, size_t srcCount, const size_t * dst, size_t dstCount);
+
+        \short Registers next layer in memory planner.
+
+        The layers must be registered in order of their execution. The size of external temporary buffer of the layer is taken from its context
+        (see ::SimdSynetConvolution32fExternalBufferSize and others).
+
+        \param [in, out] planner - a pointer to memory planner context. It must be created by function ::SimdSynetPlannerInit.
+        \param [in] type - a type of the layer context.
+        \param [in] context - a pointer to the layer context. Can be NULL if type is ::SimdSynetPlannerLayerOther.
+        \param [in] src - a pointer to array with indices of input tensors. Can be NULL.
+        \param [in] srcCount - a number of input tensors.
+        \param [in] dst - a pointer to array with indices of output tensors. Can be NULL.
+        \param [in] dstCount - a number of output tensors.
+        \return an index of the layer. It returns SIZE_MAX (and the layer is not registered) if tensor indices are wrong.
+    */
+    SIMD_API size_t SimdSynetPlannerAddLayer(void * planner, SimdSynetPlannerLayerType type, const void * context, const size_t * src, size_t srcCount, const size_t * dst, size_t dstCount);
+
+    /*! @ingroup synet_planner
+
+        \fn size_t SimdSynetPlannerPlan(void * planner);
+
+        \short Computes layout of memory arena for registered tensors and layers.
+
+        \param [in, out] planner - a pointer to memory planner context. It must be created by function ::SimdSynetPlannerInit.
+        \return a size of memory arena in bytes. Offsets of all tensors and buffers in the arena are aligned to ::SimdAlignment.
+    */
+    SIMD_API size_t SimdSynetPlannerPlan(void * planner);
+
+    /*! @ingroup synet_planner
+
+        \fn size_t SimdSynetPlannerTensorOffset(const void * planner, size_t tensor);
+
+        \short Gets offset of tensor in memory arena. It must be called after ::SimdSynetPlannerPlan.
+
+        \param [in] planner - a pointer to memory planner context. It must be created by function ::SimdSynetPlannerInit.
+        \param [in] tensor - an index of the tensor returned by function ::SimdSynetPlannerAddTensor.
+        \return an offset of the tensor in bytes.
+    */
+    SIMD_API size_t SimdSynetPlannerTensorOffset(const void * planner, size_t tensor);
+
+    /*! @ingroup synet_planner
+
+        \fn size_t SimdSynetPlannerBufferOffset(const void * planner, size_t layer);
+
+        \short Gets offset of external temporary buffer of the layer in memory arena. It must be called after ::SimdSynetPlannerPlan.
+
+        \param [in] planner - a pointer to memory planner context. It must be created by function ::SimdSynetPlannerInit.
+        \param [in] layer - an index of the layer returned by function ::SimdSynetPlannerAddLayer.
+        \return an offset of the buffer in bytes.
+    */
+    SIMD_API size_t SimdSynetPlannerBufferOffset(const void * planner, size_t layer);
+
     /*! @ingroup synet_activation
 
         \fn void SimdSynetMish32f(const float* src, size_t size, const float* threshold, float* dst);
@@ -8343,6 +9076,8 @@ extern "C"
         The input Y and output BGRA images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \note This function has a C++ wrappers: Simd::Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha).
 
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
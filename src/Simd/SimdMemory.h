@@ -32,6 +32,12 @@
 #include <iostream>
 #endif
 #include <memory>
+#include <vector>
+#include <atomic>
+
+#if defined(__linux__) && defined(__GNUC__)
+#define SIMD_HUGE_PAGE_ENABLE
+#endif
 
 namespace Simd
 {
@@ -87,6 +93,20 @@ namespace Simd
         return ptr == AlignLo(ptr, align);
     }
 
+    namespace Base
+    {
+        const size_t HUGE_PAGE_SIZE = 0x200000;
+
+        extern std::atomic<size_t> g_hugePageThreshold;
+        extern std::atomic<size_t> g_hugePageBlocks;
+
+        void AdviseHugePage(void * ptr, size_t size);
+
+        void ReleaseHugePage(void * ptr);
+
+        size_t HugePageBytes();
+    }
+
     SIMD_INLINE void * Allocate(size_t size, size_t align = SIMD_ALIGN)
     {
 #ifdef SIMD_NO_MANS_LAND
@@ -100,9 +120,22 @@ namespace Simd
 #elif defined(__GNUC__)
         align = AlignHi(align, sizeof(void *));
         size = AlignHi(size, align);
+#ifdef SIMD_HUGE_PAGE_ENABLE
+        size_t threshold = Base::g_hugePageThreshold.load(std::memory_order_relaxed);
+        bool huge = threshold && size >= threshold && align <= Base::HUGE_PAGE_SIZE;
+        if (huge)
+        {
+            align = Base::HUGE_PAGE_SIZE;
+            size = AlignHi(size, align);
+        }
+#endif
         int result = ::posix_memalign(&ptr, align, size);
         if (result != 0)
             ptr = NULL;
+#ifdef SIMD_HUGE_PAGE_ENABLE
+        else if (huge)
+            Base::AdviseHugePage(ptr, size);
+#endif
 #else
         ptr = malloc(size);
 #endif
@@ -139,6 +172,10 @@ namespace Simd
         if (ptr)
             ptr = (char*)ptr - SIMD_NO_MANS_LAND;
 #endif
+#ifdef SIMD_HUGE_PAGE_ENABLE
+        if (ptr && Base::g_hugePageBlocks.load(std::memory_order_relaxed))
+            Base::ReleaseHugePage(ptr);
+#endif
 #if defined(_MSC_VER) 
         _aligned_free(ptr);
 #elif defined(__MINGW32__) || defined(__MINGW64__)
@@ -150,9 +187,44 @@ namespace Simd
 
     //---------------------------------------------------------------------------------------------
 
+    struct ThreadBudget
+    {
+        size_t threadNumber;
+        std::vector<size_t> cpus;
+        void * pool;
+
+        ThreadBudget() : threadNumber(0), pool(NULL) {}
+
+        bool Empty() const { return threadNumber == 0 && cpus.empty(); }
+    };
+
     struct Deletable
     {
+        Deletable() : _references(1) {}
+        Deletable(const Deletable& other) : budget(other.budget), _references(1) {}
         virtual ~Deletable() {}
+
+        Deletable& operator = (const Deletable& other)
+        {
+            budget = other.budget;
+            return *this;
+        }
+
+        SIMD_INLINE void Retain()
+        {
+            _references++;
+        }
+
+        SIMD_INLINE void Release()
+        {
+            if (--_references == 0)
+                delete this;
+        }
+
+        ThreadBudget budget;
+
+    private:
+        std::atomic<size_t> _references;
     };
 
     //---------------------------------------------------------------------------------------------
@@ -1,7 +1,7 @@
 /*
 * Simd Library (http://ermig1979.github.io/Simd).
 *
-* Copyright (c) 2011-2020 Yermalayeu Ihar.
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
 *
 * Permission is hereby granted, free of charge, to any person obtaining a copy
 * of this software and associated documentation files (the "Software"), to deal
@@ -24,11 +24,11 @@
 #ifndef __SimdParallel_hpp__
 #define __SimdParallel_hpp__
 
+#include "Simd/SimdLib.h"
+
 #include <vector>
 #include <thread>
-#ifndef SIMD_FUTURE_DISABLE
-#include <future>
-#endif
+#include <algorithm>
 
 namespace Simd
 {
@@ -42,22 +42,10 @@ namespace Simd
             function(0, begin, end);
         else
         {
-            std::vector<std::future<void>> futures;
-
-            size_t blockSize = (end - begin + threadNumber - 1) / threadNumber;
-            blockSize = (blockSize + blockAlign - 1) / blockAlign * blockAlign;
-            size_t blockBegin = begin;
-            size_t blockEnd = blockBegin + blockSize;
-
-            for (size_t thread = 0; thread < threadNumber && blockBegin < end; ++thread)
+            ::SimdParallel(begin, end, [](void * context, size_t thread, size_t blockBegin, size_t blockEnd)
             {
-                futures.push_back(std::move(std::async(std::launch::async, [blockBegin, blockEnd, thread, &function] { function(thread, blockBegin, blockEnd); })));
-                blockBegin += blockSize;
-                blockEnd = std::min(blockBegin + blockSize, end);
-            }
-
-            for (size_t i = 0; i < futures.size(); ++i)
-                futures[i].wait();
+                (*(const Function*)context)(thread, blockBegin, blockEnd);
+            }, (void*)&function, threadNumber, blockAlign);
         }
 #endif
     }
@@ -50,37 +50,138 @@ namespace Simd
 #include <iomanip>
 #include <memory>
 #include <map>
+#include <vector>
 #include <thread>
 #include <mutex>
 #include <algorithm>
 
+#if defined(SIMD_PERFORMANCE_COUNTERS) && defined(__linux__)
+#define SIMD_PERF_COUNTERS_ENABLE
+#endif
+
 namespace Simd
 {
     namespace Base
     {
-        class PerformanceMeasurer
+        struct PerformanceCounters
         {
-            String	_name;
-            int64_t _start, _current, _total, _min, _max;
-            int64_t _count, _flop;
-            bool _entered, _paused;
+            enum Type
+            {
+                Cycles,
+                Instructions,
+                L1dMisses,
+                LlcMisses,
+                StalledCycles,
+                Size
+            };
+
+            static const char * Name(size_t type);
+
+            static bool Read(int64_t * values);
+        };
+
+        SIMD_INLINE size_t PerformanceHistogramIndex(int64_t value)
+        {
+            if (value < 4)
+                return value < 0 ? 0 : size_t(value);
+#if defined(_MSC_VER) && defined(_M_X64)
+            unsigned long log;
+            _BitScanReverse64(&log, (unsigned __int64)value);
+#elif defined(__GNUC__)
+            size_t log = 63 - __builtin_clzll((unsigned long long)value);
+#else
+            size_t log = 2;
+            while (value >> (log + 1))
+                log++;
+#endif
+            return (log - 1) * 4 + size_t((value >> (log - 2)) & 3);
+        }
 
+        SIMD_INLINE int64_t PerformanceHistogramValue(size_t index)
+        {
+            if (index < 4)
+                return int64_t(index);
+            size_t log = index / 4 + 1;
+            return int64_t(4 + index % 4) << (log - 2);
+        }
+
+        class PerformanceMeasurer
+        {
         public:
-            PerformanceMeasurer(const String& name = "Unknown", int64_t flop = 0);
+            static const size_t HISTOGRAM_SIZE = 256;
+
+            PerformanceMeasurer(const String& name = "Unknown", int64_t flop = 0, int64_t bytes = 0);
 
             PerformanceMeasurer(const PerformanceMeasurer& pm);
 
-            void Enter();
+            SIMD_INLINE void Enter()
+            {
+                if (!_entered)
+                {
+                    _entered = true;
+                    _paused = false;
+#ifdef SIMD_PERF_COUNTERS_ENABLE
+                    _counting = PerformanceCounters::Read(_counterStart);
+#endif
+                    _start = TimeCounter();
+                }
+            }
 
-            void Leave(bool pause = false);
+            SIMD_INLINE void Leave(bool pause = false)
+            {
+                if (_entered || _paused)
+                {
+                    if (_entered)
+                    {
+                        _entered = false;
+                        _current += TimeCounter() - _start;
+#ifdef SIMD_PERF_COUNTERS_ENABLE
+                        int64_t counters[PerformanceCounters::Size];
+                        if (_counting && PerformanceCounters::Read(counters))
+                        {
+                            for (size_t i = 0; i < PerformanceCounters::Size; ++i)
+                                _counters[i] += counters[i] - _counterStart[i];
+                        }
+#endif
+                    }
+                    if (!pause)
+                    {
+                        _total += _current;
+                        _min = std::min(_min, _current);
+                        _max = std::max(_max, _current);
+                        _histogram[PerformanceHistogramIndex(_current)]++;
+                        ++_count;
+                        _current = 0;
+                    }
+                    _paused = pause;
+                }
+            }
 
             String Statistic() const;
 
             void Combine(const PerformanceMeasurer& other);
 
+            void Subtract(const PerformanceMeasurer& base);
+
+            void Export(std::ostream & os, SimdPerformanceFormatType format) const;
+
+            const String & Name() const { return _name; }
+
+            int64_t Count() const { return _count; }
+
         private:
+            String	_name;
+            int64_t _start, _current, _total, _min, _max;
+            int64_t _count, _flop, _bytes;
+            bool _entered, _paused, _counting;
+            uint32_t _histogram[HISTOGRAM_SIZE];
+            int64_t _counters[PerformanceCounters::Size], _counterStart[PerformanceCounters::Size];
+
             double Average() const;
             double GFlops() const;
+            double GBytes() const;
+            double Percentile(double percent) const;
+            String Isa() const;
         };
 
         class PerformanceMeasurerHolder
@@ -119,23 +220,47 @@ namespace Simd
             typedef PerformanceMeasurer Pm;
             typedef std::shared_ptr<Pm> PmPtr;
             typedef std::map<String, PmPtr> FunctionMap;
-            typedef std::map<std::thread::id, FunctionMap> ThreadMap;
+            typedef std::map<std::pair<size_t, String>, Pm*> DescMap;
 
-            ThreadMap _map;
+            struct Thread
+            {
+                FunctionMap functions;
+                std::vector<Pm*> handles;
+                DescMap descs;
+            };
+            typedef std::shared_ptr<Thread> ThreadPtr;
+            typedef std::vector<ThreadPtr> Threads;
+
+            Threads _threads;
+            std::vector<String> _handles;
             mutable std::mutex _mutex;
-            String _report;
+            String _report, _export;
+            FunctionMap _snapshot;
 
-            SIMD_INLINE FunctionMap & ThisThread()
+            SIMD_INLINE Thread & ThisThread()
             {
-                static thread_local FunctionMap * thread = NULL;
+                static thread_local Thread * thread = NULL;
                 if (thread == NULL)
                 {
                     std::lock_guard<std::mutex> lock(_mutex);
-                    thread = &_map[std::this_thread::get_id()];
+                    _threads.push_back(ThreadPtr(new Thread()));
+                    thread = _threads.back().get();
                 }
                 return *thread;
             }
 
+            Pm * Create(Thread & thread, const String & name, int64_t flop, int64_t bytes)
+            {
+                Pm * pm = new Pm(name, flop, bytes);
+                std::lock_guard<std::mutex> lock(_mutex);
+                thread.functions[name].reset(pm);
+                return pm;
+            }
+
+            Pm * CreateHandle(Thread & thread, size_t handle, int64_t flop);
+
+            void Combine(FunctionMap & combined) const;
+
         public:
             static PerformanceMeasurerStorage s_storage;
 
@@ -143,38 +268,61 @@ namespace Simd
             {
             }
 
-            SIMD_INLINE PerformanceMeasurer * Get(const String & name, int64_t flop = 0)
+            SIMD_INLINE PerformanceMeasurer * Get(const String & name, int64_t flop = 0, int64_t bytes = 0)
             {
-                FunctionMap & thread = ThisThread();
-                PerformanceMeasurer * pm = NULL;
-                FunctionMap::iterator it = thread.find(name);
-                if (it == thread.end())
-                {
-                    pm = new PerformanceMeasurer(name, flop);
-                    thread[name].reset(pm);
-                }
-                else
-                    pm = it->second.get();
-                return pm;
+                Thread & thread = ThisThread();
+                FunctionMap::iterator it = thread.functions.find(name);
+                if (it == thread.functions.end())
+                    return Create(thread, name, flop, bytes);
+                return it->second.get();
             }
 
-            SIMD_INLINE PerformanceMeasurer * Get(const String func, const String & desc, int64_t flop = 0)
+            SIMD_INLINE PerformanceMeasurer * Get(const String func, const String & desc, int64_t flop = 0, int64_t bytes = 0)
             {
-                return Get(func + "{ " + desc + " }", flop);
+                return Get(func + "{ " + desc + " }", flop, bytes);
+            }
+
+            size_t Register(const String & name);
+
+            SIMD_INLINE PerformanceMeasurer * Get(size_t handle, int64_t flop = 0)
+            {
+                Thread & thread = ThisThread();
+                if (handle < thread.handles.size() && thread.handles[handle])
+                    return thread.handles[handle];
+                return CreateHandle(thread, handle, flop);
+            }
+
+            SIMD_INLINE PerformanceMeasurer * Get(size_t handle, const String & desc, int64_t flop = 0)
+            {
+                Thread & thread = ThisThread();
+                DescMap::iterator it = thread.descs.find(DescMap::key_type(handle, desc));
+                if (it != thread.descs.end())
+                    return it->second;
+                String name;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    name = _handles[handle];
+                }
+                Pm * pm = Get(name, desc, flop);
+                thread.descs[DescMap::key_type(handle, desc)] = pm;
+                return pm;
             }
 
             const char* PerformanceStatistic();
+
+            const char* Export(SimdPerformanceFormatType format, bool reset);
         };
     }
 }
-#define SIMD_PERF_FUNCF(flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, (int64_t)(flop)))
+#define SIMD_PERF_HANDLE(name) static const size_t name = Simd::Base::PerformanceMeasurerStorage::s_storage.Register(SIMD_FUNCTION)
+#define SIMD_PERF_FUNCF(flop) SIMD_PERF_HANDLE(SIMD_CAT(__pmi, __LINE__)); Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_CAT(__pmi, __LINE__), (int64_t)(flop)))
 #define SIMD_PERF_FUNC() SIMD_PERF_FUNCF(0)
-#define SIMD_PERF_BEGF(desc, flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (int64_t)(flop)))
+#define SIMD_PERF_BEGF(desc, flop) SIMD_PERF_HANDLE(SIMD_CAT(__pmi, __LINE__)); Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_CAT(__pmi, __LINE__), desc, (int64_t)(flop)))
 #define SIMD_PERF_BEG(desc) SIMD_PERF_BEGF(desc, 0)
-#define SIMD_PERF_IFF(cond, desc, flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)((cond) ? Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (int64_t)(flop)) : NULL)
+#define SIMD_PERF_IFF(cond, desc, flop) SIMD_PERF_HANDLE(SIMD_CAT(__pmi, __LINE__)); Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)((cond) ? Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_CAT(__pmi, __LINE__), desc, (int64_t)(flop)) : NULL)
 #define SIMD_PERF_IF(cond, desc) SIMD_PERF_IFF(cond, desc, 0)
 #define SIMD_PERF_END(desc) Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc)->Leave();
-#define SIMD_PERF_INITF(name, desc, flop) Simd::Base::PerformanceMeasurerHolder name(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (int64_t)(flop)), false);
+#define SIMD_PERF_INITF(name, desc, flop) SIMD_PERF_HANDLE(SIMD_CAT(name, _handle)); Simd::Base::PerformanceMeasurerHolder name(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_CAT(name, _handle), desc, (int64_t)(flop)), false);
 #define SIMD_PERF_INIT(name, desc)  SIMD_PERF_INITF(name, desc, 0);
 #define SIMD_PERF_START(name) name.Enter(); 
 #define SIMD_PERF_PAUSE(name) name.Leave(true);
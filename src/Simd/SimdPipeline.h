@@ -0,0 +1,104 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdPipeline_h__
+#define __SimdPipeline_h__
+
+#include "Simd/SimdMemory.h"
+
+namespace Simd
+{
+    struct PipelineStage
+    {
+        size_t srcW, srcH, srcPixel, dstW, dstH, dstPixel, rowAlign;
+
+        PipelineStage(size_t sw, size_t sh, size_t sp, size_t dw, size_t dh, size_t dp)
+            : srcW(sw), srcH(sh), srcPixel(sp), dstW(dw), dstH(dh), dstPixel(dp), rowAlign(1)
+        {
+        }
+
+        virtual ~PipelineStage()
+        {
+        }
+
+        virtual void Source(size_t beg, size_t end, size_t & srcBeg, size_t & srcEnd) const
+        {
+            srcBeg = beg;
+            srcEnd = end;
+        }
+
+        virtual uint8_t * DstRow(uint8_t * dst, size_t dstStride, size_t row) const
+        {
+            return dst + row * dstStride;
+        }
+
+        virtual bool Final() const
+        {
+            return false;
+        }
+
+        virtual void Run(const uint8_t * const * src, const size_t * srcStride, size_t srcBeg, size_t srcEnd,
+            uint8_t * dst, size_t dstStride, size_t beg, size_t end) const = 0;
+    };
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        class Pipeline : public Deletable
+        {
+        public:
+            Pipeline(size_t width, size_t height, SimdPixelFormatType format);
+
+            ~Pipeline();
+
+            bool AddConvert(SimdPixelFormatType format);
+
+            bool AddResize(size_t width, size_t height);
+
+            bool AddGaussianBlur3x3();
+
+            bool AddSobelAbs(bool dx);
+
+            bool AddBinarization(uint8_t value, uint8_t positive, uint8_t negative, SimdCompareType compareType);
+
+            bool AddSetInput(const float * lower, const float * upper, size_t channels, SimdTensorFormatType format);
+
+            void Run(const uint8_t * const * src, const size_t * srcStride, uint8_t * dst, size_t dstStride) const;
+
+        private:
+            size_t _width, _height, _planes;
+            SimdPixelFormatType _format;
+            std::vector<PipelineStage*> _stages;
+            Deletable _serial;
+
+            bool Add(PipelineStage * stage);
+            size_t StripRows() const;
+            void RunStrip(const uint8_t * const * src, const size_t * srcStride, uint8_t * dst, size_t dstStride, size_t beg, size_t end) const;
+        };
+
+        void * PipelineInit(size_t width, size_t height, SimdPixelFormatType format);
+    }
+}
+
+#endif
@@ -100,6 +100,12 @@ namespace Simd
             return _candidates[index].func;
         }
 
+        SIMD_INLINE void Select(size_t index)
+        {
+            assert(index < _candidates.size());
+            _best = &_candidates[index].func;
+        }
+
     private:
         static const size_t TEST_COUNT = 3 + 2;
 
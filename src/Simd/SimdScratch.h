@@ -0,0 +1,165 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdScratch_h__
+#define __SimdScratch_h__
+
+#include "Simd/SimdMemory.h"
+
+namespace Simd
+{
+    class ScratchArena
+    {
+    public:
+        ScratchArena()
+            : _block(0)
+            , _offset(0)
+        {
+        }
+
+        ~ScratchArena()
+        {
+            for (size_t i = 0; i < _blocks.size(); ++i)
+                Free(_blocks[i].data);
+        }
+
+        SIMD_INLINE size_t Mark() const
+        {
+            size_t mark = _offset;
+            for (size_t i = 0; i < _block; ++i)
+                mark += _blocks[i].size;
+            return mark;
+        }
+
+        void Reset(size_t mark)
+        {
+            if (mark == 0 && _blocks.size() > 1)
+            {
+                size_t total = 0;
+                for (size_t i = 0; i < _blocks.size(); ++i)
+                {
+                    total += _blocks[i].size;
+                    Free(_blocks[i].data);
+                }
+                _blocks.assign(1, Block(total));
+            }
+            _block = 0;
+            while (_block + 1 < _blocks.size() && mark > _blocks[_block].size)
+                mark -= _blocks[_block++].size;
+            _offset = mark;
+        }
+
+        void * Allocate(size_t size, size_t align = SIMD_ALIGN)
+        {
+            if (_block < _blocks.size())
+            {
+                Block & block = _blocks[_block];
+                size_t offset = (uint8_t*)AlignHi(block.data + _offset, align) - block.data;
+                if (offset + size <= block.size)
+                {
+                    _offset = offset + size;
+                    return block.data + offset;
+                }
+                _offset = block.size;
+            }
+            if (_block + 1 < _blocks.size() && size + align <= _blocks[_block + 1].size)
+                _block++;
+            else
+            {
+                size_t total = 0;
+                for (size_t i = 0; i < _blocks.size(); ++i)
+                    total += _blocks[i].size;
+                while (_blocks.size() > _block + 1)
+                {
+                    Free(_blocks.back().data);
+                    _blocks.pop_back();
+                }
+                _blocks.push_back(Block(Max(AlignHi(size + align, BLOCK_MIN), total)));
+                _block = _blocks.size() - 1;
+            }
+            Block & block = _blocks[_block];
+            uint8_t * ptr = (uint8_t*)AlignHi(block.data, align);
+            _offset = ptr - block.data + size;
+            return ptr;
+        }
+
+        size_t Capacity() const
+        {
+            size_t capacity = 0;
+            for (size_t i = 0; i < _blocks.size(); ++i)
+                capacity += _blocks[i].size;
+            return capacity;
+        }
+
+        static SIMD_INLINE ScratchArena & Thread()
+        {
+            static thread_local ScratchArena arena;
+            return arena;
+        }
+
+    private:
+        static const size_t BLOCK_MIN = 0x10000;
+
+        struct Block
+        {
+            uint8_t * data;
+            size_t size;
+
+            Block(size_t s) : data((uint8_t*)Simd::Allocate(s, SIMD_ALIGN)), size(s) {}
+        };
+
+        std::vector<Block> _blocks;
+        size_t _block, _offset;
+    };
+
+    //---------------------------------------------------------------------------------------------
+
+    class Scratch
+    {
+    public:
+        SIMD_INLINE Scratch()
+            : _arena(ScratchArena::Thread())
+            , _mark(_arena.Mark())
+        {
+        }
+
+        SIMD_INLINE ~Scratch()
+        {
+            _arena.Reset(_mark);
+        }
+
+        template<class T> SIMD_INLINE T * Allocate(size_t count, size_t align = SIMD_ALIGN)
+        {
+            return (T*)_arena.Allocate(count * sizeof(T), align);
+        }
+
+    private:
+        Scratch(const Scratch &);
+        Scratch & operator = (const Scratch &);
+
+        ScratchArena & _arena;
+        size_t _mark;
+    };
+}
+
+#endif
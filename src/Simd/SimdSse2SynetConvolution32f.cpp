@@ -577,16 +577,19 @@ namespace Simd
         {
             for (size_t b = 0; b < _batch; ++b)
             {
-                if (_bias)
+                Base::SynetParallel(_count, 1, 2.0 * _count * _size, [&](size_t, size_t beg, size_t end)
                 {
-                    for (size_t i = 0; i < _count; ++i)
-                        dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size) + _bias[i];
-                }
-                else
-                {
-                    for (size_t i = 0; i < _count; ++i)
-                        dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size);
-                }
+                    if (_bias)
+                    {
+                        for (size_t i = beg; i < end; ++i)
+                            dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size) + _bias[i];
+                    }
+                    else
+                    {
+                        for (size_t i = beg; i < end; ++i)
+                            dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size);
+                    }
+                });
                 if (_param.activation)
                     ConvolutionBiasAndActivation(NULL, _count, 1, _param.activation, _params, ::SimdFalse, dst);
                 src += _sizeS;
@@ -660,6 +663,22 @@ namespace Simd
                 return new Base::SynetConvolution32fBf16Gemm(param);
                 //return new SynetConvolution32fGemmNN(param);
             }
+            else if (Base::SynetTuning())
+            {
+                Base::SynetConvolution32fCreatePtrs candidates;
+                if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+                    candidates.push_back(Base::SynetConvolution32fCreate<SynetConvolution32fDepthwiseDotProduct>);
+                if (SynetConvolution32fWinograd::Preferable(param))
+                    candidates.push_back(Base::SynetConvolution32fCreate<SynetConvolution32fWinograd>);
+                if (SynetConvolution32fDirectNchw::Preferable(param))
+                    candidates.push_back(Base::SynetConvolution32fCreate<SynetConvolution32fDirectNchw>);
+                if (SynetConvolution32fNhwcDirect::Preferable(param))
+                    candidates.push_back(Base::SynetConvolution32fCreate<SynetConvolution32fNhwcDirect>);
+                if (SynetConvolution32fDirectNhwc::Preferable(param))
+                    candidates.push_back(Base::SynetConvolution32fCreate<SynetConvolution32fDirectNhwc>);
+                candidates.push_back(Base::SynetConvolution32fCreate<SynetConvolution32fGemmNN>);
+                return Base::SynetConvolution32fTune(param, candidates);
+            }
             else if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
                 return new SynetConvolution32fDepthwiseDotProduct(param);
             else if (SynetConvolution32fWinograd::Preferable(param))
@@ -25,6 +25,9 @@
 #define __SimdSynet_h__
 
 #include "Simd/SimdMath.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -116,6 +119,51 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        const double SYNET_THREAD_FLOP_MIN = 1024.0 * 1024.0;
+
+        SIMD_INLINE size_t SynetThreadNumber(size_t size, double flop)
+        {
+            size_t number = Simd::Min(Base::GetThreadNumber(), size);
+            return Simd::Max<size_t>(Simd::Min(number, size_t(flop / SYNET_THREAD_FLOP_MIN)), 1);
+        }
+
+        SIMD_INLINE size_t SynetStripe(size_t stripe, size_t number, size_t size, size_t align)
+        {
+            return stripe < number ? AlignLoAny(size * stripe / number, align) : size;
+        }
+
+        // Stripe 0 always runs on the calling thread, so it may use buffers passed by the caller.
+        template<class Function> SIMD_INLINE void SynetParallel(size_t size, size_t align, double flop, const Function & function)
+        {
+            size_t number = SynetThreadNumber(DivHi(size, align), flop);
+            if (number > 1)
+            {
+                Simd::Parallel(0, number, [&](size_t, size_t begin, size_t end)
+                {
+                    for (size_t stripe = begin; stripe < end; ++stripe)
+                    {
+                        size_t first = SynetStripe(stripe, number, size, align), last = SynetStripe(stripe + 1, number, size, align);
+                        if (first < last)
+                            function(stripe, first, last);
+                    }
+                }, number);
+            }
+            else
+                function(0, 0, size);
+        }
+
+        SIMD_INLINE size_t SynetSrcRowBeg(const SimdConvolutionParameters& p, size_t dy)
+        {
+            return Simd::Min<size_t>(dy * p.strideY > p.padY ? dy * p.strideY - p.padY : 0, p.srcH);
+        }
+
+        SIMD_INLINE size_t SynetSrcRowEnd(const SimdConvolutionParameters& p, size_t dy)
+        {
+            return dy ? Simd::Min<size_t>((dy - 1) * p.strideY + (p.kernelY - 1) * p.dilationY + 1 - p.padY, p.srcH) : 0;
+        }
+
+        //---------------------------------------------------------------------
+
         SIMD_INLINE uint8_t SynetConvert32fTo8u(float value, float scale, float shift, int lower, int upper)
         {
             return (uint8_t)Simd::RestrictRange(Round(value * scale + shift), lower, upper);
@@ -25,9 +25,13 @@
 #define __SimdSynetConvolution32f_h__
 
 #include "Simd/SimdArray.h"
+#include "Simd/SimdSynetPacked.h"
+#include "Simd/SimdScratch.h"
+#include "Simd/SimdSynet.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetTuning.h"
 
 #ifdef _N
 #undef _N
@@ -206,6 +210,11 @@ namespace Simd
         {
             return int64_t(batch) * kernelY * kernelX * srcC * dstH * dstW * dstC / group * 2;
         } 
+
+        SIMD_INLINE int64_t Bytes() const
+        {
+            return (int64_t(batch) * (srcC * srcH * srcW + dstC * dstH * dstW) + kernelY * kernelX * srcC / group * dstC) * sizeof(float);
+        }
     };
 
     //---------------------------------------------------------------------------------------------
@@ -220,6 +229,7 @@ namespace Simd
             , _nhwcRun(0)
             , _nhwcReorderB(0)
             , _biasAndActivation(0)
+            , _packedImport(false)
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
             , _perf(NULL)
 #endif
@@ -241,7 +251,7 @@ namespace Simd
 
         virtual size_t InternalBufferSize() const
         {
-            return _buffer.size + _nhwcWeight.size;
+            return _nhwcWeight.size;
         }
 
         virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
@@ -254,16 +264,22 @@ namespace Simd
         }
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
+        virtual bool ForwardAdd(const float * src, float * buf, float * dst);
 
-        float * Buffer(float * buffer)
+        virtual size_t Variants() const
         {
-            if (buffer)
-                return buffer;
-            else
-            {
-                _buffer.Resize(ExternalBufferSize());
-                return _buffer.data;
-            }
+            return Simd::Max<size_t>(_gemmCb.Size(), 1);
+        }
+
+        virtual void SetVariant(size_t variant)
+        {
+            if (_gemmCb.Size())
+                _gemmCb.Select(variant);
+        }
+
+        float * Buffer(float * buffer, Scratch & scratch)
+        {
+            return buffer ? buffer : scratch.Allocate<float>(ExternalBufferSize());
         }
 
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
@@ -276,13 +292,18 @@ namespace Simd
             return _info.c_str();
         }
 
+        virtual size_t Export(void * data, size_t size) const;
+        bool Import(const void * data, size_t size, const float * weight, SimdBool * internal, const float * bias, const float * params);
+
     protected:
+        virtual String PackedTag() const;
+        virtual void Packed(SynetPackedBlocks & blocks) const;
+
         typedef void(*NhwcReorderB)(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
         typedef void(*NhwcRun)(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, GemmKernelType type, bool compatibility);
         typedef void(*BiasAndActivation)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
 
         ConvParam32f _param;
-        Array32f _buffer;
         float _0, _1;
         const float * _weight, * _bias, * _params;
         RuntimeGemm _gemm;
@@ -291,12 +312,65 @@ namespace Simd
         NhwcRun _nhwcRun;
         NhwcReorderB _nhwcReorderB;
         BiasAndActivation _biasAndActivation;
+        bool _packedImport;
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer * _perf;
 #endif
         mutable String _info;
     };
 
+    class SynetConvolution32fShared : public SynetConvolution32f
+    {
+    public:
+        SynetConvolution32fShared(SynetConvolution32f * origin)
+            : SynetConvolution32f(origin->Param())
+            , _origin(origin)
+        {
+            _origin->Retain();
+        }
+
+        virtual ~SynetConvolution32fShared()
+        {
+            _origin->Release();
+        }
+
+        virtual String Ext() const { return _origin->Ext(); }
+        virtual String Desc() const { return _origin->Desc(); }
+
+        virtual size_t ExternalBufferSize() const
+        {
+            return _origin->ExternalBufferSize();
+        }
+
+        virtual size_t InternalBufferSize() const
+        {
+            return 0;
+        }
+
+        virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
+        {
+            assert(0);
+        }
+
+        virtual void Forward(const float * src, float * buf, float * dst)
+        {
+            _origin->Forward(src, buf, dst);
+        }
+
+        virtual bool ForwardAdd(const float * src, float * buf, float * dst)
+        {
+            return _origin->ForwardAdd(src, buf, dst);
+        }
+
+        virtual size_t Export(void * data, size_t size) const
+        {
+            return _origin->Export(data, size);
+        }
+
+    private:
+        SynetConvolution32f * _origin;
+    };
+
     //---------------------------------------------------------------------------------------------
 
     namespace Base
@@ -312,11 +386,13 @@ namespace Simd
             virtual size_t ExternalBufferSize() const;
             virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
             virtual void Forward(const float * src, float * buf, float * dst);
+            virtual bool ForwardAdd(const float * src, float * buf, float * dst);
 
         protected:
             virtual void ImgToCol(const float * src, float * dst);
             virtual void ImgToRow(const float * src, float * dst);
             bool GemmRuntime() const;
+            void Forward(const float * src, float * buf, float * dst, const float * beta);
 
             bool _skipConv;
             size_t _M, _N, _K, _ldW, _ldS, _ldD, _grW, _grS, _grD, _batch, _sizeS, _sizeB, _sizeD, _merge;
@@ -353,6 +429,9 @@ namespace Simd
             static bool Preferable(const ConvParam32f & p);
 
         protected:
+            virtual String PackedTag() const;
+            virtual void Packed(SynetPackedBlocks & blocks) const;
+
             typedef void(*SetFilter)(const float * src, size_t size, float * dst, SimdBool trans);
             typedef void(*SetInput)(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth, size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
             typedef void(*SetOutput)(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
@@ -436,6 +515,9 @@ namespace Simd
             virtual size_t InternalBufferSize() const;
             virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
             virtual void Forward(const float * src, float * buf, float * dst);
+            virtual bool ForwardAdd(const float * src, float * buf, float * dst);
+            virtual size_t Variants() const;
+            virtual void SetVariant(size_t variant);
 
             static bool Preferable(const ConvParam32f & p);
 
@@ -454,16 +536,20 @@ namespace Simd
             typedef void(*OldConvolutionPtr)(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst);
 
         protected:
+            virtual String PackedTag() const;
+            virtual void Packed(SynetPackedBlocks & blocks) const;
+
             size_t _sizeS, _sizeD;
             Array32f _rWeight, _rBias, _rParams;
 
-            static void Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst);
+            static void Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst, int add);
+            static void Forward(const float* src, const ConvParam32f& p, const AlgParam& a, size_t dyBeg, size_t dyEnd, const float* weight, const float* bias, const float* params, float* dst, int add);
 
             struct RunArgs
             {
-                const float* src; const ConvParam32f& p; const float* weight; const float* bias; const float* params; float* dst;
-                SIMD_INLINE RunArgs(const float* src_, const ConvParam32f& p_, const float* weight_, const float* bias_, const float* params_, float* dst_)
-                    :src(src_), p(p_), weight(weight_), bias(bias_), params(params_), dst(dst_)
+                const float* src; const ConvParam32f& p; const float* weight; const float* bias; const float* params; float* dst; int add;
+                SIMD_INLINE RunArgs(const float* src_, const ConvParam32f& p_, const float* weight_, const float* bias_, const float* params_, float* dst_, int add_)
+                    :src(src_), p(p_), weight(weight_), bias(bias_), params(params_), dst(dst_), add(add_)
                 {}
             };
 
@@ -478,7 +564,7 @@ namespace Simd
 
                 SIMD_INLINE void Run(const RunArgs& args)
                 {
-                    Forward(args.src, args.p, alg, args.weight, args.bias, args.params, args.dst);
+                    Forward(args.src, args.p, alg, args.weight, args.bias, args.params, args.dst, args.add);
                 }
 
 #ifdef SIMD_RUNTIME_STATISTIC
@@ -525,6 +611,8 @@ namespace Simd
             virtual void Forward(const float* src, float* buf, float* dst);
 
         protected:
+            virtual void Packed(SynetPackedBlocks & blocks) const;
+
             void ImgToCol(const float* src, uint16_t* dst);
             void ImgToRow(const float* src, uint16_t* dst);
             void GemmNN(size_t M, size_t N, size_t K, const uint16_t* A, size_t lda, const uint16_t* B, size_t ldb, float* C, size_t ldc);
@@ -559,12 +647,15 @@ namespace Simd
                 size_t srcC, int zero, const uint16_t* weight, const float* bias, const float* params, float* dst);
 
         protected:
+            virtual String PackedTag() const;
+            virtual void Packed(SynetPackedBlocks & blocks) const;
+
             void SetAlgParam(size_t microD, size_t microHW, size_t microC, size_t L1, size_t L2, size_t L3);
             void SetWeight(const float* weight);
             void SetBias(const float* bias);
             void SetParams(const float* params);
-            void ForwardConv(const float* src, uint16_t* buf, float* dst);
-            void ForwardGemm(const float* src, uint16_t* buf, float* dst);
+            void ForwardConv(const float* src, uint16_t* buf, float* dst, size_t dyBeg, size_t dyEnd);
+            void ForwardGemm(const float* src, uint16_t* buf, float* dst, size_t dyBeg, size_t dyEnd);
             size_t Offset(size_t yBeg, size_t cBeg, size_t cEnd);
 
             Array16u _weight;
@@ -576,6 +667,18 @@ namespace Simd
 
         //-----------------------------------------------------------------------------------------
 
+        typedef SynetConvolution32f* (*SynetConvolution32fCreatePtr)(const ConvParam32f& p);
+        typedef std::vector<SynetConvolution32fCreatePtr> SynetConvolution32fCreatePtrs;
+
+        template<class T> SynetConvolution32f* SynetConvolution32fCreate(const ConvParam32f& p)
+        {
+            return new T(p);
+        }
+
+        SynetConvolution32f* SynetConvolution32fTune(const ConvParam32f& p, const SynetConvolution32fCreatePtrs& candidates);
+
+        //-----------------------------------------------------------------------------------------
+
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
     }
 
@@ -25,6 +25,9 @@
 #define __SimdSynetConvolution8i_h__
 
 #include "Simd/SimdArray.h"
+#include "Simd/SimdSynetPacked.h"
+#include "Simd/SimdScratch.h"
+#include "Simd/SimdSynet.h"
 #include "Simd/SimdPerformance.h"
 
 #ifdef _N
@@ -130,6 +133,12 @@ namespace Simd
         {
             return int64_t(batch) * kernelY * kernelX * srcC * dstH * dstW * dstC / group * 2;
         }
+
+        int64_t Bytes() const
+        {
+            size_t srcE = srcT == SimdTensorData8u ? 1 : 4, dstE = dstT == SimdTensorData8u ? 1 : 4;
+            return int64_t(batch) * (srcC * srcH * srcW * srcE + dstC * dstH * dstW * dstE) + kernelY * kernelX * srcC / group * dstC;
+        }
 #endif
     };
 
@@ -180,13 +189,18 @@ namespace Simd
             return _info.c_str();
         }
 
+        virtual size_t Export(void* data, size_t size) const;
+        bool Import(const void* data, size_t size, const float* weight, const float* bias, const float* params, const float* const* stats);
+
     protected:
         virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst) = 0;
 
+        virtual String PackedTag() const;
+        virtual void Packed(SynetPackedBlocks& blocks) const;
+
         typedef void(*Convert32fTo8u)(const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility);
 
         ConvParam8i _param;
-        Array8u _buffer;
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer * _perf;
 #endif
@@ -195,10 +209,66 @@ namespace Simd
         CvtParam _srcCvt, _dstCvt;
         Array8i _weight;
         Array32f _norm, _bias, _params; 
-        bool _src8u, _dst8u;
+        bool _src8u, _dst8u, _packedImport;
         size_t _merge, _sizeS, _sizeD;
     };
 
+    class SynetConvolution8iShared : public SynetConvolution8i
+    {
+    public:
+        SynetConvolution8iShared(SynetConvolution8i* origin)
+            : SynetConvolution8i(origin->Param())
+            , _origin(origin)
+        {
+            _origin->Retain();
+            _weight.Resize(0);
+            _norm.Resize(0);
+            _bias.Resize(0);
+        }
+
+        virtual ~SynetConvolution8iShared()
+        {
+            _origin->Release();
+        }
+
+        virtual String Ext() const { return _origin->Ext(); }
+        virtual String Desc() const { return _origin->Desc(); }
+
+        virtual size_t ExternalBufferSize() const
+        {
+            return _origin->ExternalBufferSize();
+        }
+
+        virtual size_t InternalBufferSize() const
+        {
+            return 0;
+        }
+
+        virtual void SetParams(const float* weight, const float* bias, const float* params, const float* const* stats)
+        {
+            assert(0);
+        }
+
+        virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        {
+            _origin->Forward(src, buf, dst);
+        }
+
+        virtual size_t Export(void* data, size_t size) const
+        {
+            return _origin->Export(data, size);
+        }
+
+    protected:
+        virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        {
+            assert(0);
+        }
+
+    private:
+        SynetConvolution8i* _origin;
+    };
+
     namespace Base
     {
         class SynetConvolution8iGemmNN : public SynetConvolution8i
@@ -238,6 +308,8 @@ namespace Simd
                 const int8_t* weight, const float* norm, const float* bias, const float* params, const float* scale, const float* shift, int32_t* buf, uint8_t* dst, int first);
 
         protected:
+            virtual String PackedTag() const;
+
             void SetAlgParam(size_t F, size_t microD, size_t L1, size_t L2, size_t L3, size_t microC);
             void ReorderWeight();
             bool PadEnable(size_t microC);
@@ -245,6 +317,7 @@ namespace Simd
 
             virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst);
             void Forward8u(const uint8_t* src, const ConvParam8i & p, int32_t* buf, uint8_t* dst);
+            void Forward8u(const uint8_t* src, const ConvParam8i & p, size_t dyBeg, size_t dyEnd, int32_t* buf, uint8_t* dst);
 
             AlgParam _alg;
             size_t _sizeP;
@@ -267,8 +340,8 @@ namespace Simd
                 int32_t zero, size, upper;
             };
 
-            typedef void(*ConvolutionPtr)(const uint8_t* src, const ConvParam8i& p, const AlgParam& a, const int8_t* weight, 
-                const float* norm, const float* bias, const float* params, const float* scale, const float* shift, uint8_t* dst);
+            typedef void(*ConvolutionPtr)(const uint8_t* src, const ConvParam8i& p, const AlgParam& a, size_t dyBeg, size_t dyEnd, 
+                const int8_t* weight, const float* norm, const float* bias, const float* params, const float* scale, const float* shift, uint8_t* dst);
 
         protected:
 
@@ -25,6 +25,7 @@
 #define __SimdSynetDeconvolution32f_h__
 
 #include "Simd/SimdArray.h"
+#include "Simd/SimdScratch.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdGemm.h"
@@ -101,6 +102,11 @@ namespace Simd
         {
             return int64_t(batch) * kernelY * kernelX * srcC * srcH * srcW * dstC / group * 2;
         }
+
+        int64_t Bytes() const
+        {
+            return (int64_t(batch) * (srcC * srcH * srcW + dstC * dstH * dstW) + kernelY * kernelX * srcC / group * dstC) * sizeof(float);
+        }
 #endif
     };
 
@@ -135,7 +141,7 @@ namespace Simd
 
         virtual size_t InternalBufferSize() const
         {
-            return _buffer.size + _nhwcWeight.size + _weightT.size;
+            return _nhwcWeight.size + _weightT.size;
         }
 
         virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
@@ -149,15 +155,9 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
-        float * Buffer(float * buffer)
+        float * Buffer(float * buffer, Scratch & scratch)
         {
-            if (buffer)
-                return buffer;
-            else
-            {
-                _buffer.Resize(ExternalBufferSize());
-                return _buffer.data;
-            }
+            return buffer ? buffer : scratch.Allocate<float>(ExternalBufferSize());
         }
 
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
@@ -176,7 +176,6 @@ namespace Simd
         typedef void(*BiasAndActivation)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
 
         DeconvParam32f _param;
-        Array32f _buffer;
         float _0, _1;
         const float * _weight, * _bias, * _params;
         RuntimeGemm _gemm;
@@ -65,6 +65,11 @@ namespace Simd
         {
             return int64_t(batch) * input * output * 2;
         }
+
+        int64_t Bytes() const
+        {
+            return (int64_t(batch) * (input + output) + int64_t(input) * output) * sizeof(float);
+        }
 #endif
     };
 
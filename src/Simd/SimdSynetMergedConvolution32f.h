@@ -135,6 +135,15 @@ namespace Simd
                 flop += Flop(i);
             return flop;
         }
+
+        int64_t Bytes() const
+        {
+            const ConvParam32f & src = conv[0], & dst = conv[count - 1];
+            int64_t bytes = int64_t(src.batch) * (src.srcC * src.srcH * src.srcW + dst.dstC * dst.dstH * dst.dstW);
+            for (size_t i = 0; i < count; ++i)
+                bytes += conv[i].kernelY * conv[i].kernelX * conv[i].srcC / conv[i].group * conv[i].dstC;
+            return bytes * sizeof(float);
+        }
 #endif
     };
 
@@ -166,7 +175,7 @@ namespace Simd
         virtual Base::PerformanceMeasurer* Perf(const char* func)
         {
             if (_perf == NULL)
-                _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
+                _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop(), Param().Bytes());
             return _perf;
         }
 #endif
@@ -183,17 +192,21 @@ namespace Simd
 
     protected:
         MergConvParam32f _param;
-        Array32f _buffer;
 
-        float* Buffer(float* buffer)
+        float* Buffer(float* buffer, Scratch& scratch)
         {
-            if (buffer)
-                return buffer;
-            else
+            return buffer ? buffer : scratch.Allocate<float>(ExternalBufferSize());
+        }
+
+        double Flop() const
+        {
+            double flop = 0;
+            for (size_t i = 0; i < _param.count; ++i)
             {
-                _buffer.Resize(ExternalBufferSize());
-                return _buffer.data;
+                const ConvParam32f& c = _param.conv[i];
+                flop += 2.0 * c.batch * c.dstC * c.dstH * c.dstW * c.kernelY * c.kernelX * c.srcC / c.group;
             }
+            return flop;
         }
 
     private:
@@ -25,6 +25,7 @@
 #define __SimdSynetMergedConvolution8i_h__
 
 #include "Simd/SimdArray.h"
+#include "Simd/SimdScratch.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdSynetConvolution8i.h"
@@ -120,6 +121,16 @@ namespace Simd
                 flop += conv[i].Flop();
             return flop;
         }
+
+        int64_t Bytes() const
+        {
+            const ConvParam8i & src = conv[0], & dst = conv[count - 1];
+            int64_t bytes = int64_t(src.batch) * (src.srcC * src.srcH * src.srcW * (src.srcT == SimdTensorData8u ? 1 : 4) + 
+                dst.dstC * dst.dstH * dst.dstW * (dst.dstT == SimdTensorData8u ? 1 : 4));
+            for (size_t i = 0; i < count; ++i)
+                bytes += conv[i].kernelY * conv[i].kernelX * conv[i].srcC / conv[i].group * conv[i].dstC;
+            return bytes;
+        }
 #endif
     };
 
@@ -190,7 +201,9 @@ namespace Simd
                 const int8_t* weight, const float* norm, const float* bias, const float* params, const float* scale, const float* shift, int32_t* buf, uint8_t* dst, int first);
 
         protected:
-            uint8_t* GetBuffer(uint8_t* buffer);
+            uint8_t* GetBuffer(uint8_t* buffer, Scratch& scratch);
+            uint8_t* GetStripeBuffer(Scratch& scratch);
+            double Flop() const;
             void Quantize(const float* weight, const float* bias, size_t i, size_t q);
             void ReorderInputWeight(const ConvParam8i& p, Array8i & weight);
             void ReorderDepthwiseWeight(const ConvParam8i& p, Array32f & weight);
@@ -201,7 +214,6 @@ namespace Simd
             bool _s8u, _d8u, _dw0, _1x1;
             size_t _sizeS, _sizeD, _sizeI[2], _sizeB[5];
             CvtParam _cvt[3];
-            Array8u _buffer;
             Array8i _weight8i[2];
             Array32f _weight32f, _norm[2], _bias[3], _params[3];
             AlgParam _alg;
@@ -0,0 +1,57 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetPacked_h__
+#define __SimdSynetPacked_h__
+
+#include "Simd/SimdDefs.h"
+
+#include <string>
+#include <vector>
+
+namespace Simd
+{
+    struct SynetPackedBlock
+    {
+        void * data;
+        size_t size;
+
+        SynetPackedBlock(void * d = NULL, size_t s = 0) : data(d), size(s) {}
+    };
+    typedef std::vector<SynetPackedBlock> SynetPackedBlocks;
+
+    namespace Base
+    {
+        uint64_t SynetPackedHash(const void * data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL);
+
+        std::string SynetPackedTag(const SimdConvolutionParameters & conv, size_t batch, int compatibility, const std::string & desc, const std::string & blocking);
+
+        size_t SynetPackedExport(const std::string & tag, const SynetPackedBlocks & blocks, void * data, size_t size);
+
+        bool SynetPackedMatch(const std::string & tag, const void * data, size_t size);
+
+        bool SynetPackedImport(const void * data, size_t size, const SynetPackedBlocks & blocks);
+    }
+}
+
+#endif//__SimdSynetPacked_h__
@@ -0,0 +1,62 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetPlanner_h__
+#define __SimdSynetPlanner_h__
+
+#include "Simd/SimdMemory.h"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        class SynetPlanner : public Deletable
+        {
+        public:
+            SynetPlanner();
+
+            size_t AddTensor(size_t size);
+            size_t AddLayer(size_t buffer, const size_t * src, size_t srcCount, const size_t * dst, size_t dstCount);
+            size_t Plan();
+
+            size_t TensorOffset(size_t tensor) const;
+            size_t BufferOffset(size_t layer) const;
+
+        private:
+            struct Block
+            {
+                size_t size, first, last, offset;
+                bool produced, consumed;
+
+                Block(size_t s) : size(s), first(SIZE_MAX), last(0), offset(0), produced(false), consumed(false) {}
+            };
+            std::vector<Block> _tensors, _buffers;
+            size_t _total;
+            bool _planned;
+        };
+    }
+}
+
+#endif//__SimdSynetPlanner_h__
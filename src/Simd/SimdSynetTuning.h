@@ -0,0 +1,51 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetTuning_h__
+#define __SimdSynetTuning_h__
+
+#include "Simd/SimdDefs.h"
+
+#include <string>
+#include <atomic>
+
+namespace Simd
+{
+    namespace Base
+    {
+        extern std::atomic<bool> g_synetTuning;
+
+        SIMD_INLINE bool SynetTuning()
+        {
+            return g_synetTuning.load(std::memory_order_relaxed);
+        }
+
+        void SynetSetTuning(SimdBool enable, const char * path);
+
+        bool SynetTuningGet(const std::string & key, std::string & value);
+
+        void SynetTuningSet(const std::string & key, const std::string & value);
+    }
+}
+
+#endif//__SimdSynetTuning_h__
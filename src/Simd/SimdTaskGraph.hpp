@@ -0,0 +1,221 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdTaskGraph_hpp__
+#define __SimdTaskGraph_hpp__
+
+#include "Simd/SimdLib.h"
+
+#include <vector>
+#include <memory>
+#include <functional>
+#include <exception>
+#include <stdexcept>
+
+namespace Simd
+{
+    /*! @ingroup cpp_task_graph
+
+        \short TaskGraph class provides asynchronous execution of tasks with dependencies by worker threads of Simd Library.
+
+        Using example (JPEG encoding of previous frame is overlapped with detection on the current frame):
+        \verbatim
+        #include "Simd/SimdTaskGraph.hpp"
+
+        Simd::TaskGraph graph;
+        Simd::TaskGraph::Future encoded;
+        for (size_t i = 0; i < frames.size(); ++i)
+        {
+            Simd::TaskGraph::Future motion = graph.Submit([&, i]() { detector.NextFrame(frames[i], metadata[i]); });
+            Simd::TaskGraph::Future detected = graph.Submit([&, i]() { detection.Detect(frames[i].planes[0], objects[i]); }, { motion });
+            if (i)
+                encoded = graph.Submit([&, i]() { frames[i - 1].planes[0].Save(paths[i - 1], SimdImageFileJpeg, 85); });
+            detected.Wait();
+            encoded.Wait();
+        }
+        \endverbatim
+
+        \note This class is a wrapper around functions ::SimdTaskGraphInit, ::SimdTaskGraphSubmit, ::SimdTaskGraphWait and ::SimdTaskGraphWaitAll.
+    */
+    class TaskGraph
+    {
+        struct State
+        {
+            std::function<void()> function;
+            std::exception_ptr error;
+            std::vector<std::shared_ptr<State>> deps;
+            bool skipped;
+
+            State() : skipped(false) {}
+        };
+
+    public:
+        /*!
+            \short Future is a handle of task submitted to TaskGraph.
+        */
+        class Future
+        {
+        public:
+            /*!
+                Creates a new empty Future structure.
+            */
+            Future()
+                : _graph(NULL)
+                , _id(0)
+            {
+            }
+
+            /*!
+                Checks that the Future refers to submitted task.
+
+                \return a result of the check.
+            */
+            bool Valid() const
+            {
+                return _id != 0;
+            }
+
+            /*!
+                Waits for finish of the task. If the task (or one of its dependencies) has thrown an exception then the exception is rethrown.
+                Empty Future is ignored.
+            */
+            void Wait() const
+            {
+                if (_id == 0)
+                    return;
+                SimdTaskGraphWait(_graph, _id);
+                Rethrow(*_state);
+            }
+
+        private:
+            void * _graph;
+            size_t _id;
+            std::shared_ptr<State> _state;
+
+            friend class TaskGraph;
+        };
+
+        /*!
+            Creates a new TaskGraph.
+        */
+        TaskGraph()
+            : _graph(SimdTaskGraphInit())
+        {
+        }
+
+        /*!
+            Waits for all submitted tasks and releases TaskGraph.
+        */
+        ~TaskGraph()
+        {
+            SimdRelease(_graph);
+        }
+
+        /*!
+            Submits a task to TaskGraph. The task is started after all its dependencies are finished.
+            If any dependency has failed then the task is skipped.
+
+            \param [in] function - a function object (without parameters) of the task.
+            \param [in] deps - a list of dependencies of the task.
+            \return a Future of the submitted task.
+        */
+        template<class Function> Future Submit(Function function, const std::vector<Future> & deps = std::vector<Future>())
+        {
+            Future future;
+            future._graph = _graph;
+            future._state = std::make_shared<State>();
+            future._state->function = function;
+            std::vector<size_t> ids;
+            for (size_t i = 0; i < deps.size(); ++i)
+            {
+                if (deps[i].Valid())
+                {
+                    ids.push_back(deps[i]._id);
+                    future._state->deps.push_back(deps[i]._state);
+                }
+            }
+            std::shared_ptr<State> * context = new std::shared_ptr<State>(future._state);
+            future._id = SimdTaskGraphSubmit(_graph, Execute, context, ids.empty() ? NULL : ids.data(), ids.size());
+            if (future._id == 0)
+            {
+                delete context;
+                throw std::invalid_argument("Simd::TaskGraph: wrong dependencies!");
+            }
+            return future;
+        }
+
+        /*!
+            Waits for all submitted tasks.
+
+            \return false if any task has failed since the previous call of this function.
+        */
+        bool WaitAll()
+        {
+            return SimdTaskGraphWaitAll(_graph) == SimdTrue;
+        }
+
+    private:
+        void * _graph;
+
+        TaskGraph(const TaskGraph &);
+        TaskGraph & operator = (const TaskGraph &);
+
+        static void Execute(void * context, SimdBool skip)
+        {
+            std::shared_ptr<State> state = *(std::shared_ptr<State>*)context;
+            delete (std::shared_ptr<State>*)context;
+            if (skip)
+            {
+                state->skipped = true;
+                state->function = nullptr;
+                return;
+            }
+            state->deps.clear();
+            try
+            {
+                state->function();
+            }
+            catch (...)
+            {
+                state->error = std::current_exception();
+                state->function = nullptr;
+                throw;
+            }
+            state->function = nullptr;
+        }
+
+        static void Rethrow(const State & state)
+        {
+            if (state.error)
+                std::rethrow_exception(state.error);
+            if (state.skipped)
+            {
+                for (size_t i = 0; i < state.deps.size(); ++i)
+                    Rethrow(*state.deps[i]);
+                throw std::runtime_error("Simd::TaskGraph: dependency of the task has failed!");
+            }
+        }
+    };
+}
+
+#endif//__SimdTaskGraph_hpp__
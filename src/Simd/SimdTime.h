@@ -33,6 +33,7 @@
 #include <windows.h>
 #elif defined(__GNUC__)
 #include <sys/time.h>
+#include <time.h>
 #else
 #error Platform is not supported!
 #endif
@@ -71,14 +72,14 @@ namespace Simd
 
     SIMD_INLINE int64_t TimeCounter()
     {
-        timeval t;
-        gettimeofday(&t, NULL);
-        return int64_t(t.tv_sec)*1000000 + t.tv_usec;
+        timespec t;
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        return int64_t(t.tv_sec) * 1000000000 + t.tv_nsec;
     }
 
     SIMD_INLINE int64_t TimeFrequency()
     {
-        return int64_t(1000000);
+        return int64_t(1000000000);
     }
 #else
 #error Platform is not supported!
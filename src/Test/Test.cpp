@@ -316,10 +316,25 @@ namespace Test
     TEST_ADD_GROUP_AD0(NeuralAddConvolution5x5Sum);
     TEST_ADD_GROUP_AD0(NeuralConvolutionForward);
 
+    TEST_ADD_GROUP_A00(MaxIsa);
+    TEST_ADD_GROUP_A00(HugePage);
+    TEST_ADD_GROUP_A00(PoolAllocator);
+
     TEST_ADD_GROUP_AD0(OperationBinary8u);
     TEST_ADD_GROUP_AD0(OperationBinary16i);
     TEST_ADD_GROUP_AD0(VectorProduct);
 
+    TEST_ADD_GROUP_A00(Parallel);
+    TEST_ADD_GROUP_A00(ParallelRows);
+    TEST_ADD_GROUP_A00(ThreadBudget);
+    TEST_ADD_GROUP_A00(ThreadAffinity);
+    TEST_ADD_GROUP_A00(ScratchMemory);
+    TEST_ADD_GROUP_A00(TaskGraph);
+
+    TEST_ADD_GROUP_A00(Pipeline);
+
+    TEST_ADD_GROUP_00S(CacheSweep);
+
     TEST_ADD_GROUP_AD0(ReduceColor2x2);
     TEST_ADD_GROUP_AD0(ReduceGray2x2);
     TEST_ADD_GROUP_AD0(ReduceGray3x3);
@@ -393,6 +408,10 @@ namespace Test
     TEST_ADD_GROUP_A00(SynetConvolution8iForward);
 
     TEST_ADD_GROUP_A00(SynetConvolution32fForward);
+    TEST_ADD_GROUP_A00(SynetConvolution32fTuning);
+    TEST_ADD_GROUP_A00(SynetConvolution32fShare);
+    TEST_ADD_GROUP_A00(SynetConvolution32fExport);
+    TEST_ADD_GROUP_A00(SynetConvolution32fForwardAdd);
 
     TEST_ADD_GROUP_A00(SynetDeconvolution32fForward);
 
@@ -409,6 +428,7 @@ namespace Test
     TEST_ADD_GROUP_A00(SynetInnerProduct8i);
 
     TEST_ADD_GROUP_A00(SynetMergedConvolution8iForward);
+    TEST_ADD_GROUP_A00(SynetPlanner);
 
     TEST_ADD_GROUP_A00(SynetMergedConvolution32fForward);
 
@@ -554,11 +574,13 @@ namespace Test
 
         Strings include, exclude;
 
-        String text, html;
+        String text, html, json, csv, baseline;
+
+        double tolerance;
 
         size_t testThreads, workThreads;
 
-        bool printAlign, printInternal;
+        bool printAlign, printInternal, threadScaling;
 
         Options(int argc, char* argv[])
             : mode(Auto)
@@ -567,6 +589,8 @@ namespace Test
             , workThreads(1)
             , printAlign(false)
             , printInternal(true)
+            , threadScaling(false)
+            , tolerance(0.05)
         {
             for (int i = 1; i < argc; ++i)
             {
@@ -611,6 +635,22 @@ namespace Test
                 {
                     html = arg.substr(4, arg.size() - 4);
                 }
+                else if (arg.find("-oj=") == 0)
+                {
+                    json = arg.substr(4, arg.size() - 4);
+                }
+                else if (arg.find("-oc=") == 0)
+                {
+                    csv = arg.substr(4, arg.size() - 4);
+                }
+                else if (arg.find("-cmp=") == 0)
+                {
+                    baseline = arg.substr(5, arg.size() - 5);
+                }
+                else if (arg.find("-tol=") == 0)
+                {
+                    tolerance = FromString<double>(arg.substr(5, arg.size() - 5));
+                }
                 else if (arg.find("-r=") == 0)
                 {
                     ROOT_PATH = arg.substr(3, arg.size() - 3);
@@ -647,6 +687,10 @@ namespace Test
                 {
                     workThreads = FromString<size_t>(arg.substr(4, arg.size() - 4));
                 }
+                else if (arg.find("-ts=") == 0)
+                {
+                    threadScaling = FromString<bool>(arg.substr(4, arg.size() - 4));
+                }
                 else if (arg.find("-mt=") == 0)
                 {
                     MINIMAL_TEST_EXECUTION_TIME = FromString<int>(arg.substr(4, arg.size() - 4))*0.001;
@@ -686,9 +730,36 @@ namespace Test
         }
     };
 
-    int MakeAutoTests(const Groups & groups, const Options & options)
+    int MakeScalingTests(const Groups & groups, const Options & options)
     {
+        size_t threadMax = options.workThreads > 1 ? options.workThreads : std::thread::hardware_concurrency();
+        threadMax = std::max<size_t>(1, std::min<size_t>(threadMax, std::thread::hardware_concurrency()));
         if (options.testThreads > 0)
+            TEST_LOG_SS(Info, "Test threads count is ignored in thread scaling mode!");
+        for (size_t threads = 1;; threads = std::min(threads * 2, threadMax))
+        {
+            TEST_LOG_SS(Info, "Thread scaling: work threads count = " << threads << std::endl);
+            ::SimdSetThreadNumber(threads);
+            Test::Task task(groups.begin(), groups.end(), false);
+            task.Run();
+            if (Test::Task::s_stopped)
+                return 1;
+            Test::PerformanceMeasurerStorage::s_storage.AddScalingStep(threads);
+            if (threads == threadMax)
+                break;
+        }
+        ::SimdSetThreadNumber(options.workThreads);
+        return 0;
+    }
+
+    int MakeAutoTests(const Groups & groups, const Options & options)
+    {
+        if (options.threadScaling)
+        {
+            if (MakeScalingTests(groups, options))
+                return 1;
+        }
+        else if (options.testThreads > 0)
         {
             TEST_LOG_SS(Info, "Test threads count = " << options.testThreads);
 
@@ -738,6 +809,12 @@ namespace Test
             Test::PerformanceMeasurerStorage::s_storage.TextReport(options.text, options.printAlign);
         if (!options.html.empty())
             Test::PerformanceMeasurerStorage::s_storage.HtmlReport(options.html, options.printAlign);
+        if (!options.json.empty())
+            Test::PerformanceMeasurerStorage::s_storage.JsonReport(options.json);
+        if (!options.csv.empty())
+            Test::PerformanceMeasurerStorage::s_storage.CsvReport(options.csv);
+        if (!options.baseline.empty() && !Test::PerformanceMeasurerStorage::s_storage.CompareWithBaseline(options.baseline, options.tolerance))
+            return 1;
 #endif
         return 0;
     }
@@ -813,11 +890,20 @@ namespace Test
         std::cout << "    -h=1080       a height of test image for performance testing." << std::endl << std::endl;
         std::cout << "    -w=1920       a width of test image for performance testing." << std::endl << std::endl;
         std::cout << "    -oh=log.html  a file name with test report (in HTML format)." << std::endl << std::endl;
+        std::cout << "    -oj=log.json  a file name with test report (in JSON format): timings of every function" << std::endl;
+        std::cout << "                  and instruction set with median and MAD of single runs." << std::endl << std::endl;
+        std::cout << "    -oc=log.csv   a file name with test report (in CSV format)." << std::endl << std::endl;
+        std::cout << "    -cmp=base.json to compare timings with baseline JSON report. Test fails if median time" << std::endl;
+        std::cout << "                  of any function is greater than baseline by tolerance and by noise (3 sigma of MAD)." << std::endl << std::endl;
+        std::cout << "    -tol=0.05     a relative tolerance of comparison with baseline (5% by default)." << std::endl << std::endl;
         std::cout << "    -s=sample.avi a video source (Simd::Motion test)." << std::endl << std::endl;
         std::cout << "    -o=output.avi an annotated video output (Simd::Motion test)." << std::endl << std::endl;
         std::cout << "    -wt=1         a thread number used to parallelize algorithms." << std::endl << std::endl;
         std::cout << "    -fe=Abs       an exclude filter to exclude some tests." << std::endl << std::endl;
         std::cout << "    -mt=100       a minimal test execution time (in milliseconds)." << std::endl << std::endl;
+        std::cout << "    -ts=1         to measure thread scaling: the tests are repeated with work thread number" << std::endl;
+        std::cout << "                  1, 2, 4, ... up to -wt (or hardware concurrency if -wt is not set)." << std::endl;
+        std::cout << "                  The report contains time, throughput, speedup and parallel efficiency." << std::endl << std::endl;
         std::cout << "    -lc=1         to litter CPU cache between test runs." << std::endl << std::endl;
         std::cout << "    -ri=city.jpg  a name of real image used in some tests." << std::endl << std::endl;
         std::cout << "                  The image have to be placed in ./data/image directory." << std::endl << std::endl;
@@ -0,0 +1,259 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestTensor.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTable.h"
+#include "Test/TestString.h"
+#include "Test/TestLog.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct SweepKernel
+        {
+            virtual ~SweepKernel() {}
+            virtual String Name() const = 0;
+            virtual double PixelSize() const = 0;
+            virtual void Init(size_t width, size_t height) = 0;
+            virtual size_t Bytes() const = 0;
+            virtual void Run() = 0;
+        };
+
+        struct SweepBgraToGray : public SweepKernel
+        {
+            View src, dst;
+
+            virtual String Name() const { return "BgraToGray"; }
+            virtual double PixelSize() const { return 5.0; }
+
+            virtual void Init(size_t width, size_t height)
+            {
+                src.Recreate(width, height, View::Bgra32);
+                dst.Recreate(width, height, View::Gray8);
+                FillRandom(src);
+            }
+
+            virtual size_t Bytes() const { return src.DataSize() + dst.DataSize(); }
+
+            virtual void Run()
+            {
+                SimdBgraToGray(src.data, src.width, src.height, src.stride, dst.data, dst.stride);
+            }
+        };
+
+        struct SweepResizerRun : public SweepKernel
+        {
+            View src, dst;
+            void * resizer;
+
+            SweepResizerRun() : resizer(NULL) {}
+            ~SweepResizerRun() { SimdRelease(resizer); }
+
+            virtual String Name() const { return "ResizerRun"; }
+            virtual double PixelSize() const { return 3.75; }
+
+            virtual void Init(size_t width, size_t height)
+            {
+                src.Recreate(width, height, View::Bgr24);
+                dst.Recreate(width / 2, height / 2, View::Bgr24);
+                FillRandom(src);
+                SimdRelease(resizer);
+                resizer = SimdResizerInit(src.width, src.height, dst.width, dst.height, 3, SimdResizeChannelByte, SimdResizeMethodBilinear);
+            }
+
+            virtual size_t Bytes() const { return src.DataSize() + dst.DataSize(); }
+
+            virtual void Run()
+            {
+                SimdResizerRun(resizer, src.data, src.stride, dst.data, dst.stride);
+            }
+        };
+
+        struct SweepIntegral : public SweepKernel
+        {
+            View src, sum;
+
+            virtual String Name() const { return "Integral"; }
+            virtual double PixelSize() const { return 5.0; }
+
+            virtual void Init(size_t width, size_t height)
+            {
+                src.Recreate(width, height, View::Gray8);
+                sum.Recreate(width + 1, height + 1, View::Int32);
+                FillRandom(src);
+            }
+
+            virtual size_t Bytes() const { return src.DataSize() + sum.DataSize(); }
+
+            virtual void Run()
+            {
+                SimdIntegral(src.data, src.stride, src.width, src.height, sum.data, sum.stride, 
+                    NULL, 0, NULL, 0, SimdPixelFormatInt32, SimdPixelFormatInt32);
+            }
+        };
+
+        struct SweepGaussianBlurRun : public SweepKernel
+        {
+            View src, dst;
+            void * filter;
+
+            SweepGaussianBlurRun() : filter(NULL) {}
+            ~SweepGaussianBlurRun() { SimdRelease(filter); }
+
+            virtual String Name() const { return "GaussianBlurRun"; }
+            virtual double PixelSize() const { return 6.0; }
+
+            virtual void Init(size_t width, size_t height)
+            {
+                const float sigma = 1.0f;
+                src.Recreate(width, height, View::Bgr24);
+                dst.Recreate(width, height, View::Bgr24);
+                FillRandom(src);
+                SimdRelease(filter);
+                filter = SimdGaussianBlurInit(width, height, 3, &sigma, NULL);
+            }
+
+            virtual size_t Bytes() const { return src.DataSize() + dst.DataSize(); }
+
+            virtual void Run()
+            {
+                SimdGaussianBlurRun(filter, src.data, src.stride, dst.data, dst.stride);
+            }
+        };
+
+        struct SweepSynetConvolution32fForward : public SweepKernel
+        {
+            static const size_t C = 16;
+            SimdConvolutionParameters param;
+            Tensor32f src, dst, weight, bias;
+            void * context;
+
+            SweepSynetConvolution32fForward() : context(NULL) {}
+            ~SweepSynetConvolution32fForward() { SimdRelease(context); }
+
+            virtual String Name() const { return "SynetConvolution32fForward"; }
+            virtual double PixelSize() const { return 2.0 * C * sizeof(float); }
+
+            virtual void Init(size_t width, size_t height)
+            {
+                param.srcC = C, param.srcH = height, param.srcW = width, param.srcT = SimdTensorData32f, param.srcF = SimdTensorFormatNhwc;
+                param.dstC = C, param.dstH = height, param.dstW = width, param.dstT = SimdTensorData32f, param.dstF = SimdTensorFormatNhwc;
+                param.kernelY = 3, param.kernelX = 3, param.dilationY = 1, param.dilationX = 1, param.strideY = 1, param.strideX = 1;
+                param.padY = 1, param.padX = 1, param.padH = 1, param.padW = 1, param.group = 1, param.activation = SimdConvolutionActivationIdentity;
+                src.Reshape(Shp(1, height, width, C));
+                dst.Reshape(Shp(1, height, width, C));
+                weight.Reshape(Shp(3, 3, C, C));
+                bias.Reshape(Shp(C));
+                FillRandom(src.Data(), src.Size(), -1.0f, 1.0f);
+                FillRandom(weight.Data(), weight.Size(), -1.0f, 1.0f);
+                FillRandom(bias.Data(), bias.Size(), -1.0f, 1.0f);
+                SimdRelease(context);
+                context = SimdSynetConvolution32fInit(1, &param, SimdSynetCompatibilityDefault);
+                SimdSynetConvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), NULL);
+            }
+
+            virtual size_t Bytes() const { return (src.Size() + dst.Size() + weight.Size()) * sizeof(float); }
+
+            virtual void Run()
+            {
+                SimdSynetConvolution32fForward(context, src.Data(), NULL, dst.Data());
+            }
+        };
+
+        String CacheLevel(size_t bytes)
+        {
+            if (bytes <= SimdCpuInfo(SimdCpuInfoCacheL1))
+                return "L1";
+            if (bytes <= SimdCpuInfo(SimdCpuInfoCacheL2))
+                return "L2";
+            if (bytes <= SimdCpuInfo(SimdCpuInfoCacheL3))
+                return "L3";
+            return "RAM";
+        }
+    }
+
+    bool CacheSweepSpecialTest()
+    {
+        typedef std::shared_ptr<SweepKernel> SweepKernelPtr;
+        std::vector<SweepKernelPtr> kernels;
+        kernels.push_back(SweepKernelPtr(new SweepBgraToGray()));
+        kernels.push_back(SweepKernelPtr(new SweepResizerRun()));
+        kernels.push_back(SweepKernelPtr(new SweepIntegral()));
+        kernels.push_back(SweepKernelPtr(new SweepGaussianBlurRun()));
+        kernels.push_back(SweepKernelPtr(new SweepSynetConvolution32fForward()));
+
+        size_t last = Simd::Max<size_t>(SimdCpuInfo(SimdCpuInfoCacheL3), SimdCpuInfo(SimdCpuInfoCacheL2));
+        last = Simd::Max<size_t>(last * 4, 16 * 1024 * 1024);
+        size_t steps = 0;
+        for (size_t size = 4 * 1024; size <= last; size *= 2)
+            steps++;
+
+        TEST_LOG_SS(Info, "Test cache hierarchy sweep: working set from 4 KB to " << last / 1024 << " KB, "
+            << SimdGetThreadNumber() << " threads.");
+
+        Table table(6, kernels.size() * steps);
+        table.SetHeader(0, "Kernel", true);
+        table.SetHeader(1, "Size", true, Table::Right);
+        table.SetHeader(2, "Bytes, KB", true, Table::Right);
+        table.SetHeader(3, "Fits", true, Table::Right);
+        table.SetHeader(4, "Time, us", true, Table::Right);
+        table.SetHeader(5, "GB/s", true, Table::Right);
+        size_t row = 0;
+        for (size_t k = 0; k < kernels.size(); ++k)
+        {
+            SweepKernel & kernel = *kernels[k];
+            for (size_t size = 4 * 1024; size <= last; size *= 2, ++row)
+            {
+                double area = size / kernel.PixelSize();
+                size_t width = Simd::Max<size_t>(size_t(::sqrt(area * 4.0 / 3.0)), 16);
+                size_t height = Simd::Max<size_t>(size_t(area / width), 4);
+                kernel.Init(width, height);
+                kernel.Run();
+                size_t count = 0;
+                double start = GetTime(), time = 0;
+                do
+                {
+                    kernel.Run();
+                    count++;
+                    time = GetTime() - start;
+                } while (time < MINIMAL_TEST_EXECUTION_TIME);
+                time /= count;
+                size_t bytes = kernel.Bytes();
+                table.SetCell(0, row, row % steps == 0 ? kernel.Name() : String());
+                table.SetCell(1, row, ToString(width) + "x" + ToString(height));
+                table.SetCell(2, row, ToString(double(bytes) / 1024.0, 1, false));
+                table.SetCell(3, row, CacheLevel(bytes));
+                table.SetCell(4, row, ToString(time * 1000000.0, 1, false));
+                table.SetCell(5, row, ToString(double(bytes) / time / 1000000000.0, 2, false));
+            }
+            table.SetRowProp(row - 1, true);
+        }
+
+        TEST_LOG_SS(Info, std::endl << table.GenerateText());
+
+        return true;
+    }
+}
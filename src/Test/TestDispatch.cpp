@@ -0,0 +1,74 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestLog.h"
+
+namespace Test
+{
+    namespace
+    {
+        void DispatchRun(const View & a, const View & b, View & diff, View & blur, uint64_t & sum)
+        {
+            SimdAbsDifference(a.data, a.stride, b.data, b.stride, diff.data, diff.stride, a.width, a.height);
+            SimdGaussianBlur3x3(a.data, a.stride, a.width, a.height, 1, blur.data, blur.stride);
+            SimdAbsDifferenceSum(a.data, a.stride, b.data, b.stride, a.width, a.height, &sum);
+        }
+    }
+
+    bool MaxIsaAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdSetMaxIsa.");
+
+        const size_t width = 1001, height = 77;
+        View a(width, height, View::Gray8), b(width, height, View::Gray8);
+        FillRandom(a);
+        FillRandom(b);
+
+        View diff1(width, height, View::Gray8), blur1(width, height, View::Gray8);
+        uint64_t sum1;
+        DispatchRun(a, b, diff1, blur1, sum1);
+
+        const SimdCpuInfoType isas[] = { SimdCpuInfoCacheL3, SimdCpuInfoSse2, SimdCpuInfoSse41, SimdCpuInfoAvx2, SimdCpuInfoAvx512bw };
+        for (size_t i = 0; i < sizeof(isas) / sizeof(isas[0]) && result; ++i)
+        {
+            View diff2(width, height, View::Gray8), blur2(width, height, View::Gray8);
+            uint64_t sum2;
+            SimdSetMaxIsa(isas[i]);
+            DispatchRun(a, b, diff2, blur2, sum2);
+            SimdSetMaxIsa(SimdCpuInfoNeon);
+
+            result = result && Compare(diff1, diff2, 0, true, 32, 0, "AbsDifference");
+            result = result && Compare(blur1, blur2, 0, true, 32, 0, "GaussianBlur3x3");
+            if (sum1 != sum2)
+            {
+                TEST_LOG_SS(Error, "AbsDifferenceSum: " << sum1 << " != " << sum2 << " for max ISA " << isas[i] << " !");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,149 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestLog.h"
+
+#include <thread>
+#include <atomic>
+
+namespace Test
+{
+    bool HugePageAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdSetHugePageThreshold.");
+
+        const size_t size = 5 * 1024 * 1024 + 1, small = 1024 * 1024;
+        size_t threshold = SimdGetHugePageThreshold(), bytes = SimdGetHugePageBytes();
+
+        SimdSetHugePageThreshold(4 * 1024 * 1024);
+        uint8_t * large = (uint8_t*)SimdAllocate(size, SimdAlignment());
+        uint8_t * little = (uint8_t*)SimdAllocate(small, SimdAlignment());
+        SimdSetHugePageThreshold(threshold);
+
+        if (large == NULL || little == NULL || size_t(large) % SimdAlignment() || size_t(little) % SimdAlignment())
+        {
+            TEST_LOG_SS(Error, "SimdAllocate returns wrong pointers: " << (void*)large << ", " << (void*)little << " !");
+            result = false;
+        }
+        else
+        {
+            memset(large, 1, size);
+            memset(little, 2, small);
+            size_t used = SimdGetHugePageBytes() - bytes;
+            if (used != 0 && used < size)
+            {
+                TEST_LOG_SS(Error, "SimdGetHugePageBytes returns " << used << " bytes for block of " << size << " bytes!");
+                result = false;
+            }
+            if (used >= size + small)
+            {
+                TEST_LOG_SS(Error, "Block of " << small << " bytes below threshold is backed by huge pages!");
+                result = false;
+            }
+            TEST_LOG_SS(Info, "Huge page backed: " << used << " bytes.");
+        }
+
+        SimdFree(large);
+        SimdFree(little);
+        if (SimdGetHugePageBytes() != bytes)
+        {
+            TEST_LOG_SS(Error, "SimdFree does not release huge page backed memory!");
+            result = false;
+        }
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------------------------------------
+
+    bool PoolAllocatorAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::PoolAllocator.");
+
+        typedef Simd::View<Simd::PoolAllocator> PoolView;
+        typedef Simd::PoolAllocator<uint8_t> Pool;
+
+        void * first = NULL;
+        for (size_t i = 0; i < 10 && result; ++i)
+        {
+            PoolView frame(1920, 1080, PoolView::Bgr24);
+            Simd::Fill(frame, uint8_t(i));
+            if (size_t(frame.data) % Pool::Alignment())
+            {
+                TEST_LOG_SS(Error, "Simd::PoolAllocator returns unaligned memory " << (void*)frame.data << " !");
+                result = false;
+            }
+            if (i && frame.data != first)
+            {
+                TEST_LOG_SS(Error, "Simd::PoolAllocator does not recycle memory block of the same size!");
+                result = false;
+            }
+            first = frame.data;
+        }
+
+        const size_t count = 1000, threads = 4;
+        std::vector<uint8_t*> ptrs(count);
+        std::atomic<int> errors(0);
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t)
+            workers.push_back(std::thread([&ptrs, &errors, t, count, threads]()
+            {
+                for (size_t i = t; i < count; i += threads)
+                {
+                    ptrs[i] = (uint8_t*)Pool::Allocate(i * 37 + 1, Pool::Alignment());
+                    if (ptrs[i] == NULL)
+                        errors++;
+                    else
+                        memset(ptrs[i], uint8_t(i), i * 37 + 1);
+                }
+            }));
+        for (size_t t = 0; t < threads; ++t)
+            workers[t].join();
+        workers.clear();
+        for (size_t i = 0; i < count && errors == 0; ++i)
+            if (ptrs[i][0] != uint8_t(i) || ptrs[i][i * 37] != uint8_t(i))
+                errors++;
+        for (size_t t = 0; t < threads; ++t)
+            workers.push_back(std::thread([&ptrs, t, count, threads]()
+            {
+                for (size_t i = (t + 1) % threads; i < count; i += threads)
+                    Pool::Free(ptrs[i]);
+            }));
+        for (size_t t = 0; t < threads; ++t)
+            workers[t].join();
+        if (errors)
+        {
+            TEST_LOG_SS(Error, "Simd::PoolAllocator returns wrong memory blocks in multithreaded mode!");
+            result = false;
+        }
+
+        Pool::Clear();
+
+        return result;
+    }
+}
@@ -28,6 +28,9 @@
 #include "Test/TestString.h"
 #include "Test/TestHtml.h"
 
+#include "Simd/SimdEnable.h"
+#include "Simd/SimdCpu.h"
+
 #if defined(_MSC_VER)
 #define NOMINMAX
 #include <windows.h>
@@ -68,6 +71,8 @@ namespace Test
 
     //-------------------------------------------------------------------------
 
+    const size_t PERFORMANCE_SAMPLES_MAX = 256;
+
     PerformanceMeasurer::PerformanceMeasurer(const String & description)
         : _description(description)
         , _count(0)
@@ -76,6 +81,9 @@ namespace Test
         , _max(std::numeric_limits<double>::min())
         , _entered(false)
         , _size(0)
+        , _flop(0)
+        , _bytes(0)
+        , _int8(false)
     {
     }
 
@@ -87,6 +95,10 @@ namespace Test
         , _max(pm._max)
         , _entered(pm._entered)
         , _size(pm._size)
+        , _samples(pm._samples)
+        , _flop(pm._flop)
+        , _bytes(pm._bytes)
+        , _int8(pm._int8)
     {
     }
 
@@ -108,16 +120,54 @@ namespace Test
             _total += difference;
             _min = std::min(_min, difference);
             _max = std::max(_max, difference);
+            if (_samples.size() < PERFORMANCE_SAMPLES_MAX)
+                _samples.push_back(float(difference));
+            else
+                _samples[_count % PERFORMANCE_SAMPLES_MAX] = float(difference);
             ++_count;
             _size += std::max<size_t>(1, size);
         }
     }
 
+    void PerformanceMeasurer::SetWork(int64_t flop, int64_t bytes, bool int8)
+    {
+        _flop = flop;
+        _bytes = bytes;
+        _int8 = int8;
+    }
+
     double PerformanceMeasurer::Average() const
     {
         return _count ? (_total / _count) : 0;
     }
 
+    static double Median(std::vector<float> & values)
+    {
+        if (values.empty())
+            return 0;
+        size_t half = values.size() / 2;
+        std::nth_element(values.begin(), values.begin() + half, values.end());
+        double median = values[half];
+        if (values.size() % 2 == 0)
+            median = (median + *std::max_element(values.begin(), values.begin() + half)) / 2;
+        return median;
+    }
+
+    double PerformanceMeasurer::Median() const
+    {
+        std::vector<float> samples(_samples);
+        return Test::Median(samples);
+    }
+
+    double PerformanceMeasurer::Mad() const
+    {
+        std::vector<float> deviations(_samples);
+        double median = Test::Median(deviations);
+        for (size_t i = 0; i < deviations.size(); ++i)
+            deviations[i] = float(std::abs(deviations[i] - median));
+        return Test::Median(deviations);
+    }
+
     String PerformanceMeasurer::Statistic() const
     {
         std::stringstream ss;
@@ -141,6 +191,15 @@ namespace Test
         _min = std::min(_min, other._min);
         _max = std::max(_max, other._max);
         _size += other._size;
+        _samples.insert(_samples.end(), other._samples.begin(), other._samples.end());
+        if (_samples.size() > PERFORMANCE_SAMPLES_MAX)
+            _samples.erase(_samples.begin(), _samples.end() - PERFORMANCE_SAMPLES_MAX);
+        if (other._flop)
+        {
+            _flop = other._flop;
+            _bytes = other._bytes;
+            _int8 = other._int8;
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -427,6 +486,8 @@ namespace Test
         for (size_t i = 0; i < enable.Size(); ++i)
             if (enable[i])
                 size++;
+        if (size == 0)
+            return TablePtr(new Table(0, 0));
         TablePtr table(new Table(size*(align ? 4 : 3) - 3, 1 + functions.size()));
         AddHeader(*table, names, enable, align);
         size_t row = 0;
@@ -437,6 +498,66 @@ namespace Test
         return table;
     }
 
+    PerformanceMeasurerStorage::TablePtr PerformanceMeasurerStorage::GenerateScalingTable() const
+    {
+        typedef std::map<size_t, PmPtr> Steps;
+        typedef std::map<String, Steps> Functions;
+        Functions functions;
+        size_t rows = 0;
+        for (ScalingMap::const_iterator step = _scaling.begin(); step != _scaling.end(); ++step)
+        {
+            for (FunctionMap::const_iterator function = step->second.begin(); function != step->second.end(); ++function)
+            {
+                const String & desc = function->first;
+                Steps & steps = functions[desc.substr(0, desc.size() - 3)];
+                PmPtr & pm = steps[step->first];
+                if (!pm)
+                {
+                    pm.reset(new PerformanceMeasurer(*function->second));
+                    rows++;
+                }
+                else
+                    pm->Combine(*function->second);
+            }
+        }
+
+        TablePtr table(new Table(6, rows));
+        table->SetHeader(0, "Function", true);
+        table->SetHeader(1, "Threads", true, Table::Right);
+        table->SetHeader(2, "Time, ms", true, Table::Right);
+        table->SetHeader(3, "Throughput", true, Table::Right);
+        table->SetHeader(4, "Speedup", true, Table::Right);
+        table->SetHeader(5, "Efficiency", true, Table::Right);
+        size_t row = 0;
+        for (Functions::const_iterator function = functions.begin(); function != functions.end(); ++function)
+        {
+            const Steps & steps = function->second;
+            const PerformanceMeasurer & first = *steps.begin()->second;
+            for (Steps::const_iterator step = steps.begin(); step != steps.end(); ++step, ++row)
+            {
+                const PerformanceMeasurer & pm = *step->second;
+                double speedup = Relation(first, pm);
+                double efficiency = speedup * steps.begin()->first / step->first;
+                String throughput = pm.Total() <= 0 ? String("-") : pm.Size() > pm.Count() ?
+                    ToString(double(pm.Size()) / pm.Total() / 1000000.0, 1, false) + " MB/s" :
+                    ToString(double(pm.Count()) / pm.Total(), 1, false) + " 1/s";
+                table->SetCell(0, row, step == steps.begin() ? function->first : String());
+                table->SetCell(1, row, ToString(step->first));
+                table->SetCell(2, row, ToString(pm.Average() * 1000.0, 3, false));
+                table->SetCell(3, row, throughput);
+                table->SetCell(4, row, ToString(speedup, 2, false));
+                table->SetCell(5, row, ToString(efficiency, 2, false));
+            }
+            table->SetRowProp(row - 1, true);
+        }
+        return table;
+    }
+
+    PerformanceMeasurerStorage::TablePtr PerformanceMeasurerStorage::GenerateReport(bool align) const
+    {
+        return _scaling.empty() ? GenerateTable(align) : GenerateScalingTable();
+    }
+
     static String TestTitle()
     {
         return "Simd Library Performance Report:";
@@ -467,7 +588,10 @@ namespace Test
         }
         else
         {
-            report << GenerateTable(align)->GenerateText();
+            report << GenerateReport(align)->GenerateText();
+            TablePtr roofline = GenerateRooflineTable();
+            if (roofline)
+                report << std::endl << roofline->GenerateText();
         }
 
         return report.str();
@@ -484,7 +608,11 @@ namespace Test
 
         file << TestInfo() << std::endl << std::endl;
 
-        file << GenerateTable(align)->GenerateText();
+        file << GenerateReport(align)->GenerateText();
+
+        TablePtr roofline = GenerateRooflineTable();
+        if (roofline)
+            file << std::endl << roofline->GenerateText();
 
         file.close();
 
@@ -508,7 +636,14 @@ namespace Test
 
         html.WriteValue("h4", Html::Attr(), TestInfo(), true);
 
-        html.WriteText(GenerateTable(align)->GenerateHtml(html.Indent()), false, false);
+        html.WriteText(GenerateReport(align)->GenerateHtml(html.Indent()), false, false);
+
+        TablePtr roofline = GenerateRooflineTable();
+        if (roofline)
+        {
+            html.WriteValue("h3", Html::Attr(), "Roofline:", true);
+            html.WriteText(roofline->GenerateHtml(html.Indent()), false, false);
+        }
 
         html.WriteEnd("body", true, true);
         html.WriteEnd("html", true, true);
@@ -518,8 +653,337 @@ namespace Test
         return true;
     }
 
+    //-------------------------------------------------------------------------
+
+    struct PerformanceMeasurerStorage::Record
+    {
+        String function, isa;
+        bool aligned;
+        size_t threads, count;
+        double average, median, mad, min, max;
+        double gflops, gbps, intensity, peak;
+
+        String Key() const
+        {
+            return function + "|" + isa + "|" + (aligned ? "a" : "u") + "|" + ToString(threads);
+        }
+    };
+
+    static double PeakPerformance(const String & isa, bool int8)
+    {
+        static const char * order[] = { "API", "Amx", "Avx512bf16", "Avx512vnni", "Avx512bw", "Avx2", "Avx", "Sse41", "Sse2", "Base" };
+        const size_t size = sizeof(order) / sizeof(order[0]);
+        size_t level = 0;
+        while (level < size && isa != order[level])
+            level++;
+#if defined(SIMD_AVX512VNNI_ENABLE)
+        if (level <= 3 && Simd::Avx512vnni::Enable)
+            return int8 ? Simd::Avx512vnni::CpuPeak8i() : Simd::Avx512vnni::CpuPeak32f();
+#endif
+#if defined(SIMD_AVX512BW_ENABLE)
+        if (level <= 4 && Simd::Avx512bw::Enable)
+            return int8 ? Simd::Avx512bw::CpuPeak8i() : Simd::Avx512bw::CpuPeak32f();
+#endif
+#if defined(SIMD_AVX2_ENABLE)
+        if (level <= 5 && Simd::Avx2::Enable)
+            return int8 ? Simd::Avx2::CpuPeak8i() : Simd::Avx2::CpuPeak32f();
+#endif
+#if defined(SIMD_SSE41_ENABLE)
+        if (level <= 7 && Simd::Sse41::Enable)
+            return int8 ? Simd::Sse41::CpuPeak8i() : Simd::Sse41::CpuPeak32f();
+#endif
+        return int8 ? Simd::Base::CpuPeak8i() : Simd::Base::CpuPeak32f();
+    }
+
+    PerformanceMeasurerStorage::Records PerformanceMeasurerStorage::GenerateRecords() const
+    {
+        ScalingMap steps;
+        if (_scaling.empty())
+            Combine(steps[SimdGetThreadNumber()]);
+        else
+            steps = _scaling;
+        Records records;
+        for (ScalingMap::const_iterator step = steps.begin(); step != steps.end(); ++step)
+        {
+            for (FunctionMap::const_iterator it = step->second.begin(); it != step->second.end(); ++it)
+            {
+                const PerformanceMeasurer & pm = *it->second;
+                const String & desc = pm.Description();
+                String name = desc.substr(0, desc.size() - 3);
+                Record record;
+                record.aligned = desc[desc.size() - 2] == 'a';
+                if (name.find("Simd::") == 0)
+                {
+                    size_t pos = name.find("::", 6);
+                    record.isa = name.substr(6, pos - 6);
+                    record.function = name.substr(pos + 2);
+                }
+                else
+                {
+                    record.isa = "API";
+                    record.function = name.find("Simd") == 0 ? name.substr(4) : name;
+                }
+                record.threads = step->first;
+                record.count = pm.Count();
+                record.average = pm.Average() * 1000.0;
+                record.median = pm.Median() * 1000.0;
+                record.mad = pm.Mad() * 1000.0;
+                record.min = pm.Min() * 1000.0;
+                record.max = pm.Max() * 1000.0;
+                double time = pm.Average();
+                record.gflops = time > 0 ? double(pm.Flop()) / time * 0.000000001 : 0.0;
+                record.gbps = time > 0 ? double(pm.Bytes()) / time * 0.000000001 : 0.0;
+                record.intensity = pm.Bytes() > 0 ? double(pm.Flop()) / double(pm.Bytes()) : 0.0;
+                double peak = pm.Flop() > 0 ? PeakPerformance(record.isa, pm.Int8()) * std::min<size_t>(record.threads, SimdCpuInfo(SimdCpuInfoCores)) : 0.0;
+                record.peak = peak > 0 ? record.gflops * 1000000000.0 / peak * 100.0 : 0.0;
+                records.push_back(record);
+            }
+        }
+        return records;
+    }
+
+    PerformanceMeasurerStorage::TablePtr PerformanceMeasurerStorage::GenerateRooflineTable() const
+    {
+        Records all = GenerateRecords(), records;
+        for (size_t i = 0; i < all.size(); ++i)
+            if (all[i].gflops > 0)
+                records.push_back(all[i]);
+        if (records.empty())
+            return TablePtr();
+
+        TablePtr table(new Table(7, records.size()));
+        table->SetHeader(0, "Function", true);
+        table->SetHeader(1, "Isa", true);
+        table->SetHeader(2, "Time, ms", true, Table::Right);
+        table->SetHeader(3, "GFLOPS", true, Table::Right);
+        table->SetHeader(4, "GB/s", true, Table::Right);
+        table->SetHeader(5, "Flop/Byte", true, Table::Right);
+        table->SetHeader(6, "Peak, %", true, Table::Right);
+        for (size_t row = 0; row < records.size(); ++row)
+        {
+            const Record & r = records[row];
+            table->SetCell(0, row, r.function + (r.aligned ? "" : "{u}"));
+            table->SetCell(1, row, r.isa);
+            table->SetCell(2, row, ToString(r.average, 3, false));
+            table->SetCell(3, row, ToString(r.gflops, 1, false));
+            table->SetCell(4, row, ToString(r.gbps, 1, false));
+            table->SetCell(5, row, ToString(r.intensity, 1, false));
+            table->SetCell(6, row, ToString(r.peak, 1, false));
+        }
+        return table;
+    }
+
+    static String JsonString(const String & value)
+    {
+        std::stringstream ss;
+        ss << "\"";
+        for (size_t i = 0; i < value.size(); ++i)
+        {
+            char c = value[i];
+            if (c == '"' || c == '\\')
+                ss << '\\' << c;
+            else if (c == '\n')
+                ss << "\\n";
+            else if (c == '\t')
+                ss << "\\t";
+            else
+                ss << c;
+        }
+        ss << "\"";
+        return ss.str();
+    }
+
+    static String CsvString(const String & value)
+    {
+        if (value.find_first_of(",\"\n") == String::npos)
+            return value;
+        String escaped = "\"";
+        for (size_t i = 0; i < value.size(); ++i)
+        {
+            if (value[i] == '"')
+                escaped += '"';
+            escaped += value[i];
+        }
+        return escaped + "\"";
+    }
+
+    bool PerformanceMeasurerStorage::JsonReport(const String & path) const
+    {
+        CreatePathIfNotExist(path, true);
+        std::ofstream file(path);
+        if (!file.is_open())
+            return false;
+
+        Records records = GenerateRecords();
+        file << "{" << std::endl;
+        file << "  \"title\": " << JsonString(TestTitle()) << "," << std::endl;
+        file << "  \"info\": " << JsonString(TestInfo()) << "," << std::endl;
+        file << "  \"version\": " << JsonString(SimdVersion()) << "," << std::endl;
+        file << "  \"width\": " << W << ", \"height\": " << H << ", \"channels\": " << C << "," << std::endl;
+        file << "  \"records\": [" << std::endl;
+        file << std::setprecision(6);
+        for (size_t i = 0; i < records.size(); ++i)
+        {
+            const Record & r = records[i];
+            file << "    {\"function\": " << JsonString(r.function) << ", \"isa\": " << JsonString(r.isa);
+            file << ", \"aligned\": " << (r.aligned ? "true" : "false") << ", \"threads\": " << r.threads;
+            file << ", \"width\": " << W << ", \"height\": " << H << ", \"channels\": " << C;
+            file << ", \"count\": " << r.count << ", \"average\": " << r.average << ", \"median\": " << r.median;
+            file << ", \"mad\": " << r.mad << ", \"min\": " << r.min << ", \"max\": " << r.max;
+            if (r.gflops > 0)
+                file << ", \"gflops\": " << r.gflops << ", \"gbps\": " << r.gbps << ", \"intensity\": " << r.intensity << ", \"peak\": " << r.peak;
+            file << "}";
+            file << (i + 1 < records.size() ? "," : "") << std::endl;
+        }
+        file << "  ]" << std::endl;
+        file << "}" << std::endl;
+
+        file.close();
+
+        return true;
+    }
+
+    bool PerformanceMeasurerStorage::CsvReport(const String & path) const
+    {
+        CreatePathIfNotExist(path, true);
+        std::ofstream file(path);
+        if (!file.is_open())
+            return false;
+
+        Records records = GenerateRecords();
+        file << "function,isa,aligned,threads,width,height,channels,count,average,median,mad,min,max,gflops,gbps,intensity,peak" << std::endl;
+        file << std::setprecision(6);
+        for (size_t i = 0; i < records.size(); ++i)
+        {
+            const Record & r = records[i];
+            file << CsvString(r.function) << "," << r.isa << "," << (r.aligned ? 1 : 0) << "," << r.threads << ",";
+            file << W << "," << H << "," << C << "," << r.count << "," << r.average << "," << r.median << ",";
+            file << r.mad << "," << r.min << "," << r.max << "," << r.gflops << "," << r.gbps << "," << r.intensity << "," << r.peak << std::endl;
+        }
+
+        file.close();
+
+        return true;
+    }
+
+    static bool LoadBaselineRecord(const String & text, size_t & pos, std::map<String, String> & values)
+    {
+        values.clear();
+        pos = text.find('{', pos);
+        if (pos == String::npos)
+            return false;
+        for (++pos; pos < text.size();)
+        {
+            pos = text.find_first_of("\"}", pos);
+            if (pos == String::npos)
+                return false;
+            if (text[pos] == '}')
+            {
+                pos++;
+                return true;
+            }
+            String key, value;
+            for (pos++; pos < text.size() && text[pos] != '"'; ++pos)
+                key += text[pos];
+            pos = text.find(':', pos);
+            if (pos == String::npos)
+                return false;
+            pos = text.find_first_not_of(" \t\r\n", pos + 1);
+            if (pos == String::npos)
+                return false;
+            if (text[pos] == '"')
+            {
+                for (pos++; pos < text.size() && text[pos] != '"'; ++pos)
+                {
+                    if (text[pos] == '\\' && pos + 1 < text.size())
+                        pos++;
+                    value += text[pos];
+                }
+                pos++;
+            }
+            else
+            {
+                size_t end = text.find_first_of(",}", pos);
+                if (end == String::npos)
+                    return false;
+                value = text.substr(pos, end - pos);
+                pos = end;
+            }
+            values[key] = value;
+        }
+        return false;
+    }
+
+    bool PerformanceMeasurerStorage::CompareWithBaseline(const String & path, double tolerance) const
+    {
+        std::ifstream file(path);
+        if (!file.is_open())
+        {
+            TEST_LOG_SS(Error, "Can't open baseline file '" << path << "'!");
+            return false;
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        String text = buffer.str();
+
+        typedef std::map<String, Record> RecordMap;
+        RecordMap baseline;
+        size_t pos = text.find("\"records\"");
+        std::map<String, String> values;
+        while (pos != String::npos && LoadBaselineRecord(text, pos, values))
+        {
+            Record record;
+            record.function = values["function"];
+            record.isa = values["isa"];
+            record.aligned = values["aligned"].find("true") != String::npos;
+            record.threads = FromString<size_t>(values["threads"]);
+            record.median = FromString<double>(values["median"]);
+            record.mad = FromString<double>(values["mad"]);
+            baseline[record.Key()] = record;
+        }
+        if (baseline.empty())
+        {
+            TEST_LOG_SS(Error, "Baseline file '" << path << "' doesn't contain any records!");
+            return false;
+        }
+
+        const double MAD_TO_SIGMA = 1.4826, SIGMA_MAX = 3.0;
+        Records records = GenerateRecords();
+        size_t compared = 0, regressions = 0, improvements = 0;
+        for (size_t i = 0; i < records.size(); ++i)
+        {
+            const Record & current = records[i];
+            RecordMap::const_iterator it = baseline.find(current.Key());
+            if (it == baseline.end() || it->second.median <= 0)
+                continue;
+            const Record & base = it->second;
+            double noise = SIGMA_MAX * MAD_TO_SIGMA * std::max(base.mad, current.mad);
+            double threshold = std::max(tolerance * base.median, noise);
+            compared++;
+            if (current.median - base.median > threshold)
+            {
+                regressions++;
+                TEST_LOG_SS(Error, "Regression: " << current.isa << "::" << current.function << (current.aligned ? "{a}" : "{u}")
+                    << " threads=" << current.threads << ": median " << ToString(base.median, 3, false) << " -> "
+                    << ToString(current.median, 3, false) << " ms (" << ToString((current.median / base.median - 1.0) * 100.0, 1, false) << "%)");
+            }
+            else if (base.median - current.median > threshold)
+                improvements++;
+        }
+        TEST_LOG_SS(Info, "Comparison with baseline '" << path << "': " << compared << " functions are compared, "
+            << regressions << " regressions, " << improvements << " improvements (tolerance " << ToString(tolerance * 100.0, 1, false) << "%).");
+        return regressions == 0;
+    }
+
     void PerformanceMeasurerStorage::Clear()
     {
         _map.clear();
     }
+
+    void PerformanceMeasurerStorage::AddScalingStep(size_t threads)
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+        Combine(_scaling[threads]);
+        _map.clear();
+    }
 }
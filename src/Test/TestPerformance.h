@@ -44,6 +44,11 @@ namespace Test
 
         long long _size;
 
+        std::vector<float> _samples;
+
+        int64_t _flop, _bytes;
+        bool _int8;
+
     public:
         PerformanceMeasurer(const String & description = "Unnamed");
         PerformanceMeasurer(const PerformanceMeasurer & pm);
@@ -52,10 +57,23 @@ namespace Test
         void Leave(size_t size = 1);
 
         double Average() const;
+        double Median() const;
+        double Mad() const;
         String Statistic() const;
 
         String Description() const { return _description; }
 
+        int Count() const { return _count; }
+        double Total() const { return _total; }
+        long long Size() const { return _size; }
+        double Min() const { return _min; }
+        double Max() const { return _max; }
+
+        void SetWork(int64_t flop, int64_t bytes, bool int8);
+        int64_t Flop() const { return _flop; }
+        int64_t Bytes() const { return _bytes; }
+        bool Int8() const { return _int8; }
+
         void Combine(const PerformanceMeasurer & other);
     };
 
@@ -86,6 +104,12 @@ namespace Test
         }
 
         void SetSize(size_t size) { _size = size; }
+
+        void SetWork(int64_t flop, int64_t bytes, bool int8)
+        {
+            if (_pm)
+                _pm->SetWork(flop, bytes, int8);
+        }
     };
 
     //-------------------------------------------------------------------------
@@ -101,15 +125,24 @@ namespace Test
             bool align;
         };
         typedef std::map<std::thread::id, Thread> ThreadMap;
+        typedef std::map<size_t, FunctionMap> ScalingMap;
 
         ThreadMap _map;
+        ScalingMap _scaling;
         mutable std::recursive_mutex _mutex;
 
         Thread & ThisThread();
 
+        struct Record;
+        typedef std::vector<Record> Records;
+        Records GenerateRecords() const;
+
         typedef std::shared_ptr<class Table> TablePtr;
         void Combine(FunctionMap& map) const;
         TablePtr GenerateTable(bool align) const;
+        TablePtr GenerateScalingTable() const;
+        TablePtr GenerateReport(bool align) const;
+        TablePtr GenerateRooflineTable() const;
 
     public:
         static PerformanceMeasurerStorage s_storage;
@@ -128,21 +161,32 @@ namespace Test
         bool HtmlReport(const String & path, bool align = false) const;
 
         void Clear();
+
+        void AddScalingStep(size_t threads);
+
+        bool JsonReport(const String & path) const;
+
+        bool CsvReport(const String & path) const;
+
+        bool CompareWithBaseline(const String & path, double tolerance) const;
     };
 }
 
 #define TEST_PERFORMANCE_TEST_(decription) Test::ScopedPerformanceMeasurer ___spm(*(Test::PerformanceMeasurerStorage::s_storage.Get(decription)));
 #define TEST_FUNCTION_PERFORMANCE_TEST_ TEST_PERFORMANCE_TEST_(__FUNCTION__)
 #define TEST_PERFORMANCE_TEST_SET_SIZE_(size) ___spm.SetSize(size);
+#define TEST_PERFORMANCE_TEST_SET_WORK_(flop, bytes, int8) ___spm.SetWork(flop, bytes, int8);
 
 #ifdef TEST_PERFORMANCE_TEST_ENABLE
 #define TEST_PERFORMANCE_TEST(decription) TEST_PERFORMANCE_TEST_(decription)
 #define TEST_FUNCTION_PERFORMANCE_TEST TEST_FUNCTION_PERFORMANCE_TEST_
 #define TEST_PERFORMANCE_TEST_SET_SIZE(size) TEST_PERFORMANCE_TEST_SET_SIZE_(size)
+#define TEST_PERFORMANCE_TEST_SET_WORK(flop, bytes, int8) TEST_PERFORMANCE_TEST_SET_WORK_(flop, bytes, int8)
 #else//TEST_PERFORMANCE_TEST_ENABLE
 #define TEST_PERFORMANCE_TEST(decription)
 #define TEST_FUNCTION_PERFORMANCE_TEST
 #define TEST_PERFORMANCE_TEST_SET_SIZE(size)
+#define TEST_PERFORMANCE_TEST_SET_WORK(flop, bytes, int8)
 #endif//TEST_PERFORMANCE_TEST_ENABLE
 
 #ifdef NDEBUG
@@ -0,0 +1,123 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestLog.h"
+
+namespace Test
+{
+    bool PipelineGrayAutoTest(int width, int height, bool sobel)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Pipeline Bgr24-Gray8-GaussianBlur3x3-" << (sobel ? "SobelDxAbs" : "Binarization") << " [" << width << ", " << height << "].");
+
+        View src(width, height, View::Bgr24);
+        FillRandom(src);
+
+        View gray(width, height, View::Gray8), blur(width, height, View::Gray8);
+        View dst1(width, height, sobel ? View::Int16 : View::Gray8), dst2(width, height, sobel ? View::Int16 : View::Gray8);
+        SimdBgrToGray(src.data, width, height, src.stride, gray.data, gray.stride);
+        SimdGaussianBlur3x3(gray.data, gray.stride, width, height, 1, blur.data, blur.stride);
+        if (sobel)
+            SimdSobelDxAbs(blur.data, blur.stride, width, height, dst1.data, dst1.stride);
+        else
+            SimdBinarization(blur.data, blur.stride, width, height, 127, 255, 0, dst1.data, dst1.stride, SimdCompareGreater);
+
+        void * pipeline = SimdPipelineInit(width, height, SimdPixelFormatBgr24);
+        result = result && pipeline != NULL;
+        result = result && SimdPipelineAddConvert(pipeline, SimdPixelFormatGray8);
+        result = result && SimdPipelineAddGaussianBlur3x3(pipeline);
+        if (sobel)
+            result = result && SimdPipelineAddSobelAbs(pipeline, SimdTrue);
+        else
+            result = result && SimdPipelineAddBinarization(pipeline, 127, 255, 0, SimdCompareGreater);
+        if (result)
+        {
+            const uint8_t * planes[1] = { src.data };
+            size_t strides[1] = { (size_t)src.stride };
+            SimdPipelineRun(pipeline, planes, strides, dst2.data, dst2.stride);
+            result = Compare(dst1, dst2, 0, true, 64);
+        }
+        else
+            TEST_LOG_SS(Error, "Can't create pipeline!");
+        SimdRelease(pipeline);
+
+        return result;
+    }
+
+    bool PipelineInputAutoTest(int width, int height, int dstW, int dstH, SimdTensorFormatType format)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Pipeline Nv12-Bgr24-Resize-SetInput [" << width << ", " << height << "] -> ["
+            << dstW << ", " << dstH << "] " << (format == SimdTensorFormatNchw ? "NCHW" : "NHWC") << ".");
+
+        View y(width, height, View::Gray8), uv(width / 2, height / 2, View::Uv16);
+        FillRandom(y);
+        FillRandom(uv);
+
+        View u(width / 2, height / 2, View::Gray8), v(width / 2, height / 2, View::Gray8);
+        View bgr(width, height, View::Bgr24), resized(dstW, dstH, View::Bgr24);
+        SimdDeinterleaveUv(uv.data, uv.stride, uv.width, uv.height, u.data, u.stride, v.data, v.stride);
+        SimdYuv420pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, width, height, bgr.data, bgr.stride);
+        void * resizer = SimdResizerInit(width, height, dstW, dstH, 3, SimdResizeChannelByte, SimdResizeMethodBilinear);
+        SimdResizerRun(resizer, bgr.data, bgr.stride, resized.data, resized.stride);
+        SimdRelease(resizer);
+
+        const float lower[3] = { -1.0f, 0.0f, -2.0f }, upper[3] = { 1.0f, 1.0f, 2.0f };
+        Buffer32f dst1(3 * dstW * dstH), dst2(3 * dstW * dstH);
+        SimdSynetSetInput(resized.data, dstW, dstH, resized.stride, SimdPixelFormatBgr24, lower, upper, dst1.data(), 3, format);
+
+        void * pipeline = SimdPipelineInit(width, height, SimdPixelFormatUv16);
+        result = result && pipeline != NULL;
+        result = result && SimdPipelineAddConvert(pipeline, SimdPixelFormatBgr24);
+        result = result && SimdPipelineAddResize(pipeline, dstW, dstH);
+        result = result && SimdPipelineAddSetInput(pipeline, lower, upper, 3, format);
+        if (result)
+        {
+            const uint8_t * planes[2] = { y.data, uv.data };
+            size_t strides[2] = { (size_t)y.stride, (size_t)uv.stride };
+            SimdPipelineRun(pipeline, planes, strides, (uint8_t*)dst2.data(), 0);
+            result = Compare(dst1, dst2, 4.0f / 255.0f + EPS, true, 64, DifferenceAbsolute);
+        }
+        else
+            TEST_LOG_SS(Error, "Can't create pipeline!");
+        SimdRelease(pipeline);
+
+        return result;
+    }
+
+    bool PipelineAutoTest()
+    {
+        bool result = true;
+
+        result = result && PipelineGrayAutoTest(W, H, false);
+        result = result && PipelineGrayAutoTest(W + O, H - O, true);
+
+        result = result && PipelineInputAutoTest(W, H, W / 3, H / 3, SimdTensorFormatNchw);
+        result = result && PipelineInputAutoTest(W + 2 * O, H - 2 * O, (W + 2 * O) * 2 / 3, (H - 2 * O) / 2, SimdTensorFormatNhwc);
+
+        return result;
+    }
+}
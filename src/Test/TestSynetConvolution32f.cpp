@@ -43,17 +43,21 @@ namespace Test
 
             FuncPtr func;
             String desc;
+            int64_t flop, bytes;
 
-            FuncC(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+            FuncC(const FuncPtr & f, const String & d) : func(f), desc(d), flop(0), bytes(0) {}
 
             void Update(const Param & p, SimdSynetCompatibilityType c)
             {
                 desc = desc + p.Decription(Simd::Base::Bf16Soft(c) ? "-bf16" : "-fp32");
+                flop = SynetConvolutionFlop(p.batch, p.conv);
+                bytes = SynetConvolutionBytes(p.batch, p.conv, Simd::Base::Bf16Soft(c) ? 2 : 4);
             }
 
             void Call(void * context, const Tensor32f & src, Tensor32f & buf, Tensor32f & dst) const
             {
                 TEST_PERFORMANCE_TEST(desc);
+                TEST_PERFORMANCE_TEST_SET_WORK(flop, bytes, false);
                 ::SimdSynetConvolution32fForward(context, src.Data(), buf.Data(), dst.Data());
             }
         };
@@ -654,5 +658,266 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution32fTuningAutoTest()
+    {
+        const float EPS = 0.001f;
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdSynetSetTuning.");
+
+        const String path = "_synet_tuning.txt";
+        ::remove(path.c_str());
+        ::SimdSynetSetTuning(SimdTrue, path.c_str());
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        SimdSynetCompatibilityType fp32 = SimdSynetCompatibilityDefault;
+        const Param params[] = {
+            Param(1, 32, 19, 16, 64, _1, _1, _1, _0, _0, 1, SimdConvolutionActivationRelu, SimdTrue),
+            Param(1, 64, 19, 16, 64, _3, _1, _1, _1, _1, 1, SimdConvolutionActivationPrelu, SimdTrue),
+            Param(1, 16, 20, 18, 32, _3, _1, _2, _1, _1, 1, SimdConvolutionActivationIdentity, SimdFalse) };
+        for (size_t i = 0; i < 3 && result; ++i)
+        {
+            result = result && SynetConvolution32fForwardAutoTest(2 * EPS, params[i], fp32, 
+                FUNC_C(Simd::Base::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
+
+            void * context1 = ::SimdSynetConvolution32fInit(params[i].batch, &params[i].conv, fp32);
+            String info1 = ::SimdSynetConvolution32fInfo(context1);
+            ::SimdSynetSetTuning(SimdTrue, path.c_str());
+            void * context2 = ::SimdSynetConvolution32fInit(params[i].batch, &params[i].conv, fp32);
+            String info2 = ::SimdSynetConvolution32fInfo(context2);
+            ::SimdRelease(context1);
+            ::SimdRelease(context2);
+            if (info1 != info2)
+            {
+                TEST_LOG_SS(Error, "Tuning database returns other algorithm: " << info1 << " != " << info2 << " !");
+                result = false;
+            }
+        }
+
+        ::SimdSynetSetTuning(SimdFalse, NULL);
+        ::remove(path.c_str());
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution32fShareAutoTest(const Param & p)
+    {
+        const float EPS = 0.001f;
+        bool result = true;
+
+        SimdSynetCompatibilityType fp32 = SimdSynetCompatibilityDefault;
+        const SimdConvolutionParameters & c = p.conv;
+        TEST_LOG_SS(Info, "Test SimdSynetConvolution32fShare " << p.Decription("-fp32") << ".");
+
+        Tensor32f src({ p.batch, c.srcH, c.srcW, c.srcC });
+        Tensor32f weight({ c.kernelY, c.kernelX, c.srcC / c.group, c.dstC });
+        Tensor32f bias({ c.dstC }), params({ c.dstC });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+
+        void * control = Simd::Base::SynetConvolution32fInit(p.batch, &c, fp32);
+        void * origin = ::SimdSynetConvolution32fInit(p.batch, &c, fp32);
+        ::SimdSynetConvolution32fSetParams(control, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetConvolution32fSetParams(origin, weight.Data(), NULL, bias.Data(), params.Data());
+
+        const size_t N = 2;
+        void * shared[N];
+        for (size_t i = 0; i < N; ++i)
+            shared[i] = ::SimdSynetConvolution32fShare(origin);
+        ::SimdRelease(origin);
+
+        Tensor32f dst0({ p.batch, c.dstH, c.dstW, c.dstC }), buf0({ ::SimdSynetConvolution32fExternalBufferSize(control) });
+        ::SimdSynetConvolution32fForward(control, src.Data(), buf0.Data(), dst0.Data());
+        ::SimdRelease(control);
+
+        Tensor32f dst[N], buf[N];
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < N; ++i)
+        {
+            dst[i].Reshape({ p.batch, c.dstH, c.dstW, c.dstC });
+            buf[i].Reshape({ ::SimdSynetConvolution32fExternalBufferSize(shared[i]) });
+            threads.push_back(std::thread(::SimdSynetConvolution32fForward, shared[i], src.Data(), buf[i].Data(), dst[i].Data()));
+        }
+        for (size_t i = 0; i < N; ++i)
+        {
+            threads[i].join();
+            ::SimdRelease(shared[i]);
+            result = result && Compare(dst0, dst[i], EPS, true, 64, DifferenceBoth);
+        }
+
+        return result;
+    }
+
+    bool SynetConvolution32fShareAutoTest()
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+
+        result = result && SynetConvolution32fShareAutoTest(Param(1, 32, 19, 16, 64, _1, _1, _1, _0, _0, 1, SimdConvolutionActivationRelu, SimdTrue));
+        result = result && SynetConvolution32fShareAutoTest(Param(1, 64, 19, 16, 64, _3, _1, _1, _1, _1, 64, SimdConvolutionActivationPrelu, SimdTrue));
+        result = result && SynetConvolution32fShareAutoTest(Param(1, 16, 20, 18, 32, _3, _1, _2, _1, _1, 1, SimdConvolutionActivationIdentity, SimdTrue));
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution32fExportAutoTest(const Param & p, SimdSynetCompatibilityType comp)
+    {
+        bool result = true;
+
+        const SimdConvolutionParameters & c = p.conv;
+        TEST_LOG_SS(Info, "Test SimdSynetConvolution32fExport/Import " << p.Decription(Simd::Base::Bf16Soft(comp) ? "-bf16" : "-fp32") << ".");
+
+        Tensor32f src({ p.batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
+        Tensor32f weight({ p.trans ? c.kernelY : c.dstC, p.trans ? c.kernelX : c.srcC / c.group,
+            p.trans ? c.srcC / c.group : c.kernelY, p.trans ? c.dstC : c.kernelX });
+        Tensor32f bias({ c.dstC }), params({ c.dstC });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+
+        void * context1 = ::SimdSynetConvolution32fInit(p.batch, &c, comp);
+        ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        std::vector<uint8_t> image(::SimdSynetConvolution32fExport(context1, NULL, 0));
+        if (image.empty())
+        {
+            TEST_LOG_SS(Info, "Algorithm " << ::SimdSynetConvolution32fInfo(context1) << " has nothing to export.");
+            ::SimdRelease(context1);
+            return result;
+        }
+        ::SimdSynetConvolution32fExport(context1, image.data(), image.size());
+
+        void * context2 = ::SimdSynetConvolution32fInit(p.batch, &c, comp);
+        if (!::SimdSynetConvolution32fImport(context2, image.data(), image.size(), NULL, NULL, bias.Data(), params.Data()))
+        {
+            TEST_LOG_SS(Error, "Can't import packed weights of " << ::SimdSynetConvolution32fInfo(context2) << " !");
+            result = false;
+        }
+
+        Tensor32f dst1({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+        Tensor32f dst2({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+        ::SimdSynetConvolution32fForward(context1, src.Data(), NULL, dst1.Data());
+        if (result)
+        {
+            ::SimdSynetConvolution32fForward(context2, src.Data(), NULL, dst2.Data());
+            result = Compare(dst1, dst2, 0.0f, true, 64, DifferenceAbsolute);
+        }
+
+        SimdConvolutionParameters other = c;
+        other.dstC += 1;
+        void * context3 = ::SimdSynetConvolution32fInit(p.batch, &other, comp);
+        if (::SimdSynetConvolution32fImport(context3, image.data(), image.size(), NULL, NULL, NULL, NULL))
+        {
+            TEST_LOG_SS(Error, "Packed weights are imported into convolution with other parameters!");
+            result = false;
+        }
+        image[0] ^= 1;
+        if (::SimdSynetConvolution32fImport(context2, image.data(), image.size(), NULL, NULL, NULL, NULL))
+        {
+            TEST_LOG_SS(Error, "Corrupted image of packed weights is imported!");
+            result = false;
+        }
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+        ::SimdRelease(context3);
+
+        return result;
+    }
+
+    bool SynetConvolution32fExportAutoTest()
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        SimdSynetCompatibilityType fp32 = SimdSynetCompatibilityDefault, bf16 = SimdSynetCompatibility16bfSoft;
+
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 32, 19, 16, 64, _1, _1, _1, _0, _0, 1, SimdConvolutionActivationRelu, SimdTrue), fp32);
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 64, 19, 16, 64, _3, _1, _1, _1, _1, 1, SimdConvolutionActivationPrelu, SimdTrue), fp32);
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 64, 38, 32, 64, _3, _1, _1, _1, _1, 1, SimdConvolutionActivationRelu, SimdFalse), fp32);
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 16, 20, 18, 32, _3, _1, _2, _1, _1, 1, SimdConvolutionActivationIdentity, SimdTrue), fp32);
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 32, 19, 16, 64, _3, _1, _1, _1, _1, 1, SimdConvolutionActivationRelu, SimdTrue), bf16);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution32fForwardAddAutoTest(const Param & p)
+    {
+        const float EPS = 0.001f;
+        bool result = true;
+
+        SimdSynetCompatibilityType fp32 = SimdSynetCompatibilityDefault;
+        const SimdConvolutionParameters & c = p.conv;
+        TEST_LOG_SS(Info, "Test SimdSynetConvolution32fForwardAdd " << p.Decription("-fp32") << ".");
+
+        Tensor32f src({ p.batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
+        Tensor32f weight({ p.trans ? c.kernelY : c.dstC, p.trans ? c.kernelX : c.srcC / c.group,
+            p.trans ? c.srcC / c.group : c.kernelY, p.trans ? c.dstC : c.kernelX });
+        Tensor32f bias({ c.dstC });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Shape shape = { p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW };
+        Tensor32f add(shape), dst0(shape), dst1(shape);
+        FillRandom(add.Data(), add.Size(), -1.0, 1.0f);
+
+        SimdConvolutionParameters identity = c;
+        identity.activation = SimdConvolutionActivationIdentity;
+        void * control = Simd::Base::SynetConvolution32fInit(p.batch, &identity, fp32);
+        ::SimdSynetConvolution32fSetParams(control, weight.Data(), NULL, bias.Data(), NULL);
+        ::SimdSynetConvolution32fForward(control, src.Data(), NULL, dst0.Data());
+        ::SimdRelease(control);
+        for (size_t i = 0; i < dst0.Size(); ++i)
+        {
+            dst0.Data()[i] += add.Data()[i];
+            if (c.activation == SimdConvolutionActivationRelu)
+                dst0.Data()[i] = Simd::Max(0.0f, dst0.Data()[i]);
+        }
+
+        void * context = ::SimdSynetConvolution32fInit(p.batch, &c, fp32);
+        ::SimdSynetConvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), NULL);
+        memcpy(dst1.Data(), add.Data(), add.Size() * sizeof(float));
+        if (::SimdSynetConvolution32fForwardAdd(context, src.Data(), NULL, dst1.Data()))
+            result = Compare(dst0, dst1, EPS, true, 64, DifferenceBoth);
+        else
+        {
+            TEST_LOG_SS(Info, "Algorithm " << ::SimdSynetConvolution32fInfo(context) << " doesn't support residual input before activation.");
+            result = Compare(add, dst1, 0.0f, true, 64, DifferenceAbsolute);
+        }
+        ::SimdRelease(context);
+
+        return result;
+    }
+
+    bool SynetConvolution32fForwardAddAutoTest()
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdBool t = SimdTrue, f = SimdFalse;
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu;
+
+        result = result && SynetConvolution32fForwardAddAutoTest(Param(1, 64, 19, 16, 64, _1, _1, _1, _0, _0, 1, aRe, t));
+        result = result && SynetConvolution32fForwardAddAutoTest(Param(1, 64, 19, 16, 64, _3, _1, _1, _1, _1, 1, aRe, t));
+        result = result && SynetConvolution32fForwardAddAutoTest(Param(1, 256, 10, 9, 96, _1, _1, _1, _0, _0, 1, aId, t));
+        result = result && SynetConvolution32fForwardAddAutoTest(Param(2, 32, 19, 16, 48, _3, _1, _2, _1, _1, 1, aRe, t));
+        result = result && SynetConvolution32fForwardAddAutoTest(Param(1, 64, 19, 16, 64, _3, _1, _1, _1, _1, 1, aRe, f));
+        result = result && SynetConvolution32fForwardAddAutoTest(Param(1, 64, 19, 16, 64, _1, _1, _1, _0, _0, 1, aId, f));
+
+        return result;
+    }
 #endif
 }
@@ -43,18 +43,22 @@ namespace Test
 
             FuncPtr func;
             String desc;
+            int64_t flop, bytes;
 
-            FuncC(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+            FuncC(const FuncPtr & f, const String & d) : func(f), desc(d), flop(0), bytes(0) {}
 
             void Update(const Param & p, SimdSynetCompatibilityType c)
             {
                 const char* afs[] = { "-id", "-re", "-lr", "-rr", "-pr", "-el", "-hs", "-mi", "-hi", "-sw" };
                 desc = desc + p.Decription(String(afs[p.conv.activation]) + (Simd::Base::Overflow(c) ? "-o" : Simd::Base::Narrowed(c) ? "-n" : "-p"));
+                flop = SynetConvolutionFlop(p.batch, p.conv);
+                bytes = SynetConvolutionBytes(p.batch, p.conv, 1);
             }
 
             void Call(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst) const
             {
                 TEST_PERFORMANCE_TEST(desc);
+                TEST_PERFORMANCE_TEST_SET_WORK(flop, bytes, true);
                 ::SimdSynetConvolution8iForward(context, src, buf, dst);
             }
         };
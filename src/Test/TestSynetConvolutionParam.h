@@ -28,6 +28,47 @@
 
 namespace Test
 {
+    inline size_t SynetElementSize(SimdTensorDataType type)
+    {
+        return type == SimdTensorData8u || type == SimdTensorData8i ? 1 : (type == SimdTensorData16b ? 2 : 4);
+    }
+
+    inline int64_t SynetConvolutionFlop(size_t batch, const SimdConvolutionParameters & c)
+    {
+        return int64_t(batch) * c.kernelY * c.kernelX * c.srcC / c.group * c.dstH * c.dstW * c.dstC * 2;
+    }
+
+    inline int64_t SynetConvolutionWeightBytes(const SimdConvolutionParameters & c, size_t weight)
+    {
+        return int64_t(c.kernelY) * c.kernelX * c.srcC / c.group * c.dstC * weight;
+    }
+
+    inline int64_t SynetConvolutionBytes(size_t batch, const SimdConvolutionParameters & c, size_t weight)
+    {
+        return int64_t(batch) * (c.srcC * c.srcH * c.srcW * SynetElementSize(c.srcT) + 
+            c.dstC * c.dstH * c.dstW * SynetElementSize(c.dstT)) + SynetConvolutionWeightBytes(c, weight);
+    }
+
+    inline int64_t SynetMergedConvolutionFlop(size_t batch, const SimdConvolutionParameters * c, size_t count)
+    {
+        int64_t flop = 0;
+        for (size_t i = 0; i < count; ++i)
+            flop += SynetConvolutionFlop(batch, c[i]);
+        return flop;
+    }
+
+    inline int64_t SynetMergedConvolutionBytes(size_t batch, const SimdConvolutionParameters * c, size_t count, size_t weight)
+    {
+        const SimdConvolutionParameters & src = c[0], & dst = c[count - 1];
+        int64_t bytes = int64_t(batch) * (src.srcC * src.srcH * src.srcW * SynetElementSize(src.srcT) +
+            dst.dstC * dst.dstH * dst.dstW * SynetElementSize(dst.dstT));
+        for (size_t i = 0; i < count; ++i)
+            bytes += SynetConvolutionWeightBytes(c[i], weight);
+        return bytes;
+    }
+
+    //-------------------------------------------------------------------------
+
     template<bool back> struct SynetConvolutionParam
     {
         SimdBool trans;
@@ -41,17 +41,21 @@ namespace Test
 
             FuncPtr func;
             String desc;
+            int64_t flop, bytes;
 
-            FuncIP32F(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+            FuncIP32F(const FuncPtr& f, const String& d) : func(f), desc(d), flop(0), bytes(0) {}
 
             void Update(size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a)
             {
                 desc = desc + "[" + ToString(b) + "-" + ToString(i) + "-" + ToString(o) + "-" + ToString((int)t) + "]";
+                flop = int64_t(b) * i * o * 2;
+                bytes = (int64_t(b) * (i + o) + int64_t(i) * o) * sizeof(float);
             }
 
             void Call(void* context, const Tensor32f& src, Tensor32f& dst) const
             {
                 TEST_PERFORMANCE_TEST(desc);
+                TEST_PERFORMANCE_TEST_SET_WORK(flop, bytes, false);
                 ::SimdSynetInnerProduct32fForward(context, src.Data(), dst.Data());
             }
         };
@@ -323,18 +327,22 @@ namespace Test
 
             FuncPtr func;
             String desc;
+            int64_t flop, bytes;
 
-            FuncIP8I(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+            FuncIP8I(const FuncPtr& f, const String& d) : func(f), desc(d), flop(0), bytes(0) {}
 
             void Update(size_t M, size_t N, size_t K, SimdSynetCompatibilityType c)
             {
                 desc = desc + "[" + ToString(M) + "x" + ToString(N) + "x" + ToString(K) + "-"
                     + (Simd::Base::Narrowed(c) ? "n" : Simd::Base::Overflow(c) ? "o" : "p") + "]";
+                flop = int64_t(M) * N * K * 2;
+                bytes = int64_t(M) * K + int64_t(N) * K + int64_t(M) * N * sizeof(int32_t);
             }
 
             void Call(const Tensor8u & src, const Tensor8i & weight, Tensor32i& dst, SimdSynetCompatibilityType c) const
             {
                 TEST_PERFORMANCE_TEST(desc);
+                TEST_PERFORMANCE_TEST_SET_WORK(flop, bytes, true);
                 func(src.Axis(0), weight.Axis(0), weight.Axis(1), src.Data(), weight.Data(), dst.Data(), c);
             }
         };
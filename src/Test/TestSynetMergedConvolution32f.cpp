@@ -26,6 +26,7 @@
 #include "Test/TestData.h"
 #include "Test/TestTensor.h"
 #include "Test/TestString.h"
+#include "Test/TestSynetConvolutionParam.h"
 
 #include "Simd/SimdSynetMergedConvolution32f.h"
 #include "Simd/SimdSynet.h"
@@ -104,8 +105,9 @@ namespace Test
 
             FuncPtr func;
             String description;
+            int64_t flop, bytes;
 
-            FuncMC(const FuncPtr & f, const String & d) : func(f), description(d) {}
+            FuncMC(const FuncPtr & f, const String & d) : func(f), description(d), flop(0), bytes(0) {}
 
             void Update(const Param & p, SimdSynetCompatibilityType c)
             {
@@ -116,6 +118,8 @@ namespace Test
                     ss << "-" << (p.conv[i].group != 1 ? String("") : ToString(p.conv[i].dstC) + "x") << p.conv[i].kernelY << "x" << p.conv[i].strideY;
                 ss << (Simd::Base::Bf16Soft(c) ? "-bf16" : "-fp32") << "]";
                 description = ss.str();
+                flop = SynetMergedConvolutionFlop(p.batch, p.conv, p.count);
+                bytes = SynetMergedConvolutionBytes(p.batch, p.conv, p.count, Simd::Base::Bf16Soft(c) ? 2 : 4);
             }
 
             void Call(void* context, const Tensor32f & src, Tensor32f & buf, Tensor32f & dst, int add) const
@@ -126,6 +130,7 @@ namespace Test
                     SimdFill32f(dst.Data(), dst.Size(), &value);
                 }
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_WORK(flop, bytes, false);
                 ::SimdSynetMergedConvolution32fForward(context, src.Data(), buf.Data(), dst.Data());
             }
         };
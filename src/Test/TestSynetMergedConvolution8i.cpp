@@ -26,6 +26,7 @@
 #include "Test/TestData.h"
 #include "Test/TestTensor.h"
 #include "Test/TestString.h"
+#include "Test/TestSynetConvolutionParam.h"
 
 #include "Simd/SimdSynetMergedConvolution8i.h"
 #include "Simd/SimdSynet.h"
@@ -109,8 +110,9 @@ namespace Test
 
             FuncPtr func;
             String desc;
+            int64_t flop, bytes;
 
-            FuncMC(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+            FuncMC(const FuncPtr & f, const String & d) : func(f), desc(d), flop(0), bytes(0) {}
 
             void Update(const Param & p)
             {
@@ -122,11 +124,14 @@ namespace Test
                 ss << "-" << (p.conv[0].srcT == SimdTensorData32f ? "f" : "u") << (p.conv[p.count - 1].dstT == SimdTensorData32f ? "f" : "u");
                 ss << "-" << ((Simd::Base::Overflow(p.comp) ? "o" : Simd::Base::Narrowed(p.comp) ? "n" : "p")) << "]";
                 desc = ss.str();
+                flop = SynetMergedConvolutionFlop(p.batch, p.conv, p.count);
+                bytes = SynetMergedConvolutionBytes(p.batch, p.conv, p.count, 1);
             }
 
             void Call(void * context, const uint8_t* src, uint8_t * buf, uint8_t* dst) const
             {
                 TEST_PERFORMANCE_TEST(desc);
+                TEST_PERFORMANCE_TEST_SET_WORK(flop, bytes, true);
                 ::SimdSynetMergedConvolution8iForward(context, src, buf, dst);
             }
         };
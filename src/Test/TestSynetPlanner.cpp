@@ -0,0 +1,133 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+#include "Test/TestTensor.h"
+
+#include "Simd/SimdSynet.h"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    bool SynetPlannerAutoTest(size_t channels, size_t height, size_t width, size_t layers)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdSynetPlanner for " << layers << " convolutions " << channels << "x" << height << "x" << width << ".");
+
+        SimdConvolutionParameters conv;
+        conv.srcC = channels;
+        conv.srcH = height;
+        conv.srcW = width;
+        conv.srcT = SimdTensorData32f;
+        conv.srcF = SimdTensorFormatNhwc;
+        conv.dstC = channels;
+        conv.dstH = height;
+        conv.dstW = width;
+        conv.dstT = SimdTensorData32f;
+        conv.dstF = SimdTensorFormatNhwc;
+        conv.kernelY = 3;
+        conv.kernelX = 3;
+        conv.dilationY = 1;
+        conv.dilationX = 1;
+        conv.strideY = 1;
+        conv.strideX = 1;
+        conv.padY = 1;
+        conv.padX = 1;
+        conv.padH = 1;
+        conv.padW = 1;
+        conv.group = 1;
+        conv.activation = SimdConvolutionActivationRelu;
+
+        size_t size = channels * height * width;
+        Tensor32f weight({ 3, 3, channels, channels }), bias({ channels });
+        FillRandom(weight.Data(), weight.Size(), -0.1f, 0.1f);
+        FillRandom(bias.Data(), bias.Size(), -0.1f, 0.1f);
+
+        std::vector<void*> contexts(layers);
+        void * planner = ::SimdSynetPlannerInit();
+        std::vector<size_t> tensors(layers + 1), indices(layers);
+        for (size_t i = 0; i <= layers; ++i)
+            tensors[i] = ::SimdSynetPlannerAddTensor(planner, size * sizeof(float));
+        for (size_t i = 0; i < layers; ++i)
+        {
+            contexts[i] = ::SimdSynetConvolution32fInit(1, &conv, SimdSynetCompatibilityDefault);
+            ::SimdSynetConvolution32fSetParams(contexts[i], weight.Data(), NULL, bias.Data(), NULL);
+            indices[i] = ::SimdSynetPlannerAddLayer(planner, SimdSynetPlannerLayerConvolution32f, contexts[i], &tensors[i], 1, &tensors[i + 1], 1);
+        }
+        size_t arena = ::SimdSynetPlannerPlan(planner);
+
+        size_t naive = (layers + 1) * Simd::AlignHi(size * sizeof(float), SIMD_ALIGN);
+        for (size_t i = 0; i < layers; ++i)
+            naive += Simd::AlignHi(::SimdSynetConvolution32fExternalBufferSize(contexts[i]) * sizeof(float), SIMD_ALIGN);
+        TEST_LOG_SS(Info, "Arena size is " << arena / 1024 << " kB instead of " << naive / 1024 << " kB.");
+        if (arena > naive || (layers > 2 && arena >= naive))
+        {
+            TEST_LOG_SS(Error, "Memory planner does not reuse memory!");
+            result = false;
+        }
+
+        std::vector<Tensor32f> control(layers + 1);
+        for (size_t i = 0; i <= layers; ++i)
+            control[i].Reshape({ size });
+        FillRandom(control[0].Data(), size, -1.0f, 1.0f);
+        for (size_t i = 0; i < layers; ++i)
+            ::SimdSynetConvolution32fForward(contexts[i], control[i].Data(), NULL, control[i + 1].Data());
+
+        uint8_t * base = (uint8_t*)::SimdAllocate(arena, ::SimdAlignment());
+        memset(base, 0xFF, arena);
+        memcpy(base + ::SimdSynetPlannerTensorOffset(planner, tensors[0]), control[0].Data(), size * sizeof(float));
+        for (size_t i = 0; i < layers; ++i)
+        {
+            float * pSrc = (float*)(base + ::SimdSynetPlannerTensorOffset(planner, tensors[i]));
+            float * pDst = (float*)(base + ::SimdSynetPlannerTensorOffset(planner, tensors[i + 1]));
+            float * pBuf = (float*)(base + ::SimdSynetPlannerBufferOffset(planner, indices[i]));
+            ::SimdSynetConvolution32fForward(contexts[i], pSrc, pBuf, pDst);
+        }
+        Tensor32f dst({ size });
+        memcpy(dst.Data(), base + ::SimdSynetPlannerTensorOffset(planner, tensors[layers]), size * sizeof(float));
+        ::SimdFree(base);
+
+        result = result && Compare(control[layers], dst, 0.0f, true, 64, DifferenceAbsolute);
+
+        for (size_t i = 0; i < layers; ++i)
+            ::SimdRelease(contexts[i]);
+        ::SimdRelease(planner);
+
+        return result;
+    }
+
+    bool SynetPlannerAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetPlannerAutoTest(16, 32, 32, 1);
+        result = result && SynetPlannerAutoTest(32, 19, 16, 5);
+        result = result && SynetPlannerAutoTest(64, 10, 10, 8);
+
+        return result;
+    }
+#endif
+}
@@ -0,0 +1,519 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestLog.h"
+
+#include "Simd/SimdTaskGraph.hpp"
+
+#include <thread>
+#include <atomic>
+#include <stdexcept>
+#include <functional>
+
+namespace Test
+{
+    namespace
+    {
+        struct ParallelCoverage
+        {
+            size_t begin, end, threadNumber, blockAlign;
+            std::vector<std::atomic<int>> items, threads;
+            std::atomic<int> misaligned;
+
+            ParallelCoverage(size_t b, size_t e, size_t t, size_t a)
+                : begin(b), end(e), threadNumber(t), blockAlign(a), items(e - b), threads(t + 1), misaligned(0)
+            {
+                for (size_t i = 0; i < items.size(); ++i)
+                    items[i] = 0;
+                for (size_t i = 0; i < threads.size(); ++i)
+                    threads[i] = 0;
+            }
+
+            static void Task(void * context, size_t thread, size_t begin, size_t end)
+            {
+                ParallelCoverage & c = *(ParallelCoverage*)context;
+                c.threads[Simd::Min(thread, c.threadNumber)]++;
+                if ((begin - c.begin) % c.blockAlign)
+                    c.misaligned++;
+                for (size_t i = begin; i < end; ++i)
+                    c.items[i - c.begin]++;
+            }
+
+            bool Check() const
+            {
+                for (size_t i = 0; i < items.size(); ++i)
+                {
+                    if (items[i] != 1)
+                    {
+                        TEST_LOG_SS(Error, "SimdParallel [" << begin << ", " << end << ") t=" << threadNumber << " a=" << blockAlign << " : item " << begin + i << " is processed " << items[i] << " times!");
+                        return false;
+                    }
+                }
+                for (size_t i = 0; i < threads.size(); ++i)
+                {
+                    if (threads[i] > 1 || (i == threadNumber && threads[i] != 0))
+                    {
+                        TEST_LOG_SS(Error, "SimdParallel [" << begin << ", " << end << ") t=" << threadNumber << " a=" << blockAlign << " : wrong usage of thread index " << i << " !");
+                        return false;
+                    }
+                }
+                if (misaligned)
+                {
+                    TEST_LOG_SS(Error, "SimdParallel [" << begin << ", " << end << ") t=" << threadNumber << " a=" << blockAlign << " : block is not aligned!");
+                    return false;
+                }
+                return true;
+            }
+        };
+
+        bool ParallelCoverageTest(size_t begin, size_t end, size_t threadNumber, size_t blockAlign)
+        {
+            ParallelCoverage coverage(begin, end, threadNumber, blockAlign);
+            SimdParallel(begin, end, ParallelCoverage::Task, &coverage, threadNumber, blockAlign);
+            return coverage.Check();
+        }
+
+        bool ParallelCoverageTests()
+        {
+            bool result = true;
+            const size_t sizes[] = { 1, 2, 7, 100, 1001 }, threads[] = { 1, 2, 3, 8, 33 }, aligns[] = { 1, 4, 16 };
+            for (size_t s = 0; s < 5; ++s)
+                for (size_t t = 0; t < 5; ++t)
+                    for (size_t a = 0; a < 3; ++a)
+                        result = result && ParallelCoverageTest(5, 5 + sizes[s], threads[t], aligns[a]);
+            return result;
+        }
+
+        struct ParallelNested
+        {
+            std::atomic<size_t> sum;
+
+            static void Inner(void * context, size_t thread, size_t begin, size_t end)
+            {
+                ParallelNested & n = *(ParallelNested*)context;
+                for (size_t i = begin; i < end; ++i)
+                    n.sum += i;
+            }
+
+            static void Outer(void * context, size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                    SimdParallel(0, 100, Inner, context, 4, 1);
+            }
+        };
+
+        bool ParallelNestedTest()
+        {
+            ParallelNested nested;
+            nested.sum = 0;
+            SimdParallel(0, 16, ParallelNested::Outer, &nested, 4, 1);
+            if (nested.sum != 16 * 4950)
+            {
+                TEST_LOG_SS(Error, "Nested SimdParallel : wrong sum " << nested.sum << " != " << 16 * 4950 << " !");
+                return false;
+            }
+            return true;
+        }
+
+        bool ParallelConcurrentTest()
+        {
+            const size_t callers = 4;
+            std::atomic<bool> result(true);
+            std::vector<std::thread> threads;
+            for (size_t i = 0; i < callers; ++i)
+            {
+                threads.push_back(std::thread([i, &result]()
+                {
+                    for (size_t j = 0; j < 100; ++j)
+                        if (!ParallelCoverageTest(0, 1000 + i * 100 + j, 2 + (i + j) % 7, 1 + j % 3))
+                            result = false;
+                }));
+            }
+            for (size_t i = 0; i < callers; ++i)
+                threads[i].join();
+            return result;
+        }
+
+        void ParallelThrowTask(void * context, size_t thread, size_t begin, size_t end)
+        {
+            if (end == *(size_t*)context)
+                throw std::runtime_error("ParallelThrowTask");
+        }
+
+        bool ParallelExceptionTest()
+        {
+            size_t end = 100;
+            try
+            {
+                SimdParallel(0, end, ParallelThrowTask, &end, 4, 1);
+            }
+            catch (const std::runtime_error &)
+            {
+                return ParallelCoverageTest(0, 100, 4, 1);
+            }
+            TEST_LOG_SS(Error, "SimdParallel does not propagate exception of the task!");
+            return false;
+        }
+    }
+
+    bool ParallelAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdParallel.");
+
+        result = result && ParallelCoverageTests();
+
+        result = result && ParallelNestedTest();
+
+        result = result && ParallelConcurrentTest();
+
+        result = result && ParallelExceptionTest();
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        typedef std::function<void(View & dst0, View & dst1)> RowsFunc;
+
+        bool ParallelRowsTest(const String & description, size_t threadNumber, const RowsFunc & func, const View & dst0, const View & dst1 = View())
+        {
+            View single0(dst0.Size(), dst0.format), multi0(dst0.Size(), dst0.format), single1, multi1;
+            Simd::Copy(dst0, single0);
+            Simd::Copy(dst0, multi0);
+            if (dst1.format != View::None)
+            {
+                single1.Recreate(dst1.Size(), dst1.format);
+                multi1.Recreate(dst1.Size(), dst1.format);
+            }
+            size_t threadNumberOld = SimdGetThreadNumber();
+            SimdSetThreadNumber(1);
+            func(single0, single1);
+            SimdSetThreadNumber(threadNumber);
+            func(multi0, multi1);
+            SimdSetThreadNumber(threadNumberOld);
+            bool result = Compare(single0, multi0, 0, true, 32, 0, description);
+            if (dst1.format != View::None)
+                result = result && Compare(single1, multi1, 0, true, 32, 0, description);
+            return result;
+        }
+
+        bool ParallelRowsTest(size_t width, size_t height, size_t threadNumber)
+        {
+            bool result = true;
+
+            TEST_LOG_SS(Info, "Test parallel per-pixel functions [" << width << ", " << height << "] with " << threadNumber << " threads.");
+
+            View gray(width, height, View::Gray8), bgr(width, height, View::Bgr24), bgra(width, height, View::Bgra32);
+            FillRandom(gray);
+            FillRandom(bgr);
+            FillRandom(bgra);
+
+            result = result && ParallelRowsTest("AlphaBlending", threadNumber, [&](View & dst, View &)
+            {
+                SimdAlphaBlending(bgr.data, bgr.stride, width, height, 3, gray.data, gray.stride, dst.data, dst.stride);
+            }, bgr);
+
+            result = result && ParallelRowsTest("BgraToGray", threadNumber, [&](View & dst, View &)
+            {
+                SimdBgraToGray(bgra.data, width, height, bgra.stride, dst.data, dst.stride);
+            }, View(width, height, View::Gray8));
+
+            result = result && ParallelRowsTest("GaussianBlur3x3", threadNumber, [&](View & dst, View &)
+            {
+                SimdGaussianBlur3x3(bgr.data, bgr.stride, width, height, 3, dst.data, dst.stride);
+            }, View(width, height, View::Bgr24));
+
+            result = result && ParallelRowsTest("MedianFilterSquare5x5", threadNumber, [&](View & dst, View &)
+            {
+                SimdMedianFilterSquare5x5(gray.data, gray.stride, width, height, 1, dst.data, dst.stride);
+            }, View(width, height, View::Gray8));
+
+            result = result && ParallelRowsTest("SobelDx", threadNumber, [&](View & dst, View &)
+            {
+                SimdSobelDx(gray.data, gray.stride, width, height, dst.data, dst.stride);
+            }, View(width, height, View::Int16));
+
+            result = result && ParallelRowsTest("Integral", threadNumber, [&](View & sum, View & sqsum)
+            {
+                SimdIntegral(gray.data, gray.stride, width, height, sum.data, sum.stride, sqsum.data, sqsum.stride, NULL, 0,
+                    (SimdPixelFormatType)sum.format, (SimdPixelFormatType)sqsum.format);
+            }, View(width + 1, height + 1, View::Int32), View(width + 1, height + 1, View::Double));
+
+            size_t yuvHeight = height & (~1);
+            View u(width / 2, yuvHeight / 2, View::Gray8), v(width / 2, yuvHeight / 2, View::Gray8);
+            FillRandom(u);
+            FillRandom(v);
+            result = result && ParallelRowsTest("Yuv420pToBgra", threadNumber, [&](View & dst, View &)
+            {
+                SimdYuv420pToBgra(gray.data, gray.stride, u.data, u.stride, v.data, v.stride, width, yuvHeight, dst.data, dst.stride, 0xFF);
+            }, View(width, yuvHeight, View::Bgra32));
+
+            return result;
+        }
+    }
+
+    bool ParallelRowsAutoTest()
+    {
+        bool result = true;
+
+        result = result && ParallelRowsTest(1000, 523, 2);
+        result = result && ParallelRowsTest(1000, 777, 3);
+        result = result && ParallelRowsTest(1002, 1030, 4);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------------------------------------
+
+    bool ThreadBudgetAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdSetThreadBudget.");
+
+        const size_t width = 1001, height = 777;
+        const float sigma = 1.5f;
+        View src(width, height, View::Bgr24), dst1(width, height, View::Bgr24), dst2(width, height, View::Bgr24);
+        FillRandom(src);
+
+        void * global = SimdGaussianBlurInit(width, height, 3, &sigma, NULL);
+        void * budget = SimdGaussianBlurInit(width, height, 3, &sigma, NULL);
+
+        size_t threadNumber = Simd::Min<size_t>(2, std::thread::hardware_concurrency()), cpus[2] = { 0, 1 };
+        SimdSetThreadBudget(budget, 2, cpus, 2);
+        if (SimdGetThreadBudget(budget) != threadNumber || SimdGetThreadBudget(global) != SimdGetThreadNumber())
+        {
+            TEST_LOG_SS(Error, "SimdGetThreadBudget returns wrong thread number!");
+            result = false;
+        }
+
+        SimdGaussianBlurRun(global, src.data, src.stride, dst1.data, dst1.stride);
+        SimdGaussianBlurRun(budget, src.data, src.stride, dst2.data, dst2.stride);
+        result = result && Compare(dst1, dst2, 0, true, 32, 0, "GaussianBlurRun");
+
+        SimdSetThreadBudget(budget, 0, NULL, 0);
+        if (SimdGetThreadBudget(budget) != SimdGetThreadNumber())
+        {
+            TEST_LOG_SS(Error, "SimdSetThreadBudget does not reset thread budget!");
+            result = false;
+        }
+
+        SimdRelease(global);
+        SimdRelease(budget);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------------------------------------
+
+    bool ThreadAffinityAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdSetThreadAffinity.");
+
+        size_t cpu = 0;
+        SimdSetThreadAffinity(&cpu, 1);
+        result = result && ParallelCoverageTest(0, 1000, 4, 1);
+
+        std::vector<size_t> cpus(std::thread::hardware_concurrency() + 1), nodes(cpus.size());
+        size_t workers = SimdGetThreadTopology(cpus.data(), nodes.data(), cpus.size());
+        if (workers >= cpus.size())
+        {
+            TEST_LOG_SS(Error, "SimdGetThreadTopology returns too many workers: " << workers << " !");
+            result = false;
+        }
+        for (size_t i = 0; i < workers && result; ++i)
+        {
+            if ((cpus[i] != cpu && cpus[i] != size_t(-1)) || ((cpus[i] == size_t(-1)) != (nodes[i] == size_t(-1))))
+            {
+                TEST_LOG_SS(Error, "SimdGetThreadTopology returns wrong placement of worker " << i << " : cpu = " << cpus[i] << ", node = " << nodes[i] << " !");
+                result = false;
+            }
+        }
+
+        SimdSetThreadAffinity(NULL, 0);
+        result = result && ParallelCoverageTest(0, 1000, 4, 1);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        bool ScratchMemoryTest(size_t seed)
+        {
+            const size_t align = SimdAlignment(), count = 17;
+            size_t mark = SimdScratchMark();
+            std::vector<uint8_t*> ptrs(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                size_t size = (i * 7919 + seed) % 100000 + 1;
+                ptrs[i] = (uint8_t*)SimdScratchAllocate(size, align);
+                if (ptrs[i] == NULL || size_t(ptrs[i]) % align)
+                {
+                    TEST_LOG_SS(Error, "SimdScratchAllocate returns wrong pointer " << (void*)ptrs[i] << " for size " << size << " !");
+                    return false;
+                }
+                memset(ptrs[i], int(i), size);
+                if (i && ptrs[i - 1][0] != uint8_t(i - 1))
+                {
+                    TEST_LOG_SS(Error, "SimdScratchAllocate returns overlapped memory blocks!");
+                    return false;
+                }
+            }
+            SimdScratchReset(mark);
+            uint8_t * first = (uint8_t*)SimdScratchAllocate(1, align);
+            SimdScratchReset(mark);
+            uint8_t * again = (uint8_t*)SimdScratchAllocate(1, align);
+            SimdScratchReset(mark);
+            if (first != again)
+            {
+                TEST_LOG_SS(Error, "SimdScratchReset does not reuse scratch memory!");
+                return false;
+            }
+            return SimdScratchMark() == mark;
+        }
+    }
+
+    bool ScratchMemoryAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdScratchAllocate.");
+
+        result = result && ScratchMemoryTest(0);
+
+        std::atomic<int> errors(0);
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < 4; ++i)
+            threads.push_back(std::thread([&errors, i]() { if (!ScratchMemoryTest(i + 1)) errors++; }));
+        for (size_t i = 0; i < threads.size(); ++i)
+            threads[i].join();
+        result = result && errors == 0;
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        void TaskGraphCount(void * context, SimdBool skip)
+        {
+            if (!skip)
+                (*(std::atomic<size_t>*)context)++;
+        }
+
+        bool TaskGraphTest(size_t threadNumber)
+        {
+            bool result = true;
+
+            size_t threadNumberOld = SimdGetThreadNumber();
+            SimdSetThreadNumber(threadNumber);
+
+            {
+                Simd::TaskGraph graph;
+                std::atomic<size_t> clock(0);
+                size_t stamps[4] = { 0, 0, 0, 0 };
+                Simd::TaskGraph::Future a = graph.Submit([&]() { stamps[0] = ++clock; });
+                Simd::TaskGraph::Future b = graph.Submit([&]() { stamps[1] = ++clock; }, { a });
+                Simd::TaskGraph::Future c = graph.Submit([&]() { stamps[2] = ++clock; }, { a });
+                Simd::TaskGraph::Future d = graph.Submit([&]() { stamps[3] = ++clock; }, { b, c });
+                d.Wait();
+                if (!(stamps[0] < stamps[1] && stamps[0] < stamps[2] && stamps[1] < stamps[3] && stamps[2] < stamps[3]))
+                {
+                    TEST_LOG_SS(Error, "TaskGraph breaks order of dependent tasks: " << stamps[0] << " " << stamps[1] << " " << stamps[2] << " " << stamps[3] << " !");
+                    result = false;
+                }
+
+                std::atomic<size_t> sum(0);
+                const size_t count = 256;
+                for (size_t i = 0; i < count; ++i)
+                    graph.Submit([&sum, i]() { sum += i; });
+                if (!graph.WaitAll() || sum != count * (count - 1) / 2)
+                {
+                    TEST_LOG_SS(Error, "TaskGraph executes independent tasks wrong: sum = " << sum << " !");
+                    result = false;
+                }
+
+                std::atomic<bool> skipped(true);
+                Simd::TaskGraph::Future failed = graph.Submit([]() { throw std::runtime_error("task"); });
+                Simd::TaskGraph::Future dependent = graph.Submit([&]() { skipped = false; }, { failed });
+                bool thrown = false;
+                try
+                {
+                    dependent.Wait();
+                }
+                catch (const std::runtime_error & error)
+                {
+                    thrown = std::string(error.what()) == "task";
+                }
+                if (!thrown || !skipped || graph.WaitAll() || !graph.WaitAll())
+                {
+                    TEST_LOG_SS(Error, "TaskGraph handles exception of task wrong!");
+                    result = false;
+                }
+            }
+
+            void * graph = SimdTaskGraphInit();
+            std::atomic<size_t> counter(0);
+            size_t first = SimdTaskGraphSubmit(graph, TaskGraphCount, &counter, NULL, 0);
+            size_t second = SimdTaskGraphSubmit(graph, TaskGraphCount, &counter, &first, 1);
+            size_t wrong = second + 1;
+            if (first == 0 || second == 0 || SimdTaskGraphSubmit(graph, TaskGraphCount, &counter, &wrong, 1) != 0)
+            {
+                TEST_LOG_SS(Error, "SimdTaskGraphSubmit returns wrong task identifier!");
+                result = false;
+            }
+            if (!SimdTaskGraphWait(graph, second) || counter != 2)
+            {
+                TEST_LOG_SS(Error, "SimdTaskGraphWait returns before finish of task!");
+                result = false;
+            }
+            SimdRelease(graph);
+
+            SimdSetThreadNumber(threadNumberOld);
+
+            return result;
+        }
+    }
+
+    bool TaskGraphAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdTaskGraphSubmit.");
+
+        result = result && TaskGraphTest(1);
+        result = result && TaskGraphTest(std::thread::hardware_concurrency());
+
+        return result;
+    }
+}